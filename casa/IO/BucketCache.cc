@@ -26,12 +26,17 @@
 
 //# Includes
 #include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/BucketPrefetcher.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// The maximum number of bytes written by a single write when flushing.
+static const uInt theMaxWriteSize = 4*1024*1024;
+
 BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
 			  uInt bucketSize, uInt nrOfBuckets,
 			  uInt cacheSize, void* ownerObject,
@@ -45,6 +50,8 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
   its_WriteCallBack (writeCallBack),
   its_InitCallBack  (initCallBack),
   its_DeleteCallBack(deleteCallBack),
+  its_ReadBucket    (0),
+  its_WriteBucket   (0),
   its_StartOffset   (startOffset),
   its_BucketSize    (bucketSize),
   its_CurNrOfBuckets(0),
@@ -94,6 +101,8 @@ BucketCache::~BucketCache()
     // Clear the entire cache.
     // It is not flushed (that should have been done before).
     // In that way no needless flushes are done for a temporary table.
+    // The prefetcher is stopped first, because it uses the file.
+    its_Prefetcher.reset();
     clear (0, False);
     delete [] its_Buffer;
 }
@@ -110,6 +119,7 @@ void BucketCache::clear (uInt fromSlot, Bool doFlush)
     }
     if (fromSlot == 0) {
 	its_LRUCounter = 0;
+	clearPrefetch();
 	initStatistics();
     }
     if (fromSlot < its_CacheSizeUsed) {
@@ -123,14 +133,22 @@ Bool BucketCache::flush (uInt fromSlot)
     if (fromSlot == 0  &&  its_NewNrOfBuckets > 0) {
 	initializeBuckets (its_NewNrOfBuckets - 1);
     }
-    Bool hasWritten = False;
+    // Write the dirty buckets in order of bucket number, so buckets
+    // adjacent in the file can be written using a single write.
+    std::vector<uInt> slots;
     for (uInt i=fromSlot; i<its_CacheSizeUsed; i++) {
 	if (its_Dirty[i]) {
-	    writeBucket (i);
-	    hasWritten = True;
+	    slots.push_back (i);
 	}
     }
-    return hasWritten;
+    if (slots.empty()) {
+        return False;
+    }
+    std::sort (slots.begin(), slots.end(),
+               [this](uInt s1, uInt s2)
+               { return its_BucketNr[s1] < its_BucketNr[s2]; });
+    writeBuckets (slots);
+    return True;
 }
 
 void BucketCache::resize (uInt cacheSize)
@@ -180,11 +198,53 @@ void BucketCache::resync (uInt nrBucket, uInt nrOfFreeBucket,
 }
 
 
+void BucketCache::setBucketIO (BucketCacheReadBucket readBucket,
+                               BucketCacheWriteBucket writeBucket)
+{
+    its_ReadBucket  = readBucket;
+    its_WriteBucket = writeBucket;
+    its_CurNrOfBuckets = its_NewNrOfBuckets;
+    its_Prefetcher.reset();
+}
+
+void BucketCache::setPrefetch (uInt nrBuckets)
+{
+    if (nrBuckets == 0) {
+        its_Prefetcher.reset();
+    } else if (prefetch() != nrBuckets  &&  its_ReadBucket == 0
+           &&  its_file->preadFile()) {
+        its_Prefetcher.reset (new BucketPrefetcher (its_BucketSize,
+                                                    nrBuckets));
+    }
+}
+
+uInt BucketCache::prefetch() const
+{
+    return (its_Prefetcher ?  its_Prefetcher->maxBuckets() : 0);
+}
+
+void BucketCache::clearPrefetch()
+{
+    if (its_Prefetcher) {
+        its_Prefetcher->clear();
+    }
+}
+
 uInt BucketCache::nBucket() const
 {
     return its_NewNrOfBuckets;
 }
 
+uInt BucketCache::nBucketInFile() const
+{
+    return its_CurNrOfBuckets;
+}
+
+Bool BucketCache::isCached (uInt bucketNr) const
+{
+    return bucketNr < its_NewNrOfBuckets  &&  its_SlotNr[bucketNr] >= 0;
+}
+
 void BucketCache::setDirty()
 {
     its_Dirty[its_ActualSlot] = 1;
@@ -213,6 +273,9 @@ char* BucketCache::getBucket (uInt bucketNr)
     if (its_SlotNr[bucketNr] >= 0) {
 	its_ActualSlot = its_SlotNr[bucketNr];
 	setLRU();
+	if (its_Prefetcher) {
+	    readAhead (bucketNr);
+	}
 	return its_Cache[its_ActualSlot];
     }
     // Not in cache, so get a slot.
@@ -221,6 +284,9 @@ char* BucketCache::getBucket (uInt bucketNr)
     if (bucketNr < its_CurNrOfBuckets) {
 	getSlot (bucketNr);
 	readBucket (its_ActualSlot);
+	if (its_Prefetcher) {
+	    readAhead (bucketNr);
+	}
     }else{
         if (! its_file->isWritable()) {
             throw AipsError ("BucketCache::getBucket: bucket " +
@@ -235,6 +301,10 @@ char* BucketCache::getBucket (uInt bucketNr)
 void BucketCache::extend (uInt nrBucket)
 {
     its_NewNrOfBuckets += nrBucket;
+    // The owner reading the buckets also handles the new ones.
+    if (its_ReadBucket != 0) {
+        its_CurNrOfBuckets = its_NewNrOfBuckets;
+    }
     uInt oldSize = its_SlotNr.nelements();
     if (oldSize < its_NewNrOfBuckets) {
         uInt newSize = oldSize*2;
@@ -248,12 +318,38 @@ void BucketCache::extend (uInt nrBucket)
     }
 }
     
+void BucketCache::adoptBucket (uInt bucketNr, char* data)
+{
+    if (bucketNr >= its_CurNrOfBuckets) {
+        its_DeleteCallBack (its_Owner, data);
+	throw (indexError<Int> (bucketNr));
+    }
+    naccess_p++;
+    if (its_SlotNr[bucketNr] >= 0) {
+	its_ActualSlot = its_SlotNr[bucketNr];
+	setLRU();
+        its_DeleteCallBack (its_Owner, data);
+    }else{
+        try {
+            getSlot (bucketNr);
+        } catch (...) {
+            its_DeleteCallBack (its_Owner, data);
+            throw;
+        }
+        its_Cache[its_ActualSlot] = data;
+        nread_p++;
+    }
+}
+
 uInt BucketCache::addBucket (char* data)
 {
     uInt bucketNr;
     if (its_FirstFree >= 0) {
 	// There is a free list, so get the first bucket from it.
 	bucketNr = its_FirstFree;
+	if (its_Prefetcher) {
+	    its_Prefetcher->invalidate (bucketNr);
+	}
 	its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
 	its_file->read (its_Buffer,
 		   CanonicalConversion::canonicalSize (static_cast<Int*>(0)));
@@ -281,6 +377,9 @@ void BucketCache::removeBucket()
     // Thus store the bucket nr of the first free in this bucket
     // and make this bucket the first free.
     uInt bucketNr = its_BucketNr[its_ActualSlot];
+    if (its_Prefetcher) {
+        its_Prefetcher->invalidate (bucketNr);
+    }
     CanonicalConversion::fromLocal (its_Buffer, its_FirstFree);
     its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
     its_file->write (its_Buffer, its_BucketSize);
@@ -350,22 +449,105 @@ void BucketCache::getSlot (uInt bucketNr)
 void BucketCache::writeBucket (uInt slotNr)
 {
 ///    cout << "write " << its_BucketNr[slotNr] << " " << slotNr;
+    if (its_WriteBucket != 0) {
+        its_WriteBucket (its_Owner, its_BucketNr[slotNr], its_Cache[slotNr]);
+        its_Dirty[slotNr] = 0;
+        nwrite_p++;
+        return;
+    }
     its_WriteCallBack (its_Owner, its_Buffer, its_Cache[slotNr]);
+    if (its_Prefetcher) {
+        its_Prefetcher->invalidate (its_BucketNr[slotNr]);
+    }
     its_file->seek (its_StartOffset +
 		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
     its_file->write (its_Buffer, its_BucketSize);
     its_Dirty[slotNr] = 0;
     nwrite_p++;
 }
+void BucketCache::writeBuckets (const std::vector<uInt>& slots)
+{
+    // Buckets written by the owner cannot be combined.
+    if (its_WriteBucket != 0) {
+        for (uInt slotNr : slots) {
+            writeBucket (slotNr);
+        }
+        return;
+    }
+    // Limit the size of a single write.
+    const uInt maxRun = std::max (1u, theMaxWriteSize / its_BucketSize);
+    std::vector<char> buffer;
+    size_t i = 0;
+    while (i < slots.size()) {
+        uInt firstBucket = its_BucketNr[slots[i]];
+        uInt nrun = 1;
+        while (i+nrun < slots.size()  &&  nrun < maxRun
+        &&  its_BucketNr[slots[i+nrun]] == firstBucket + nrun) {
+            nrun++;
+        }
+        if (nrun == 1) {
+            writeBucket (slots[i]);
+        } else {
+            buffer.resize (size_t(nrun) * its_BucketSize);
+            for (uInt j=0; j<nrun; j++) {
+                uInt slotNr = slots[i+j];
+                its_WriteCallBack (its_Owner,
+                                   buffer.data() + size_t(j)*its_BucketSize,
+                                   its_Cache[slotNr]);
+                if (its_Prefetcher) {
+                    its_Prefetcher->invalidate (firstBucket + j);
+                }
+            }
+            its_file->seek (its_StartOffset +
+                            Int64(firstBucket) * its_BucketSize);
+            its_file->write (buffer.data(), nrun * its_BucketSize);
+            for (uInt j=0; j<nrun; j++) {
+                its_Dirty[slots[i+j]] = 0;
+            }
+            nwrite_p += nrun;
+        }
+        i += nrun;
+    }
+}
 void BucketCache::readBucket (uInt slotNr)
 {
 ///    cout << "read " << its_BucketNr[slotNr] << " " << slotNr;
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->read (its_Buffer, its_BucketSize);
+    if (its_ReadBucket != 0) {
+        its_Cache[slotNr] = its_ReadBucket (its_Owner, its_BucketNr[slotNr]);
+        nread_p++;
+        return;
+    }
+    if (!its_Prefetcher
+    ||  !its_Prefetcher->take (its_BucketNr[slotNr], its_Buffer)) {
+        its_file->seek (its_StartOffset +
+                        Int64(its_BucketNr[slotNr]) * its_BucketSize);
+        its_file->read (its_Buffer, its_BucketSize);
+    }
     its_Cache[slotNr] = its_ReadCallBack (its_Owner, its_Buffer);
     nread_p++;
 }
+void BucketCache::readAhead (uInt bucketNr)
+{
+    Int64 stride = its_Prefetcher->access (bucketNr);
+    if (stride != 0) {
+        std::shared_ptr<ByteIO> file = its_file->preadFile();
+        if (file) {
+            // Request the next buckets of the pattern not in the cache yet.
+            Int64 bnr = bucketNr;
+            for (uInt i=0; i<its_Prefetcher->maxBuckets(); i++) {
+                bnr += stride;
+                if (bnr < 0  ||  bnr >= Int64(its_CurNrOfBuckets)) {
+                    break;
+                }
+                if (its_SlotNr[bnr] < 0) {
+                    its_Prefetcher->request (file, bnr,
+                                             its_StartOffset + bnr*its_BucketSize);
+                }
+            }
+        }
+    }
+}
+
 void BucketCache::initializeBuckets (uInt bucketNr)
 {
     // Initialize this bucket and all uninitialized ones before it.
@@ -407,6 +589,10 @@ void BucketCache::showStatistics (ostream& os) const
 	   << 100 * float(naccess_p - nread_p - ninit_p) /
 	                               float(naccess_p) << "%";
     }
+    if (its_Prefetcher) {
+        os << endl;
+        its_Prefetcher->showStatistics (os);
+    }
     cout << endl;
 }
 
@@ -416,6 +602,9 @@ void BucketCache::initStatistics()
     nread_p   = 0;
     ninit_p   = 0;
     nwrite_p  = 0;
+    if (its_Prefetcher) {
+        its_Prefetcher->initStatistics();
+    }
 }
 
 } //# NAMESPACE CASACORE - END
@@ -31,6 +31,8 @@
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
+#include <memory>
+#include <vector>
 
 //# Forward clarations
 #include <casacore/casa/iosfwd.h>
@@ -38,6 +40,9 @@
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# Forward declarations
+class BucketPrefetcher;
+
 // <summary>
 // Define the type of the static read and write function.
 // </summary>
@@ -69,6 +74,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // The DeleteBuffer callback function has to delete the buffer
 // allocated by the ToLocal function.
 // <p>
+// Optionally the ReadBucket and WriteBucket callback functions can be set
+// (see <src>BucketCache::setBucketIO</src>) to let the owner do the IO
+// of a bucket itself. ReadBucket has to create a buffer and fill it with
+// the data of the given bucket in local format. WriteBucket has to store
+// the data of the given bucket in local format. It should NOT delete
+// the buffer.
+// <p>
 // The functions get a pointer to the owner object, which was provided
 // at construction time. The callback function has to cast this to the
 // correct type and can use it thereafter.
@@ -89,6 +101,9 @@ typedef void (*BucketCacheFromLocal) (void* ownerObject, char* canonical,
 				      const char* local);
 typedef char* (*BucketCacheAddBuffer) (void* ownerObject);
 typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
+typedef char* (*BucketCacheReadBucket) (void* ownerObject, uInt bucketNr);
+typedef void (*BucketCacheWriteBucket) (void* ownerObject, uInt bucketNr,
+					const char* local);
 // </group>
 
 
@@ -141,6 +156,16 @@ typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
 // <p>
 // Statistics are kept to know how efficient the cache is working.
 // It is possible to initialize and show the statistics.
+// <p>
+// Optionally buckets can be read ahead in a background thread (see
+// function <src>setPrefetch</src>). BucketCache registers which buckets
+// are accessed and when it detects a sequential or strided access pattern,
+// the next buckets of that pattern are read by a
+// <linkto class=BucketPrefetcher>BucketPrefetcher</linkto> object.
+// The prefetched data are converted to local format when the bucket is
+// actually needed, so the callback functions are only called by the thread
+// using the BucketCache object. Prefetching can only be done for ordinary
+// files; it is ignored for files in a MultiFileBase.
 // </synopsis> 
 
 // <motivation>
@@ -235,6 +260,7 @@ public:
     // By default the entire cache is flushed.
     // When the entire cache is flushed, possible remaining uninitialized
     // buckets will be initialized first.
+    // Dirty buckets adjacent in the file are written with a single write.
     // A True status is returned when buckets had to be written.
     Bool flush (uInt fromSlot = 0);
 
@@ -256,12 +282,42 @@ public:
     // the new sizes.
     void resync (uInt nrBucket, uInt nrOfFreeBucket, Int firstFreeBucket);
 
+    // Let the owner read and write the buckets using the given callback
+    // functions instead of reading and writing them at fixed offsets in
+    // the file. It can be used for buckets having a variable length in the
+    // file (e.g. compressed buckets). All buckets are regarded to be
+    // present in the file, so ReadBucket also has to fill a bucket not
+    // written yet. The ToLocal, FromLocal and AddBuffer callback functions
+    // are not used anymore, nor can buckets be added, removed or prefetched.
+    void setBucketIO (BucketCacheReadBucket readBucket,
+                      BucketCacheWriteBucket writeBucket);
+
+    // Set the maximum number of buckets to read ahead in a background
+    // thread when a sequential or strided access pattern is detected.
+    // A value of 0 (the default) switches prefetching off.
+    // It is ignored if the file does not support reading in another thread.
+    void setPrefetch (uInt nrBuckets);
+
+    // Get the maximum number of buckets to read ahead (0 = no prefetching).
+    uInt prefetch() const;
+
+    // Discard all prefetched buckets and wait until an outstanding read
+    // has finished. It should be done before the file gets reopened.
+    void clearPrefetch();
+
     // Get the current nr of buckets in the file.
     uInt nBucket() const;
 
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
+    // Get the nr of buckets actually present in the file. It excludes
+    // the buckets added by <src>extend</src> not initialized yet.
+    uInt nBucketInFile() const;
+
+    // Test if the given bucket is in the cache.
+    Bool isCached (uInt bucketNr) const;
+
     // Set the dirty bit for the current bucket.
     void setDirty();
 
@@ -274,6 +330,18 @@ public:
     // A pointer to the data in converted format is returned.
     char* getBucket (uInt bucketNr);
 
+    // Make the given bucket current like <src>getBucket</src>, but use
+    // the given data (already read and converted to local format) instead
+    // of reading the bucket if it is not in the cache yet.
+    // It makes it possible to read and convert buckets in parallel
+    // (e.g. in multiple threads) while keeping the cache administration
+    // and statistics the same as with <src>getBucket</src>.
+    // The buffer must have been allocated on the heap; the cache takes it
+    // over. It is deleted using the DeleteBuffer callback function if the
+    // bucket is already in the cache.
+    // The bucket must exist in the file (see <src>nBucketInFile</src>).
+    void adoptBucket (uInt bucketNr, char* data);
+
     // Extend the file with the given number of buckets.
     // The buckets get initialized when they are acquired
     // (using getBucket) for the first time.
@@ -330,6 +398,9 @@ private:
     BucketCacheAddBuffer its_InitCallBack;
     // The delete callback function.
     BucketCacheDeleteBuffer its_DeleteCallBack;
+    // The optional callback functions reading and writing a bucket.
+    BucketCacheReadBucket  its_ReadBucket;
+    BucketCacheWriteBucket its_WriteBucket;
     // The starting offsets of the buckets in the file.
     Int64    its_StartOffset;
     // The bucket size.
@@ -362,6 +433,8 @@ private:
     uInt its_NrOfFree;
     // The first free bucket (-1 = no free buckets).
     Int  its_FirstFree;
+    // The optional object reading buckets ahead.
+    std::unique_ptr<BucketPrefetcher> its_Prefetcher;
     // The statistics.
     uInt naccess_p;
     uInt nread_p;
@@ -384,9 +457,18 @@ private:
     // Write a bucket.
     void writeBucket (uInt slotNr);
 
+    // Write the buckets in the given slots, which must be in order of
+    // bucket number. Consecutive buckets are written with a single write.
+    void writeBuckets (const std::vector<uInt>& slots);
+
     // Read a bucket.
+    // A bucket read ahead by the prefetcher is used if available.
     void readBucket (uInt slotNr);
 
+    // Register the access of a bucket in the prefetcher and request
+    // to read the next buckets if an access pattern is detected.
+    void readAhead (uInt bucketNr);
+
     // Initialize the bucket buffer.
     // The uninitialized buckets before this bucket are also initialized.
     // It returns a pointer to the buffer.
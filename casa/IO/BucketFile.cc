@@ -215,6 +215,14 @@ void BucketFile::seek (Int64 offset)
     file_p->seek (offset, ByteIO::Begin);
 }
 
+std::shared_ptr<ByteIO> BucketFile::preadFile() const
+{
+    if (mfile_p) {
+        return std::shared_ptr<ByteIO>();
+    }
+    return file_p;
+}
+
 Int64 BucketFile::fileSize () const
 {
     // If a buffered file is used, seek in there. Otherwise its internal
@@ -179,6 +179,12 @@ public:
     void seek (Int offset);
     // </group>
 
+    // Get the unbuffered file object if it can safely be read using
+    // <src>ByteIO::pread</src> from another thread (i.e. if it is an
+    // ordinary file). Otherwise a null pointer is returned.
+    // It is used by BucketCache to read buckets ahead.
+    std::shared_ptr<ByteIO> preadFile() const;
+
     // Get the (physical) size of the file.
     // This is doing a seek and sets the file pointer to end-of-file.
     virtual Int64 fileSize() const;
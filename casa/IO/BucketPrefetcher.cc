@@ -0,0 +1,270 @@
+//# BucketPrefetcher.cc: Read buckets ahead in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/casa/IO/BucketPrefetcher.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The number of streams tracked simultaneously.
+static const uInt theNrStreams = 8;
+// The number of recently accessed buckets used to find new streams.
+static const uInt theHistorySize = 16;
+
+
+BucketPrefetcher::BucketPrefetcher (uInt bucketSize, uInt maxBuckets)
+: itsBucketSize (bucketSize),
+  itsMaxBuckets (std::max (maxBuckets, 1u)),
+  itsLRUCounter (0),
+  itsReading    (-1),
+  itsDiscard    (False),
+  itsStop       (False),
+  nrequest_p    (0),
+  nhit_p        (0)
+{
+  itsStreams.reserve (theNrStreams);
+  itsThread = std::thread (&BucketPrefetcher::run, this);
+}
+
+BucketPrefetcher::~BucketPrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsStop = True;
+    itsQueue.clear();
+  }
+  itsWakeup.notify_all();
+  itsThread.join();
+}
+
+Int64 BucketPrefetcher::access (uInt bucketNr)
+{
+  Int64 bnr = bucketNr;
+  itsLRUCounter++;
+  // A repeated access of the last bucket of a stream does not change it.
+  for (Stream& s : itsStreams) {
+    if (s.last == bnr) {
+      s.lru = itsLRUCounter;
+      return 0;
+    }
+  }
+  // Continue a stream if possible.
+  for (Stream& s : itsStreams) {
+    if (bnr - s.last == s.stride) {
+      s.last = bnr;
+      s.lru = itsLRUCounter;
+      return s.stride;
+    }
+  }
+  // Try to find a new stream in the recently accessed buckets.
+  // It is found if the bucket and two recent ones have a constant stride.
+  Int64 stride = 0;
+  for (auto iter=itsHistory.rbegin(); iter!=itsHistory.rend(); ++iter) {
+    Int64 diff = bnr - *iter;
+    if (diff != 0  &&  std::find (itsHistory.begin(), itsHistory.end(),
+                                  *iter - diff) != itsHistory.end()) {
+      stride = diff;
+      break;
+    }
+  }
+  if (stride != 0) {
+    // Add the stream, possibly replacing the least recently used one.
+    Stream news = {bnr, stride, itsLRUCounter};
+    if (itsStreams.size() < theNrStreams) {
+      itsStreams.push_back (news);
+    } else {
+      *std::min_element (itsStreams.begin(), itsStreams.end(),
+                         [](const Stream& s1, const Stream& s2)
+                         { return s1.lru < s2.lru; }) = news;
+    }
+  }
+  if (itsHistory.size() == theHistorySize) {
+    itsHistory.pop_front();
+  }
+  itsHistory.push_back (bnr);
+  return stride;
+}
+
+void BucketPrefetcher::request (const std::shared_ptr<ByteIO>& file,
+                                uInt bucketNr, Int64 offset)
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    if (itsReading == Int64(bucketNr)  ||  itsQueue.size() >= itsMaxBuckets
+    ||  itsBuckets.find(bucketNr) != itsBuckets.end()) {
+      return;
+    }
+    for (const Request& req : itsQueue) {
+      if (req.bucketNr == bucketNr) {
+        return;
+      }
+    }
+    itsQueue.push_back (Request{bucketNr, offset, file});
+    nrequest_p++;
+  }
+  itsWakeup.notify_one();
+}
+
+Bool BucketPrefetcher::take (uInt bucketNr, char* buffer)
+{
+  std::unique_lock<std::mutex> lock(itsMutex);
+  waitForRead (lock, bucketNr);
+  auto iter = itsBuckets.find (bucketNr);
+  if (iter == itsBuckets.end()) {
+    // Not needed anymore; the cache reads it itself.
+    removeRequest (bucketNr);
+    return False;
+  }
+  memcpy (buffer, iter->second.data(), itsBucketSize);
+  itsFree.push_back (std::move(iter->second));
+  itsBuckets.erase (iter);
+  itsOrder.erase (std::find (itsOrder.begin(), itsOrder.end(), bucketNr));
+  nhit_p++;
+  return True;
+}
+
+void BucketPrefetcher::invalidate (uInt bucketNr)
+{
+  std::unique_lock<std::mutex> lock(itsMutex);
+  removeRequest (bucketNr);
+  if (itsReading == Int64(bucketNr)) {
+    itsDiscard = True;
+    waitForRead (lock, bucketNr);
+  }
+  auto iter = itsBuckets.find (bucketNr);
+  if (iter != itsBuckets.end()) {
+    itsFree.push_back (std::move(iter->second));
+    itsBuckets.erase (iter);
+    itsOrder.erase (std::find (itsOrder.begin(), itsOrder.end(), bucketNr));
+  }
+}
+
+void BucketPrefetcher::clear()
+{
+  std::unique_lock<std::mutex> lock(itsMutex);
+  itsQueue.clear();
+  if (itsReading >= 0) {
+    itsDiscard = True;
+    itsReadDone.wait (lock, [this]{ return itsReading < 0; });
+  }
+  itsBuckets.clear();
+  itsOrder.clear();
+}
+
+void BucketPrefetcher::waitForRead (std::unique_lock<std::mutex>& lock,
+                                    uInt bucketNr)
+{
+  itsReadDone.wait (lock, [this, bucketNr]
+                    { return itsReading != Int64(bucketNr); });
+}
+
+void BucketPrefetcher::removeRequest (uInt bucketNr)
+{
+  for (auto iter=itsQueue.begin(); iter!=itsQueue.end(); ++iter) {
+    if (iter->bucketNr == bucketNr) {
+      itsQueue.erase (iter);
+      break;
+    }
+  }
+}
+
+std::vector<char> BucketPrefetcher::getBuffer()
+{
+  if (itsFree.empty()) {
+    return std::vector<char>(itsBucketSize);
+  }
+  std::vector<char> buf (std::move(itsFree.back()));
+  itsFree.pop_back();
+  return buf;
+}
+
+void BucketPrefetcher::run()
+{
+  std::unique_lock<std::mutex> lock(itsMutex);
+  while (True) {
+    itsWakeup.wait (lock, [this]{ return itsStop || !itsQueue.empty(); });
+    if (itsStop) {
+      break;
+    }
+    Request req (std::move(itsQueue.front()));
+    itsQueue.pop_front();
+    itsReading = req.bucketNr;
+    itsDiscard = False;
+    std::vector<char> buf (getBuffer());
+    lock.unlock();
+    // Read errors are ignored; the cache will read the bucket itself
+    // and report the error.
+    Bool ok = True;
+    try {
+      req.file->pread (itsBucketSize, req.offset, buf.data());
+    } catch (std::exception&) {
+      ok = False;
+    }
+    req.file.reset();
+    lock.lock();
+    if (ok  &&  !itsDiscard) {
+      // Discard the oldest bucket if the maximum is reached.
+      if (itsBuckets.size() >= itsMaxBuckets) {
+        auto iter = itsBuckets.find (itsOrder.front());
+        itsFree.push_back (std::move(iter->second));
+        itsBuckets.erase (iter);
+        itsOrder.pop_front();
+      }
+      itsBuckets[req.bucketNr] = std::move(buf);
+      itsOrder.push_back (req.bucketNr);
+    } else {
+      itsFree.push_back (std::move(buf));
+    }
+    if (itsFree.size() > itsMaxBuckets) {
+      itsFree.resize (itsMaxBuckets);
+    }
+    itsReading = -1;
+    itsReadDone.notify_all();
+  }
+}
+
+void BucketPrefetcher::initStatistics()
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  nrequest_p = 0;
+  nhit_p     = 0;
+}
+
+void BucketPrefetcher::showStatistics (ostream& os) const
+{
+  os << "#prefetch: " << nrequest_p << "  (max " << itsMaxBuckets
+     << " ahead)" << endl;
+  if (nrequest_p > 0) {
+    os << "#prefetch hits: " << nhit_p << endl;
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,195 @@
+//# BucketPrefetcher.h: Read buckets ahead in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_BUCKETPREFETCHER_H
+#define CASA_BUCKETPREFETCHER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/ByteIO.h>
+#include <casacore/casa/iosfwd.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Read buckets ahead in a background thread
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tBucketCache">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+// </prerequisite>
+
+// <synopsis>
+// BucketPrefetcher is a helper class for BucketCache. It detects
+// sequential or strided access patterns in the bucket numbers requested
+// from the cache and reads the next buckets of such a pattern in a
+// background thread, so the data is already in memory when the cache asks
+// for it.
+// <p>
+// Access patterns are detected per stream. A stream is a series of bucket
+// numbers with a constant (possibly negative) stride. A new stream is
+// found when the accessed bucket and two of the recently accessed buckets
+// have a constant stride. A few streams are tracked simultaneously, so
+// interleaved access of the buckets of multiple columns in the same file
+// is recognized as well. When a bucket continues a stream,
+// function <src>access</src> returns its stride and the cache can request
+// the next buckets.
+// <p>
+// The background thread only reads the raw (canonical) data using
+// <src>ByteIO::pread</src>; the conversion to local format is done by the
+// cache when the bucket is actually used. In this way the conversion
+// callbacks of the cache never get called in another thread.
+// Note that only ordinary files support a thread-safe pread.
+// <p>
+// The number of buckets held by the prefetcher is limited. If exceeded,
+// the oldest prefetched bucket is discarded.
+// A bucket written or removed by the cache must be invalidated, so a stale
+// prefetched copy is never used.
+// </synopsis>
+
+// <motivation>
+// Scanning a column of a large table on a high-latency file system
+// stalls on each bucket read. Reading ahead hides most of that latency.
+// </motivation>
+
+class BucketPrefetcher
+{
+public:
+    // Create the prefetcher for buckets of the given size.
+    // At most <src>maxBuckets</src> buckets are read ahead.
+    BucketPrefetcher (uInt bucketSize, uInt maxBuckets);
+
+    // The destructor discards all outstanding requests and stops the thread.
+    ~BucketPrefetcher();
+
+    // Forbid copy constructor and assignment.
+    // <group>
+    BucketPrefetcher (const BucketPrefetcher&) = delete;
+    BucketPrefetcher& operator= (const BucketPrefetcher&) = delete;
+    // </group>
+
+    // Get the maximum number of buckets to read ahead.
+    uInt maxBuckets() const
+      { return itsMaxBuckets; }
+
+    // Register an access of the given bucket and update the streams.
+    // It returns the stride of the stream the bucket belongs to,
+    // or 0 if it is not part of a stream.
+    Int64 access (uInt bucketNr);
+
+    // Request to read the bucket at the given file offset.
+    // Nothing is done if the bucket is already requested or read.
+    void request (const std::shared_ptr<ByteIO>& file,
+                  uInt bucketNr, Int64 offset);
+
+    // Copy the data of a prefetched bucket into the given buffer.
+    // If the bucket is being read, it waits until the read has finished.
+    // False is returned if the bucket was not prefetched; a pending request
+    // for it is cancelled.
+    Bool take (uInt bucketNr, char* buffer);
+
+    // Discard the bucket (e.g. because it is written).
+    // If it is being read, it waits until the read has finished.
+    void invalidate (uInt bucketNr);
+
+    // Discard all buckets and requests and wait for an outstanding read.
+    void clear();
+
+    // (Re)initialize the statistics.
+    void initStatistics();
+
+    // Show the statistics.
+    void showStatistics (ostream& os) const;
+
+private:
+    // A stream of bucket numbers with a constant stride.
+    struct Stream {
+      Int64 last;
+      Int64 stride;
+      uInt  lru;
+    };
+    // A request to read a bucket.
+    struct Request {
+      uInt bucketNr;
+      Int64 offset;
+      std::shared_ptr<ByteIO> file;
+    };
+
+    // The function executed by the background thread.
+    void run();
+
+    // Wait until the given bucket is not read anymore.
+    // The mutex must be locked by the caller.
+    void waitForRead (std::unique_lock<std::mutex>& lock, uInt bucketNr);
+
+    // Remove a bucket from the request queue. The mutex must be locked.
+    void removeRequest (uInt bucketNr);
+
+    // Get a buffer from the free list or allocate a new one.
+    // The mutex must be locked.
+    std::vector<char> getBuffer();
+
+    //# Data members.
+    uInt itsBucketSize;
+    uInt itsMaxBuckets;
+    // The streams (only accessed by the owning thread).
+    std::vector<Stream> itsStreams;
+    std::deque<Int64> itsHistory;
+    uInt itsLRUCounter;
+    // The requests, prefetched buckets and buffers (guarded by the mutex).
+    std::deque<Request> itsQueue;
+    std::map<uInt, std::vector<char>> itsBuckets;
+    std::deque<uInt> itsOrder;
+    std::vector<std::vector<char>> itsFree;
+    Int64 itsReading;        // bucket being read (-1 = none)
+    Bool  itsDiscard;        // discard the bucket being read?
+    Bool  itsStop;
+    // The statistics.
+    uInt  nrequest_p;
+    uInt  nhit_p;
+    std::mutex itsMutex;
+    std::condition_variable itsWakeup;
+    std::condition_variable itsReadDone;
+    std::thread itsThread;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
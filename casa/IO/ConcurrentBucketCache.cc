@@ -0,0 +1,168 @@
+//# ConcurrentBucketCache.cc: Thread-safe read-only cache for buckets in a file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/casa/IO/ConcurrentBucketCache.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+ConcurrentBucketCache::ConcurrentBucketCache (BucketFile* file,
+                                              Int64 startOffset,
+                                              uInt bucketSize,
+                                              uInt nrOfBuckets,
+                                              uInt cacheSize,
+                                              uInt nrShards,
+                                              void* ownerObject,
+                                              BucketCacheToLocal readCallBack,
+                                              BucketCacheDeleteBuffer deleteCallBack)
+: itsFile           (file),
+  itsOwner          (ownerObject),
+  itsReadCallBack   (readCallBack),
+  itsDeleteCallBack (deleteCallBack),
+  itsStartOffset    (startOffset),
+  itsBucketSize     (bucketSize),
+  itsNrOfBuckets    (nrOfBuckets),
+  itsCacheSize      (std::max (cacheSize, 1u)),
+  naccess_p         (0),
+  nread_p           (0)
+{
+  if (bucketSize == 0) {
+    throw AipsError ("ConcurrentBucketCache: bucketsize=0");
+  }
+  // Use at least one shard and at least one bucket per shard.
+  nrShards = std::max (std::min (nrShards, itsCacheSize), 1u);
+  itsShardSize = (itsCacheSize + nrShards - 1) / nrShards;
+  itsShards.reserve (nrShards);
+  for (uInt i=0; i<nrShards; ++i) {
+    itsShards.push_back (std::unique_ptr<Shard>(new Shard()));
+  }
+  itsFile->open();
+}
+
+ConcurrentBucketCache::~ConcurrentBucketCache()
+{
+  clear();
+}
+
+ConcurrentBucketCache::PinnedBucket
+ConcurrentBucketCache::getBucket (uInt bucketNr)
+{
+  if (bucketNr >= itsNrOfBuckets) {
+    throw indexError<Int> (bucketNr);
+  }
+  naccess_p++;
+  Shard& shard = *itsShards[bucketNr % itsShards.size()];
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.buckets.find (bucketNr);
+    if (iter != shard.buckets.end()) {
+      iter->second.lru = ++shard.lruCounter;
+      return iter->second.data;
+    }
+  }
+  // Read the bucket without holding the lock, so other threads can
+  // use the shard meanwhile.
+  PinnedBucket data = readBucket (bucketNr);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  // Another thread might have read the bucket in the meantime.
+  auto iter = shard.buckets.find (bucketNr);
+  if (iter != shard.buckets.end()) {
+    iter->second.lru = ++shard.lruCounter;
+    return iter->second.data;
+  }
+  // Remove the least recently used bucket if the shard is full.
+  if (shard.buckets.size() >= itsShardSize) {
+    auto oldest = std::min_element (shard.buckets.begin(),
+                                    shard.buckets.end(),
+                                    [](const std::pair<const uInt,Entry>& e1,
+                                       const std::pair<const uInt,Entry>& e2)
+                                    { return e1.second.lru < e2.second.lru; });
+    shard.buckets.erase (oldest);
+  }
+  shard.buckets[bucketNr] = Entry{data, ++shard.lruCounter};
+  return data;
+}
+
+ConcurrentBucketCache::PinnedBucket
+ConcurrentBucketCache::readBucket (uInt bucketNr)
+{
+  std::vector<char> buffer(itsBucketSize);
+  Int64 offset = itsStartOffset + Int64(bucketNr) * itsBucketSize;
+  std::shared_ptr<ByteIO> file = itsFile->preadFile();
+  if (file) {
+    file->pread (itsBucketSize, offset, buffer.data());
+  } else {
+    std::lock_guard<std::mutex> lock(itsFileMutex);
+    itsFile->seek (offset);
+    itsFile->read (buffer.data(), itsBucketSize);
+  }
+  nread_p++;
+  void* owner = itsOwner;
+  BucketCacheDeleteBuffer deleteCallBack = itsDeleteCallBack;
+  return PinnedBucket (itsReadCallBack (itsOwner, buffer.data()),
+                       [owner, deleteCallBack] (const char* ptr)
+                       { deleteCallBack (owner, const_cast<char*>(ptr)); });
+}
+
+void ConcurrentBucketCache::clear()
+{
+  for (std::unique_ptr<Shard>& shard : itsShards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->buckets.clear();
+    shard->lruCounter = 0;
+  }
+}
+
+void ConcurrentBucketCache::initStatistics()
+{
+  naccess_p = 0;
+  nread_p   = 0;
+}
+
+void ConcurrentBucketCache::showStatistics (ostream& os) const
+{
+  os << "cacheSize: " << itsCacheSize << " (*" << itsBucketSize
+     << ") in " << itsShards.size() << " shards" << endl;
+  os << "#buckets:  " << itsNrOfBuckets << endl;
+  uInt64 nacc  = naccess_p;
+  uInt64 nread = nread_p;
+  if (nread > 0) {
+    os << "#reads:    " << nread << endl;
+  }
+  os << "#accesses: " << nacc;
+  if (nacc > 0) {
+    os << "        hit-rate:  "
+       << 100 * float(nacc - std::min(nacc, nread)) / float(nacc) << "%";
+  }
+  os << endl;
+}
+
+
+} //# NAMESPACE CASACORE - END
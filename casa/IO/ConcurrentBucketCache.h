@@ -0,0 +1,192 @@
+//# ConcurrentBucketCache.h: Thread-safe read-only cache for buckets in a file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_CONCURRENTBUCKETCACHE_H
+#define CASA_CONCURRENTBUCKETCACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/iosfwd.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Thread-safe read-only cache for buckets in a part of a file
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tConcurrentBucketCache">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+//   <li> <linkto class=BucketFile>BucketFile</linkto>
+// </prerequisite>
+
+// <synopsis>
+// ConcurrentBucketCache is a cache for buckets in (a part of) a file
+// like <linkto class=BucketCache>BucketCache</linkto>, but it can be used
+// by multiple threads at the same time. It only supports reading, so it
+// can only be used for a file that is not changed while the cache is used.
+// <p>
+// The cache is divided into shards. A bucket is kept in the shard given
+// by its bucket number modulo the number of shards. Each shard has its own
+// lock and least recently used administration, so threads accessing
+// different buckets hardly ever wait for each other.
+// <br>
+// <src>getBucket</src> returns the bucket as a shared pointer, which
+// pins the bucket in memory. A bucket removed from the cache while it is
+// still used by another thread is deleted when it is not pinned anymore.
+// Thus the data of a pinned bucket always stay valid.
+// <p>
+// As in BucketCache, callback functions are used to convert the data to
+// local format and to delete the buffers. Note that the ToLocal callback
+// can be called by several threads simultaneously, so it must be
+// thread-safe. The owner object must outlive all pinned buckets.
+// <br>
+// A bucket is read using <src>ByteIO::pread</src> if the file supports
+// reading from multiple threads (i.e. if it is an ordinary file).
+// Otherwise the reads of the file are serialized.
+// If two threads miss the same bucket at the same time, both read it,
+// but only one copy gets cached.
+// </synopsis>
+
+// <motivation>
+// Multiple threads reading different parts of a column of the same table
+// could only do so by opening the table multiple times, each time with its
+// own cache. This class makes it possible to share the bucket data.
+// </motivation>
+
+// <example>
+// <srcblock>
+//  // Open the file and create the cache with 64 buckets in 8 shards.
+//  BucketFile file("file.name", False);
+//  file.open();
+//  ConcurrentBucketCache cache (&file, 512, 32768, 1000, 64, 8, 0,
+//                               bToLocal, bDeleteBuffer);
+//  // The following can be done in parallel.
+//  ConcurrentBucketCache::PinnedBucket bucket = cache.getBucket(10);
+//  const char* data = bucket.get();
+// </srcblock>
+// </example>
+
+class ConcurrentBucketCache
+{
+public:
+    // A pinned bucket. The bucket data stay valid while it exists.
+    typedef std::shared_ptr<const char> PinnedBucket;
+
+    // Create the cache for (a part of) a file.
+    // The file part used starts at startOffset. Its length is
+    // bucketSize*nrOfBuckets bytes.
+    // The cache can contain cacheSize buckets, divided over nrShards shards.
+    ConcurrentBucketCache (BucketFile* file, Int64 startOffset,
+                           uInt bucketSize, uInt nrOfBuckets,
+                           uInt cacheSize, uInt nrShards,
+                           void* ownerObject,
+                           BucketCacheToLocal readCallBack,
+                           BucketCacheDeleteBuffer deleteCallBack);
+
+    ~ConcurrentBucketCache();
+
+    // Forbid copy constructor and assignment.
+    // <group>
+    ConcurrentBucketCache (const ConcurrentBucketCache&) = delete;
+    ConcurrentBucketCache& operator= (const ConcurrentBucketCache&) = delete;
+    // </group>
+
+    // Get the nr of buckets in the file part.
+    uInt nBucket() const
+      { return itsNrOfBuckets; }
+
+    // Get the cache size (in buckets).
+    uInt cacheSize() const
+      { return itsCacheSize; }
+
+    // Get the number of shards.
+    uInt nShard() const
+      { return itsShards.size(); }
+
+    // Get a bucket and pin it. It is read if not in the cache yet.
+    // The data in the bucket are in local format.
+    PinnedBucket getBucket (uInt bucketNr);
+
+    // Remove all buckets from the cache.
+    // Buckets still pinned are deleted when not used anymore.
+    void clear();
+
+    // (Re)initialize the cache statistics.
+    void initStatistics();
+
+    // Show the statistics.
+    void showStatistics (ostream& os) const;
+
+private:
+    // A bucket in the cache.
+    struct Entry {
+      PinnedBucket data;
+      uInt64       lru;
+    };
+    // A shard of the cache.
+    struct Shard {
+      std::mutex mutex;
+      std::unordered_map<uInt, Entry> buckets;
+      uInt64 lruCounter = 0;
+    };
+
+    // Read a bucket and convert it to local format.
+    PinnedBucket readBucket (uInt bucketNr);
+
+    //# Data members.
+    BucketFile*             itsFile;
+    void*                   itsOwner;
+    BucketCacheToLocal      itsReadCallBack;
+    BucketCacheDeleteBuffer itsDeleteCallBack;
+    Int64                   itsStartOffset;
+    uInt                    itsBucketSize;
+    uInt                    itsNrOfBuckets;
+    uInt                    itsCacheSize;
+    uInt                    itsShardSize;
+    std::vector<std::unique_ptr<Shard>> itsShards;
+    // Mutex to serialize reads if the file does not support pread.
+    std::mutex              itsFileMutex;
+    // The statistics.
+    std::atomic<uInt64>     naccess_p;
+    std::atomic<uInt64>     nread_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
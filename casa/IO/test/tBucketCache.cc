@@ -26,6 +26,7 @@
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/OS/Timer.h>
 #include <casacore/casa/iostream.h>
 
@@ -38,6 +39,7 @@ void a (Bool);
 void b (Bool);
 void c (uInt bufSize);
 void d (uInt bufSize);
+void e();
 
 int main (int argc, const char*[])
 {
@@ -52,6 +54,7 @@ int main (int argc, const char*[])
 //	d (1024);
 //	d (32768);
 //	d (327680);
+	e();
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
 	return 1;
@@ -254,3 +257,47 @@ void d (uInt)
     timer.show();
     cout << "<<<" << endl;
 }
+
+void e()
+{
+    // Open the file and read it with prefetching.
+    BucketFile file("tBucketCache_tmp.data", False);
+    file.open();
+    Int i;
+    Int rec[128];
+    file.read ((char*)rec, 512);
+    BucketCache cache (&file, 512, 32768, rec[0], 10, 0, aToLocal, aFromLocal,
+		       aInitBuffer, aDeleteBuffer);
+    cache.setPrefetch (4);
+    AlwaysAssertExit (cache.prefetch() == 4);
+    // Read sequentially.
+    for (i=0; i<100; i++) {
+	char* buf = cache.getBucket(i+5);
+	if (*(Int*)buf != i+1  ||  *(Int*)(buf+32760) != i+10) {
+	    cout << "Error in prefetched bucket " << i+5 << endl;
+	}
+    }
+    // Read backwards with stride 3.
+    cache.clear();
+    for (i=99; i>=0; i-=3) {
+	char* buf = cache.getBucket(i+5);
+	if (*(Int*)buf != i+1  ||  *(Int*)(buf+32760) != i+10) {
+	    cout << "Error in prefetched bucket " << i+5 << endl;
+	}
+    }
+    // Read two interleaved streams.
+    cache.clear();
+    for (i=0; i<50; i++) {
+	char* buf = cache.getBucket(i+5);
+	if (*(Int*)buf != i+1  ||  *(Int*)(buf+32760) != i+10) {
+	    cout << "Error in prefetched bucket " << i+5 << endl;
+	}
+	buf = cache.getBucket(i+55);
+	if (*(Int*)buf != i+51  ||  *(Int*)(buf+32760) != i+60) {
+	    cout << "Error in prefetched bucket " << i+55 << endl;
+	}
+    }
+    cache.setPrefetch (0);
+    AlwaysAssertExit (cache.prefetch() == 0);
+    cout << "checked prefetching of " << cache.nBucket() << " buckets" << endl;
+}
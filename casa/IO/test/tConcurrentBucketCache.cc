@@ -0,0 +1,159 @@
+//# tConcurrentBucketCache.cc: Test program for the ConcurrentBucketCache class
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/IO/ConcurrentBucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the ConcurrentBucketCache class
+// </summary>
+
+const uInt bucketSize = 1024;
+const uInt nrBucket = 100;
+
+static std::atomic<Int> nrAlloc(0);
+
+char* toLocal (void*, const char* data)
+{
+    char* ptr = new char[bucketSize];
+    memcpy (ptr, data, bucketSize);
+    nrAlloc++;
+    return ptr;
+}
+void deleteBuffer (void*, char* buffer)
+{
+    delete [] buffer;
+    nrAlloc--;
+}
+
+// Write a file where each bucket is filled with its bucket number.
+void makeFile()
+{
+    BucketFile file ("tConcurrentBucketCache_tmp.data");
+    file.open();
+    std::vector<Int> buf(bucketSize/sizeof(Int));
+    file.write (buf.data(), 512);
+    for (uInt i=0; i<nrBucket; i++) {
+        for (Int& v : buf) {
+            v = i;
+        }
+        file.write (buf.data(), bucketSize);
+    }
+}
+
+Bool checkBucket (const ConcurrentBucketCache::PinnedBucket& bucket, Int nr)
+{
+    const Int* data = reinterpret_cast<const Int*>(bucket.get());
+    for (uInt i=0; i<bucketSize/sizeof(Int); i++) {
+        if (data[i] != nr) {
+            return False;
+        }
+    }
+    return True;
+}
+
+void testSerial()
+{
+    BucketFile file("tConcurrentBucketCache_tmp.data", False);
+    ConcurrentBucketCache cache (&file, 512, bucketSize, nrBucket, 8, 4, 0,
+                                 toLocal, deleteBuffer);
+    AlwaysAssertExit (cache.nBucket() == nrBucket);
+    AlwaysAssertExit (cache.cacheSize() == 8);
+    AlwaysAssertExit (cache.nShard() == 4);
+    // A pinned bucket stays valid after being removed from the cache.
+    ConcurrentBucketCache::PinnedBucket pinned = cache.getBucket(5);
+    for (uInt i=0; i<nrBucket; i++) {
+        AlwaysAssertExit (checkBucket (cache.getBucket(i), i));
+    }
+    AlwaysAssertExit (checkBucket (pinned, 5));
+    AlwaysAssertExit (nrAlloc <= 8+1);
+    cache.clear();
+    AlwaysAssertExit (nrAlloc == 1);
+    AlwaysAssertExit (checkBucket (pinned, 5));
+    pinned.reset();
+    AlwaysAssertExit (nrAlloc == 0);
+    Bool caught = False;
+    try {
+        cache.getBucket (nrBucket);
+    } catch (const std::exception&) {
+        caught = True;
+    }
+    AlwaysAssertExit (caught);
+    cout << "serial access ok" << endl;
+}
+
+void testParallel()
+{
+    BucketFile file("tConcurrentBucketCache_tmp.data", False);
+    ConcurrentBucketCache cache (&file, 512, bucketSize, nrBucket, 16, 4, 0,
+                                 toLocal, deleteBuffer);
+    const uInt nthread = 8;
+    // Not vector<Bool>, whose elements share words.
+    std::vector<char> ok(nthread, True);
+    std::vector<std::thread> threads;
+    for (uInt t=0; t<nthread; t++) {
+        threads.emplace_back ([&cache, &ok, t]() {
+            // Each thread scans the buckets with a different stride.
+            for (uInt iter=0; iter<20; iter++) {
+                for (uInt i=0; i<nrBucket; i++) {
+                    uInt bnr = (i*(t+1) + iter) % nrBucket;
+                    if (! checkBucket (cache.getBucket(bnr), bnr)) {
+                        ok[t] = False;
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& thr : threads) {
+        thr.join();
+    }
+    for (uInt t=0; t<nthread; t++) {
+        AlwaysAssertExit (ok[t]);
+    }
+    AlwaysAssertExit (nrAlloc <= 16);
+    cout << "parallel access ok" << endl;
+}
+
+int main()
+{
+    try {
+        makeFile();
+        testSerial();
+        testParallel();
+        AlwaysAssertExit (nrAlloc == 0);
+    } catch (std::exception& x) {
+        cout << "Caught an exception: " << x.what() << endl;
+        return 1;
+    }
+    return 0;                           // exit with success status
+}
@@ -28,10 +28,18 @@
 #include <assert.h>
 #include <casacore/casa/aips.h>
 #include <casacore/casa/OS/Conversion.h>
+#include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 #ifdef __SSE2__
 #include <emmintrin.h>
 #endif
+//# The byte swap kernels are compiled for SSSE3 and AVX2 and selected
+//# at runtime, so they are also used in portable builds.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CASA_CONVERSION_X86
+#include <immintrin.h>
+#endif
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -522,5 +530,163 @@ size_t Conversion::valueCopy (void* to, const void* from,
 }
 
 
+//# The byte swap kernels.
+//# A vector kernel swaps as many full vectors as possible and returns
+//# the number of bytes done; the remainder is swapped value by value.
+namespace {
+
+#ifdef CASA_CONVERSION_X86
+  // The shuffle masks reversing the bytes of values of 2, 4 and 8 bytes.
+  // They are given for two 128-bit lanes as needed by AVX2.
+  alignas(32) const char byteSwapMask2[32] = {
+    1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14,
+    1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14};
+  alignas(32) const char byteSwapMask4[32] = {
+    3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+    3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12};
+  alignas(32) const char byteSwapMask8[32] = {
+    7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,
+    7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8};
+
+  __attribute__((target("ssse3")))
+  size_t byteSwapSSSE3 (char* to, const char* from, size_t nbytes,
+                        const char* maskPtr)
+  {
+    const __m128i mask = _mm_loadu_si128 ((const __m128i*)maskPtr);
+    size_t i = 0;
+    for (; i+16 <= nbytes; i+=16) {
+      __m128i v = _mm_loadu_si128 ((const __m128i*)(from+i));
+      _mm_storeu_si128 ((__m128i*)(to+i), _mm_shuffle_epi8 (v, mask));
+    }
+    return i;
+  }
+
+  __attribute__((target("avx2")))
+  size_t byteSwapAVX2 (char* to, const char* from, size_t nbytes,
+                       const char* maskPtr)
+  {
+    // The shuffle works per 128-bit lane, so the mask is the same in both.
+    const __m256i mask = _mm256_loadu_si256 ((const __m256i*)maskPtr);
+    size_t i = 0;
+    for (; i+64 <= nbytes; i+=64) {
+      __m256i v0 = _mm256_loadu_si256 ((const __m256i*)(from+i));
+      __m256i v1 = _mm256_loadu_si256 ((const __m256i*)(from+i+32));
+      _mm256_storeu_si256 ((__m256i*)(to+i), _mm256_shuffle_epi8 (v0, mask));
+      _mm256_storeu_si256 ((__m256i*)(to+i+32),
+                           _mm256_shuffle_epi8 (v1, mask));
+    }
+    for (; i+32 <= nbytes; i+=32) {
+      __m256i v = _mm256_loadu_si256 ((const __m256i*)(from+i));
+      _mm256_storeu_si256 ((__m256i*)(to+i), _mm256_shuffle_epi8 (v, mask));
+    }
+    return i;
+  }
+
+  // Determine once which vector kernel can be used (0=none).
+  int byteSwapIsa()
+  {
+    static const int isa = (__builtin_cpu_supports("avx2")  ?  2 :
+                            __builtin_cpu_supports("ssse3") ?  1 : 0);
+    return isa;
+  }
+#endif
+
+  template<size_t SIZE>
+  void byteSwapBlock (char* to, const char* from, size_t nvalues)
+  {
+    size_t nbytes = nvalues * SIZE;
+    size_t i = 0;
+#ifdef CASA_CONVERSION_X86
+    const char* mask = (SIZE == 2 ? byteSwapMask2 :
+                        SIZE == 4 ? byteSwapMask4 : byteSwapMask8);
+    switch (byteSwapIsa()) {
+    case 2:
+      i = byteSwapAVX2 (to, from, nbytes, mask);
+      break;
+    case 1:
+      i = byteSwapSSSE3 (to, from, nbytes, mask);
+      break;
+    }
+#endif
+    for (; i<nbytes; i+=SIZE) {
+      if (SIZE == 2) {
+        CanonicalConversion::reverse2 (to+i, from+i);
+      } else if (SIZE == 4) {
+        CanonicalConversion::reverse4 (to+i, from+i);
+      } else {
+        CanonicalConversion::reverse8 (to+i, from+i);
+      }
+    }
+  }
+
+  // Small buffers (< 1 MiB) are swapped directly to avoid the cost of
+  // entering a parallel region. Larger buffers are swapped in chunks
+  // of 64 KiB which are divided over the threads.
+  template<size_t SIZE>
+  void byteSwapN (void* to, const void* from, size_t nvalues)
+  {
+    char* out = static_cast<char*>(to);
+    const char* in = static_cast<const char*>(from);
+    const size_t chunkValues = 65536 / SIZE;
+    const size_t nchunk = (nvalues + chunkValues - 1) / chunkValues;
+    if (nchunk < 16) {
+      byteSwapBlock<SIZE> (out, in, nvalues);
+      return;
+    }
+#ifdef _OPENMP
+    size_t nthr =
+        std::max((size_t)1,
+                 std::min((size_t)omp_get_max_threads(), nchunk / 8));
+# pragma omp parallel for num_threads(nthr)
+#endif
+    for (size_t i=0; i<nchunk; ++i) {
+      size_t st = i * chunkValues;
+      byteSwapBlock<SIZE> (out + st*SIZE, in + st*SIZE,
+                           std::min(chunkValues, nvalues - st));
+    }
+  }
+
+} //# end anonymous namespace
+
+void Conversion::byteSwap2 (void* to, const void* from, size_t nvalues)
+{
+    byteSwapN<2> (to, from, nvalues);
+}
+
+void Conversion::byteSwap4 (void* to, const void* from, size_t nvalues)
+{
+    byteSwapN<4> (to, from, nvalues);
+}
+
+void Conversion::byteSwap8 (void* to, const void* from, size_t nvalues)
+{
+    byteSwapN<8> (to, from, nvalues);
+}
+
+void Conversion::byteSwap (void* to, const void* from, size_t nvalues,
+                           size_t valueSize)
+{
+    switch (valueSize) {
+    case 1:
+        if (to != from) {
+            memcpy (to, from, nvalues);
+        }
+        break;
+    case 2:
+        byteSwapN<2> (to, from, nvalues);
+        break;
+    case 4:
+        byteSwapN<4> (to, from, nvalues);
+        break;
+    case 8:
+        byteSwapN<8> (to, from, nvalues);
+        break;
+    default:
+        assert (valueSize == 1 || valueSize == 2 ||
+                valueSize == 4 || valueSize == 8);
+    }
+}
+
+
 } //# NAMESPACE CASACORE - END
 
@@ -128,6 +128,24 @@ public:
 			   size_t nvalues);
     // </group>
 
+    // Reverse the bytes of each of <src>nvalues</src> values of 2, 4 or 8
+    // bytes, thus convert between big and little endian.
+    // Byte shuffles (SSSE3 or AVX2) are used if the CPU supports them and
+    // large buffers are divided over multiple threads.
+    // <src>to</src> and <src>from</src> can be the same buffer, but should
+    // not overlap otherwise.
+    // Complex and DComplex values are swapped as 2 floats or doubles
+    // (the conversion framework converts them as such).
+    // <br>The last function dispatches on <src>valueSize</src>
+    // (1, 2, 4 or 8), where size 1 means a plain copy.
+    // <group>
+    static void byteSwap2 (void* to, const void* from, size_t nvalues);
+    static void byteSwap4 (void* to, const void* from, size_t nvalues);
+    static void byteSwap8 (void* to, const void* from, size_t nvalues);
+    static void byteSwap  (void* to, const void* from, size_t nvalues,
+                           size_t valueSize);
+    // </group>
+
     // Copy a value using memcpy.
     // It differs from memcpy in the return value.
     // <note> This version has the <src>ValueFunction</src> signature,
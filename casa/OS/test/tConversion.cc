@@ -26,9 +26,12 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/casa/OS/Conversion.h>
+#include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <vector>
+#include <cstring>
 
 
 #include <casacore/casa/namespace.h>
@@ -68,6 +71,49 @@ void checkAll()
   }
 }
 
+// Check the byte swap kernels against swapping value by value.
+// Use lengths and offsets around the vector and chunk sizes.
+void checkByteSwap (size_t valueSize, size_t nvalues, size_t offset)
+{
+  size_t nbytes = nvalues * valueSize;
+  std::vector<char> in(nbytes+offset), out(nbytes+offset), exp(nbytes);
+  for (size_t i=0; i<nbytes+offset; ++i) {
+    in[i] = char(i*7 + i/251);
+  }
+  const char* from = in.data() + offset;
+  for (size_t i=0; i<nbytes; i+=valueSize) {
+    switch (valueSize) {
+    case 2:
+      CanonicalConversion::reverse2 (&exp[i], from+i);
+      break;
+    case 4:
+      CanonicalConversion::reverse4 (&exp[i], from+i);
+      break;
+    default:
+      CanonicalConversion::reverse8 (&exp[i], from+i);
+    }
+  }
+  Conversion::byteSwap (out.data()+offset, from, nvalues, valueSize);
+  AlwaysAssertExit (memcmp (out.data()+offset, exp.data(), nbytes) == 0);
+  // Check in place.
+  Conversion::byteSwap (in.data()+offset, from, nvalues, valueSize);
+  AlwaysAssertExit (memcmp (in.data()+offset, exp.data(), nbytes) == 0);
+}
+
+void checkByteSwap()
+{
+  cout << "checkByteSwap ..." << endl;
+  size_t sizes[] = {2, 4, 8};
+  size_t nvals[] = {0, 1, 3, 7, 15, 33, 65, 1000, 65537, 1000003};
+  for (size_t sz : sizes) {
+    for (size_t nv : nvals) {
+      for (size_t offset=0; offset<3; ++offset) {
+        checkByteSwap (sz, nv, offset);
+      }
+    }
+  }
+}
+
 int main()
 {
     uInt nbool = 100;
@@ -153,6 +199,7 @@ int main()
     delete [] bits;
 
     checkAll();
+    checkByteSwap();
     cout << "OK" << endl;
     return 0;
 }
@@ -26,9 +26,11 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/casa/OS/Conversion.h>
+#include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/Timer.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <vector>
 
 
 #include <casacore/casa/namespace.h>
@@ -255,9 +257,41 @@ void checkPerf()
   }
 }
 
+// Time the vectorized byte swap against swapping value by value.
+void checkSwapPerf()
+{
+  cout << "checkSwapPerf ..." << endl;
+  const size_t n = 8*1024*1024;
+  std::vector<double> in(n, 1.5), out(n);
+  {
+    Timer timer;
+    for (int i=0; i<10; ++i) {
+      for (size_t j=0; j<n; ++j) {
+        CanonicalConversion::reverse8 (&out[j], &in[j]);
+      }
+    }
+    timer.show("reverse8   ");
+  }
+  {
+    Timer timer;
+    for (int i=0; i<10; ++i) {
+      Conversion::byteSwap8 (out.data(), in.data(), n);
+    }
+    timer.show("byteSwap8  ");
+  }
+  {
+    Timer timer;
+    for (int i=0; i<10; ++i) {
+      Conversion::byteSwap4 (out.data(), in.data(), 2*n);
+    }
+    timer.show("byteSwap4  ");
+  }
+}
+
 int main()
 {
     checkPerf();
+    checkSwapPerf();
     cout << "OK" << endl;
     return 0;
 }
@@ -32,6 +32,7 @@
 ///#include <casacore/casa/Containers/BlockIO.h>
 
 #include <casacore/casa/stdlib.h>                 // for rand
+#include <cstring>
 #ifdef _OPENMP
 # include <omp.h>
 #endif
@@ -153,6 +154,139 @@ uInt64 SortKey::tryGenSort (Vector<uInt64>& indexVector, uInt64 nrrec, int opt)
 
 
 
+// Convert a value to an unsigned integer with the same ascending order.
+// Signed integers get their sign bit flipped. For floating point values
+// all bits are flipped if negative, otherwise only the sign bit, where
+// -0 is made equal to +0 as in ObjCompare.
+inline uInt64 sortRadixValue (Bool v)
+  { return v; }
+inline uInt64 sortRadixValue (Char v)
+  { return uChar(v) ^ 0x80u; }
+inline uInt64 sortRadixValue (uChar v)
+  { return v; }
+inline uInt64 sortRadixValue (Short v)
+  { return uShort(v) ^ 0x8000u; }
+inline uInt64 sortRadixValue (uShort v)
+  { return v; }
+inline uInt64 sortRadixValue (Int v)
+  { return uInt(v) ^ 0x80000000u; }
+inline uInt64 sortRadixValue (uInt v)
+  { return v; }
+inline uInt64 sortRadixValue (Int64 v)
+  { return uInt64(v) ^ (uInt64(1) << 63); }
+inline uInt64 sortRadixValue (Float v)
+{
+  uInt bits = 0;
+  if (v != 0) {
+    memcpy (&bits, &v, sizeof(bits));
+  }
+  return ((bits & 0x80000000u)  ?  ~bits : bits | 0x80000000u);
+}
+inline uInt64 sortRadixValue (Double v)
+{
+  uInt64 bits = 0;
+  if (v != 0) {
+    memcpy (&bits, &v, sizeof(bits));
+  }
+  const uInt64 sign = uInt64(1) << 63;
+  return ((bits & sign)  ?  ~bits : bits | sign);
+}
+
+template<typename V, typename T>
+void fillSortRadixKeys (uInt64* keys, const void* data, uInt incr,
+                        const T* inx, T nrrec, uInt64 flip)
+{
+  const char* dptr = static_cast<const char*>(data);
+#ifdef _OPENMP
+#pragma omp parallel for if (nrrec > 65536)
+#endif
+  for (Int64 i=0; i<Int64(nrrec); ++i) {
+    keys[i] = sortRadixValue (*reinterpret_cast<const V*>(dptr + inx[i]*incr))
+              ^ flip;
+  }
+}
+
+template<typename T>
+void fillSortRadixKeys (DataType dtype, uInt nbytes, int order,
+                        uInt64* keys, const void* data, uInt incr,
+                        const T* inx, T nrrec)
+{
+  // Flip all bits of the key for a descending sort.
+  uInt64 flip = 0;
+  if (order == Sort::Descending) {
+    flip = (nbytes == 8  ?  ~uInt64(0) : (uInt64(1) << (8*nbytes)) - 1);
+  }
+  switch (dtype) {
+  case TpBool:
+    fillSortRadixKeys<Bool> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpChar:
+    fillSortRadixKeys<Char> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpUChar:
+    fillSortRadixKeys<uChar> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpShort:
+    fillSortRadixKeys<Short> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpUShort:
+    fillSortRadixKeys<uShort> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpInt:
+    fillSortRadixKeys<Int> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpUInt:
+    fillSortRadixKeys<uInt> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpInt64:
+    fillSortRadixKeys<Int64> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpFloat:
+    fillSortRadixKeys<Float> (keys, data, incr, inx, nrrec, flip);
+    break;
+  case TpDouble:
+    fillSortRadixKeys<Double> (keys, data, incr, inx, nrrec, flip);
+    break;
+  default:
+    throw SortInvOpt();
+  }
+}
+
+uInt SortKey::radixSize() const
+{
+  DataType dtype = cmpObj_p->dataType();
+  switch (dtype) {
+  case TpBool:
+  case TpChar:
+  case TpUChar:
+  case TpShort:
+  case TpUShort:
+  case TpInt:
+  case TpUInt:
+  case TpInt64:
+  case TpFloat:
+  case TpDouble:
+    return ValType::getTypeSize (dtype);
+  default:
+    break;
+  }
+  return 0;
+}
+
+void SortKey::fillRadixKeys (uInt64* keys, const uInt* inx, uInt nrrec) const
+{
+  fillSortRadixKeys (cmpObj_p->dataType(), radixSize(), order_p,
+                     keys, data_p, incr_p, inx, nrrec);
+}
+
+void SortKey::fillRadixKeys (uInt64* keys, const uInt64* inx,
+                             uInt64 nrrec) const
+{
+  fillSortRadixKeys (cmpObj_p->dataType(), radixSize(), order_p,
+                     keys, data_p, incr_p, inx, nrrec);
+}
+
+
 
 Sort::Sort()
 : nrkey_p (0),
@@ -245,6 +379,17 @@ void Sort::addKey (const void* dat, DataType dt, uInt inc, int ord)
 }
 
 
+Bool Sort::canRadixSort() const
+{
+    for (size_t i=0; i<nrkey_p; i++) {
+        if (keys_p[i]->radixSize() == 0) {
+            return False;
+        }
+    }
+    return True;
+}
+
+
 void Sort::addKey (SortKey* key)
 {
     if (nrkey_p == 0) {
@@ -290,6 +435,13 @@ uInt64 Sort::unique (Vector<uInt64>& uniqueVector,
                      Vector<size_t>& changeKey,
                      const Vector<uInt64>& indexVector) const
   { return doUnique (uniqueVector, changeKey, indexVector); }
+
+Bool Sort::isSorted (uInt64 nrrec) const
+  { return doIsSorted<uInt64> (0, 0, nrrec); }
+
+Bool Sort::isSorted (Vector<uInt64>& uniqueVector,
+                     Vector<size_t>& changeKey, uInt64 nrrec) const
+  { return doIsSorted (&uniqueVector, &changeKey, nrrec); }
     // </group>
 
 } //# NAMESPACE CASACORE - END
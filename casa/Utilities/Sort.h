@@ -78,6 +78,20 @@ public:
     uInt tryGenSort (Vector<uInt>& indexVector, uInt nrrec, int opt) const;
     uInt64 tryGenSort (Vector<uInt64>& indexVector, uInt64 nrrec, int opt) const;
 
+    // Get the number of bytes of the key if it can be used in a radix sort.
+    // That is the case if the standard comparison of a fixed-width numeric
+    // data type (Bool, Char, uChar, Short, uShort, Int, uInt, Int64, Float,
+    // or Double) is used. Otherwise it returns 0.
+    uInt radixSize() const;
+
+    // Fill the keys for a radix sort for the records given in the index.
+    // The keys are unsigned integers having the same order as the values,
+    // taking the sort order into account.
+    // <group>
+    void fillRadixKeys (uInt64* keys, const uInt* inx, uInt nrrec) const;
+    void fillRadixKeys (uInt64* keys, const uInt64* inx, uInt64 nrrec) const;
+    // </group>
+
     // Get the sort order.
     int order() const
       { return order_p; }
@@ -138,6 +152,16 @@ protected:
 //  <DT> <src>Sort::HeapSort</src>
 //  <DD> Heapsort has O(n*log(n)) behaviour. Its speed is lower than
 //       that of QuickSort, so QuickSort is the default algorithm.
+//  <DT> <src>Sort::RadixSort</src>
+//  <DD> A least-significant-digit radix sort has O(n) behaviour and
+//       does not call the comparison objects. It can only be used if all
+//       keys use the standard comparison of a fixed-width numeric data type
+//       (thus no String, Complex, or user-defined compare object), which
+//       covers the usual multi-key sorts of large tables on columns like
+//       TIME, ANTENNA1 and ANTENNA2. It is done in parallel if multiple
+//       threads can be used. It needs 2 extra index arrays and 2 arrays
+//       of 8 bytes per element.
+//       If not all keys can be used, ParSort is done instead.
 // </DL>
 // The default is to use QuickSort for small arrays or if only a single
 // thread can be used. Otherwise ParSort is the default.
@@ -250,7 +274,8 @@ public:
                  InsSort=2,         // use insertion sort algorithm
                  QuickSort=4,       // use Quicksort algorithm
                  ParSort=8,         // use parallel merge sort algorithm
-                 NoDuplicates=16};  // skip data with equal sort keys
+                 NoDuplicates=16,   // skip data with equal sort keys
+                 RadixSort=32};     // use (parallel) radix sort algorithm
 
     // Enumerate the sort order:
     enum Order {Ascending=-1,
@@ -359,6 +384,20 @@ public:
                    const Vector<uInt64>& indexVector) const;
     // </group>
 
+    // Test if the <src>nrrec</src> data records are already in the
+    // requested order. Records with equal keys are in order.
+    // It stops at the first record out of order, so it is cheap if the
+    // data are not in order.
+    // <br>The second version also gives back the index of each first
+    // unique record and the keys changing at the end of each group as
+    // done by <src>unique</src>, so a sort and unique can be skipped
+    // altogether. They are only valid if True is returned.
+    // <group>
+    Bool isSorted (uInt64 nrrec) const;
+    Bool isSorted (Vector<uInt64>& uniqueVector,
+                   Vector<size_t>& changeKey, uInt64 nrrec) const;
+    // </group>
+
 private:
     template<typename T>
     T doSort (Vector<T>& indexVector, T nrrec,
@@ -371,6 +410,9 @@ private:
     template <typename T>
     T doUnique (Vector<T>& uniqueVector, Vector<size_t>& changeKey,
                 const Vector<T>& indexVector) const;
+    template <typename T>
+    Bool doIsSorted (Vector<T>* uniqueVector, Vector<size_t>* changeKey,
+                     T nrrec) const;
 
     // Copy that Sort object to this.
     void copy (const Sort& that);
@@ -409,6 +451,15 @@ private:
     void qkSort (T nr, T* indices) const;
     // </group>
 
+    // Test if all keys can be used in a radix sort.
+    Bool canRadixSort() const;
+
+    // Do a (parallel) LSD radix sort on the keys, least significant first.
+    // Each key is sorted per byte using a stable counting sort, where bytes
+    // that are the same for all records are skipped.
+    template<typename T>
+    T radixSort (int nthr, T nrrec, T* inx) const;
+
     // Do a heapsort, optionally skipping duplicates.
     // <group>
     template<typename T>
@@ -30,6 +30,8 @@
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Utilities/SortError.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <algorithm>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -44,8 +46,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (nrrec == 0) {
       return nrrec;
     }
+    // A radix sort is only possible for fixed-width numeric keys.
+    int nodup = opt & NoDuplicates;
+    int type  = opt - nodup;
+    if (type == RadixSort  &&  !canRadixSort()) {
+      type = ParSort;
+    }
     //# Try if we can use the faster GenSort when we have one key only.
-    if (doTryGenSort  &&  nrkey_p == 1) {
+    if (doTryGenSort  &&  nrkey_p == 1  &&  type != RadixSort) {
       uInt n = keys_p[0]->tryGenSort (indexVector, nrrec, opt);
       if (n > 0) {
         return n;
@@ -57,9 +65,6 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // in there is (much) faster than in a vector.
     Bool del;
     T* inx = indexVector.getStorage (del);
-    // Choose the sort required.
-    int nodup = opt & NoDuplicates;
-    int type  = opt - nodup;
     // Determine default sort to use.
     int nthr = 1;
 #ifdef _OPENMP
@@ -99,6 +104,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         n = insSortNoDup (nrrec, inx);
       }
       break;
+    case RadixSort:
+      n = radixSort (nthr, nrrec, inx);
+      if (nodup) {
+        n = insSortNoDup (nrrec, inx);
+      }
+      break;
     default:
       throw SortInvOpt();
     }
@@ -163,6 +174,41 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return nruniq;
   }
 
+  template<typename T>
+  Bool Sort::doIsSorted (Vector<T>* uniqueVector,
+                         Vector<size_t>* changeKey, T nrrec) const
+  {
+    std::vector<T> uniq;
+    std::vector<size_t> change;
+    if (nrrec > 0) {
+      uniq.push_back (0);
+    }
+    size_t idxComp;
+    for (T i=1; i<nrrec; i++) {
+      // Compare the record with its predecessor (and not vice versa), so
+      // stateful compare objects (such as the interval comparison in
+      // MSIter) see the first record first as in a normal sort.
+      // So 2 means out-of-order and 0 means a change in a key.
+      Int cmp = compareChangeIdx (i, i-1, idxComp);
+      if (cmp == 2) {
+        return False;
+      }
+      if (cmp == 0  &&  uniqueVector) {
+        change.push_back (idxComp);
+        uniq.push_back (i);
+      }
+    }
+    if (uniqueVector) {
+      // The key change of the last group is undefined as in doUnique.
+      change.push_back (0);
+      uniqueVector->resize (uniq.size());
+      std::copy (uniq.begin(), uniq.end(), uniqueVector->begin());
+      changeKey->resize (uniq.size());
+      std::copy (change.begin(), change.end(), changeKey->begin());
+    }
+    return True;
+  }
+
   template<typename T>
   T Sort::parSort (int nthr, T nrrec, T* inx) const
   {
@@ -216,6 +262,88 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return nrrec;
   }  
 
+  template<typename T>
+  T Sort::radixSort (int nthr, T nrrec, T* inx) const
+  {
+    const int nbucket = 256;
+    std::vector<uInt64> keys(nrrec);
+    std::vector<uInt64> keysTmp(nrrec);
+    std::vector<T> inxTmp(nrrec);
+    std::vector<T> count(nthr*nbucket);
+    std::vector<T> tinx(nthr+1);
+    T step = nrrec/nthr;
+    for (int i=0; i<nthr; ++i) tinx[i] = i*step;
+    tinx[nthr] = nrrec;
+    T* cur = inx;
+    T* oth = inxTmp.data();
+    // If all keys are descending, equal keys are in descending index order
+    // (see compare), which is achieved by starting in that order.
+    if (order_p == 1) {
+      std::reverse (inx, inx+nrrec);
+    }
+    // Sort on the least significant key first. Because each pass is
+    // stable, the result is ordered on all keys.
+    for (size_t k=nrkey_p; k>0;) {
+      --k;
+      const SortKey& key = *keys_p[k];
+      key.fillRadixKeys (keys.data(), cur, nrrec);
+      for (uInt byte=0; byte<key.radixSize(); ++byte) {
+        const uInt shift = 8*byte;
+        // Count the digits per thread part.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int t=0; t<nthr; ++t) {
+          T* cnt = count.data() + t*nbucket;
+          std::fill (cnt, cnt+nbucket, T(0));
+          for (T i=tinx[t]; i<tinx[t+1]; ++i) {
+            cnt[(keys[i] >> shift) & 0xff]++;
+          }
+        }
+        // Turn the counts into the start positions per digit and thread,
+        // which keeps the sort stable. Skip the pass if all records
+        // have the same digit.
+        Bool skip = False;
+        T start = 0;
+        for (int d=0; d<nbucket; ++d) {
+          T ndigit = 0;
+          for (int t=0; t<nthr; ++t) {
+            T c = count[t*nbucket + d];
+            count[t*nbucket + d] = start;
+            start += c;
+            ndigit += c;
+          }
+          if (ndigit == nrrec) {
+            skip = True;
+            break;
+          }
+        }
+        if (skip) {
+          continue;
+        }
+        // Move the keys and indices to their new position.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int t=0; t<nthr; ++t) {
+          T* cnt = count.data() + t*nbucket;
+          for (T i=tinx[t]; i<tinx[t+1]; ++i) {
+            T pos = cnt[(keys[i] >> shift) & 0xff]++;
+            keysTmp[pos] = keys[i];
+            oth[pos] = cur[i];
+          }
+        }
+        keys.swap (keysTmp);
+        std::swap (cur, oth);
+      }
+    }
+    // If final result happens to be in incorrect array, copy it over.
+    if (cur != inx) {
+      objcopy (inx, cur, nrrec);
+    }
+    return nrrec;
+  }
+
   template<typename T>
   void Sort::merge (T* inx, T* tmp, T nrrec, T* index,
                     T nparts) const
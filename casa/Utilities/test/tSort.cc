@@ -27,9 +27,11 @@
 
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/stdlib.h>
 #include <casacore/casa/iostream.h>
+#include <vector>
 
 #include <casacore/casa/namespace.h>
 // This program test the class Sort.
@@ -231,6 +233,46 @@ void sortall (int options, Sort::Order order)
     sortdo (options, sort2, order, data, nrdata);
 }
 
+// Test a radix sort on multiple keys of various types against a
+// comparison based sort.
+void sort_test_radix()
+{
+    const uInt nrdata = 100000;
+    std::vector<Double> dtime(nrdata);
+    std::vector<Float>  fval(nrdata);
+    std::vector<Short>  sval(nrdata);
+    std::vector<uChar>  cval(nrdata);
+    std::vector<Int64>  lval(nrdata);
+    for (uInt i=0; i<nrdata; i++) {
+      dtime[i] = 4.5e9 + (rand()%1000) * 0.5;
+      fval[i]  = (rand()%21 - 10) * 0.25;
+      sval[i]  = rand()%11 - 5;
+      cval[i]  = rand()%3;
+      lval[i]  = Int64(rand()%5 - 2) << 40;
+    }
+    // Include some special values.
+    fval[0] = -0.;
+    fval[1] = 0.;
+    dtime[2] = -1e300;
+    for (int ord=0; ord<2; ++ord) {
+      Sort::Order order = (ord==0 ? Sort::Ascending : Sort::Descending);
+      Sort sort;
+      sort.sortKey (dtime.data(), TpDouble, 0, Sort::Ascending);
+      sort.sortKey (fval.data(), TpFloat, 0, order);
+      sort.sortKey (sval.data(), TpShort, 0, order);
+      sort.sortKey (cval.data(), TpUChar, 0, Sort::Descending);
+      sort.sortKey (lval.data(), TpInt64, 0, order);
+      for (int nodup=0; nodup<2; ++nodup) {
+        int opt = (nodup ? Sort::NoDuplicates : 0);
+        Vector<uInt64> inx1, inx2;
+        uInt64 nr1 = sort.sort (inx1, uInt64(nrdata), Sort::ParSort | opt);
+        uInt64 nr2 = sort.sort (inx2, uInt64(nrdata), Sort::RadixSort | opt);
+        AlwaysAssertExit (nr1 == nr2);
+        AlwaysAssertExit (allEQ (inx1, inx2));
+      }
+    }
+}
+
 // This test the unique(0 function of the Sort class
 void sort_test_unique()
 {
@@ -282,12 +324,60 @@ void sort_test_unique()
     cout << endl;
 }
 
+// This tests the isSorted function of the Sort class
+void sort_test_isSorted()
+{
+    // Use the same grouped data as in sort_test_unique, but already
+    // in order (data slowest varying).
+    const size_t nchanges = 16;
+    const size_t groupitems = 2;
+    const size_t nrdata = groupitems * nchanges;
+    Int data[nrdata];
+    Int data2[nrdata];
+    for (size_t i=0; i<nchanges; i++) {
+      for (size_t j=0; j<groupitems; j++) {
+        data[j+i*groupitems] = i/4;
+        data2[j+i*groupitems] = i%4;
+      }
+    }
+    Sort sort;
+    sort.sortKey (data,  TpInt, 0, Sort::Ascending);
+    sort.sortKey (data2, TpInt, 0, Sort::Ascending);
+    Vector<uInt64> uniqueVector;
+    Vector<size_t> changeKey;
+    AlwaysAssertExit (sort.isSorted (nrdata));
+    AlwaysAssertExit (sort.isSorted (uniqueVector, changeKey, nrdata));
+    // The boundaries must match those of unique on the sorted data.
+    Vector<uInt64> inxvec;
+    sort.sort (inxvec, uInt64(nrdata));
+    Vector<uInt64> expUnique;
+    Vector<size_t> expChange;
+    sort.unique (expUnique, expChange, inxvec);
+    AlwaysAssertExit (uniqueVector.size() == nchanges);
+    AlwaysAssertExit (allEQ (uniqueVector, expUnique));
+    for (size_t i=0; i<nchanges-1; i++) {
+      AlwaysAssertExit (changeKey[i] == expChange[i]);
+    }
+    // Descending order on the second key is not in order.
+    Sort sort2;
+    sort2.sortKey (data,  TpInt, 0, Sort::Ascending);
+    sort2.sortKey (data2, TpInt, 0, Sort::Descending);
+    AlwaysAssertExit (! sort2.isSorted (nrdata));
+    // Out of order in the last element.
+    data[nrdata-1] = 0;
+    AlwaysAssertExit (! sort.isSorted (nrdata));
+    // An empty or single element array is in order.
+    AlwaysAssertExit (sort.isSorted (0));
+    AlwaysAssertExit (sort.isSorted (1));
+}
+
 int main()
 {
     sortit (Sort::InsSort);
     sortit (Sort::ParSort);
     sortit (Sort::QuickSort);
     sortit (Sort::HeapSort);
+    sortit (Sort::RadixSort);
 
     // Sort a longer array and check its result.
     sortall (Sort::InsSort, Sort::Ascending);
@@ -306,8 +396,14 @@ int main()
     sortall (Sort::ParSort | Sort::NoDuplicates, Sort::Descending);
     sortall (Sort::QuickSort | Sort::NoDuplicates, Sort::Descending);
     sortall (Sort::HeapSort | Sort::NoDuplicates, Sort::Descending);
+    sortall (Sort::RadixSort, Sort::Ascending);
+    sortall (Sort::RadixSort | Sort::NoDuplicates, Sort::Ascending);
+    sortall (Sort::RadixSort, Sort::Descending);
+    sortall (Sort::RadixSort | Sort::NoDuplicates, Sort::Descending);
+    sort_test_radix();
 
     sort_test_unique();
+    sort_test_isSorted();
 
     return 0;                              // exit with success status
 }
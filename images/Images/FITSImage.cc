@@ -54,6 +54,10 @@
 #include <casacore/casa/Exceptions/Error.h>
 
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 
@@ -75,7 +79,8 @@ FITSImage::FITSImage (const String& name, uInt whichRep, uInt whichHDU)
   filterZeroMask_p(False),
   whichRep_p(whichRep),
   whichHDU_p(whichHDU),
-  _hasBeamsTable(False)
+  _hasBeamsTable(False),
+  nReadThreads_p(0)
 {
    setup();
 }
@@ -97,7 +102,8 @@ FITSImage::FITSImage (const String& name, const MaskSpecifier& maskSpec, uInt wh
   filterZeroMask_p(False),
   whichRep_p(whichRep),
   whichHDU_p(whichHDU),
-  _hasBeamsTable(False)
+  _hasBeamsTable(False),
+  nReadThreads_p(0)
 {
    setup();
 }
@@ -121,8 +127,8 @@ FITSImage::FITSImage (const FITSImage& other)
   filterZeroMask_p(other.filterZeroMask_p),
   whichRep_p(other.whichRep_p),
   whichHDU_p(other.whichHDU_p),
-  _hasBeamsTable(other._hasBeamsTable)
-
+  _hasBeamsTable(other._hasBeamsTable),
+  nReadThreads_p(other.nReadThreads_p)
 {
    if (other.pPixelMask_p) {
      pPixelMask_p.reset (other.pPixelMask_p->clone());
@@ -138,6 +144,7 @@ FITSImage& FITSImage::operator=(const FITSImage& other)
       ImageInterface<Float>::operator= (other);
 //
       pTiledFile_p = other.pTiledFile_p;             // shared pointer
+      readers_p.clear();                             // made when needed
 //
       pPixelMask_p.reset();
       if (other.pPixelMask_p) {
@@ -161,6 +168,7 @@ FITSImage& FITSImage::operator=(const FITSImage& other)
       whichRep_p = other.whichRep_p;
       whichHDU_p = other.whichHDU_p;
       _hasBeamsTable = other._hasBeamsTable;
+      nReadThreads_p = other.nReadThreads_p;
    }
    return *this;
 } 
@@ -369,25 +377,132 @@ Bool FITSImage::doGetSlice(Array<Float>& buffer,
                            const Slicer& section)
 {
    reopenIfNeeded();
-   if (pTiledFile_p->dataType() == TpFloat) {
-      pTiledFile_p->get (buffer, section);
-   } else if (pTiledFile_p->dataType() == TpDouble) {
+   if (! getSliceParallel (buffer, section)) {
+      getSlice (*pTiledFile_p, buffer, section);
+   }
+   return False;                            // Not a reference
+} 
+
+void FITSImage::getSlice (TiledFileAccess& tiledFile, Array<Float>& buffer,
+                          const Slicer& section) const
+{
+   if (tiledFile.dataType() == TpFloat) {
+      tiledFile.get (buffer, section);
+   } else if (tiledFile.dataType() == TpDouble) {
       Array<Double> tmp;
-      pTiledFile_p->get (tmp, section);
+      tiledFile.get (tmp, section);
       buffer.resize(tmp.shape());
       convertArray(buffer, tmp);
-   } else if (pTiledFile_p->dataType() == TpInt) {
-      pTiledFile_p->get (buffer, section, scale_p, offset_p,
-			 longMagic_p, hasBlanks_p);
-   } else if (pTiledFile_p->dataType() == TpShort) {
-      pTiledFile_p->get (buffer, section, scale_p, offset_p,
-			 shortMagic_p, hasBlanks_p);
-   } else if (pTiledFile_p->dataType() == TpUChar) {
-      pTiledFile_p->get (buffer, section, scale_p, offset_p,
-			uCharMagic_p, hasBlanks_p);
+   } else if (tiledFile.dataType() == TpInt) {
+      tiledFile.get (buffer, section, scale_p, offset_p,
+                     longMagic_p, hasBlanks_p);
+   } else if (tiledFile.dataType() == TpShort) {
+      tiledFile.get (buffer, section, scale_p, offset_p,
+                     shortMagic_p, hasBlanks_p);
+   } else if (tiledFile.dataType() == TpUChar) {
+      tiledFile.get (buffer, section, scale_p, offset_p,
+                     uCharMagic_p, hasBlanks_p);
    }
-   return False;                            // Not a reference
-} 
+}
+
+Bool FITSImage::getSliceParallel (Array<Float>& buffer,
+                                  const Slicer& section)
+{
+   Int64 nthr = nReadThreads_p;
+#ifdef _OPENMP
+   if (nthr == 0) {
+      nthr = omp_get_max_threads();
+   }
+#endif
+   if (nthr <= 1) {
+      return False;
+   }
+   IPosition start, end, stride;
+   IPosition shp = section.inferShapeFromSource (shape_p.shape(),
+                                                 start, end, stride);
+// Small slices are not worth the overhead.
+
+   if (shp.product() < 1024*1024) {
+      return False;
+   }
+
+// Split along the last axis with length > 1 at tile boundaries, so
+// a tile is never read by more than one thread.
+// Determine the first slice index of each part.
+
+   Int axis = shp.size() - 1;
+   while (axis > 0  &&  shp[axis] == 1) {
+      --axis;
+   }
+   const Int64 tileLen   = shape_p.tileShape()[axis];
+   const Int64 firstTile = start[axis] / tileLen;
+   const Int64 ntiles    = end[axis] / tileLen - firstTile + 1;
+   const Int64 nchunk    = std::min (nthr, ntiles);
+   std::vector<Int64> bounds(1, 0);
+   for (Int64 i=1; i<nchunk; ++i) {
+      Int64 pos = (firstTile + i*ntiles/nchunk) * tileLen;
+      Int64 inx = (pos - start[axis] + stride[axis] - 1) / stride[axis];
+      if (inx > bounds.back()  &&  inx < shp[axis]) {
+         bounds.push_back (inx);
+      }
+   }
+   bounds.push_back (shp[axis]);
+   const Int nparts = bounds.size() - 1;
+   if (nparts < 2) {
+      return False;
+   }
+
+// Create the extra file access objects if needed.
+// They share the maximum cache size of the main one.
+
+   if (readers_p.size() < uInt(nparts-1)) {
+      while (readers_p.size() < uInt(nparts-1)) {
+         std::shared_ptr<TiledFileAccess> tiledFile = makeTiledFile();
+         tiledFile->setCacheSize (pTiledFile_p->cacheSize());
+         readers_p.push_back (tiledFile);
+      }
+      setReadersCacheSize (pTiledFile_p->maximumCacheSize());
+   }
+
+// Read and scale each part directly into its section of the buffer.
+
+   buffer.resize (shp);
+   String errMsg;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nparts)
+#endif
+   for (Int i=0; i<nparts; ++i) {
+      try {
+         IPosition partStart(start);
+         IPosition partEnd(end);
+         partStart[axis] = start[axis] + bounds[i]*stride[axis];
+         partEnd[axis]   = start[axis] + (bounds[i+1]-1)*stride[axis];
+         IPosition bufStart(shp.size(), 0);
+         IPosition bufEnd(shp - 1);
+         bufStart[axis] = bounds[i];
+         bufEnd[axis]   = bounds[i+1] - 1;
+         Array<Float> part(buffer(bufStart, bufEnd));
+         TiledFileAccess& tiledFile = (i == 0  ?  *pTiledFile_p :
+                                                  *readers_p[i-1]);
+         getSlice (tiledFile, part,
+                   Slicer(partStart, partEnd, stride, Slicer::endIsLast));
+      } catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(FITSImage_getSliceParallel)
+#endif
+         errMsg = x.what();
+      }
+   }
+   if (! errMsg.empty()) {
+      throw AipsError ("FITSImage::doGetSlice - " + errMsg);
+   }
+   return True;
+}
+
+void FITSImage::setNumReadThreads (uInt nthreads)
+{
+   nReadThreads_p = nthreads;
+}
    
 
 void FITSImage::doPutSlice (const Array<Float>&, const IPosition&,
@@ -478,6 +593,7 @@ void FITSImage::tempClose()
    if (! isClosed_p) {
       pPixelMask_p.reset();
       pTiledFile_p.reset();
+      readers_p.clear();
       isClosed_p = True;
    }
 }
@@ -500,6 +616,15 @@ void FITSImage::setMaximumCacheSize (uInt howManyPixels)
    reopenIfNeeded();
    const uInt sizeInBytes = howManyPixels * ValType::getTypeSize(dataType_p);
    pTiledFile_p->setMaximumCacheSize (sizeInBytes);
+   setReadersCacheSize (sizeInBytes);
+}
+
+void FITSImage::setReadersCacheSize (uInt64 sizeInBytes)
+{
+   const uInt nparts = readers_p.size() + 1;
+   for (auto& tiledFile : readers_p) {
+      tiledFile->setMaximumCacheSize (sizeInBytes / nparts);
+   }
 }
 
 void FITSImage::setCacheSizeFromPath (const IPosition& sliceShape, 
@@ -510,12 +635,19 @@ void FITSImage::setCacheSizeFromPath (const IPosition& sliceShape,
    reopenIfNeeded();
    pTiledFile_p->setCacheSize (sliceShape, windowStart,
 			       windowLength, axisPath);
+   for (auto& tiledFile : readers_p) {
+      tiledFile->setCacheSize (sliceShape, windowStart,
+                               windowLength, axisPath);
+   }
 }
 
 void FITSImage::setCacheSizeInTiles (uInt howManyTiles)  
 {  
    reopenIfNeeded();
    pTiledFile_p->setCacheSize (howManyTiles);
+   for (auto& tiledFile : readers_p) {
+      tiledFile->setCacheSize (howManyTiles);
+   }
 }
 
 
@@ -523,6 +655,9 @@ void FITSImage::clearCache()
 {
    if (! isClosed_p) {
       pTiledFile_p->clearCache();
+      for (auto& tiledFile : readers_p) {
+         tiledFile->clearCache();
+      }
    }
 }
 
@@ -531,6 +666,10 @@ void FITSImage::showCacheStatistics (ostream& os) const
    reopenIfNeeded();
    os << "FITSImage statistics : ";
    pTiledFile_p->showCacheStatistics (os);
+   for (const auto& tiledFile : readers_p) {
+      os << "FITSImage read thread statistics : ";
+      tiledFile->showCacheStatistics (os);
+   }
 }
 
 
@@ -657,15 +796,7 @@ void FITSImage::setup()
 
 void FITSImage::open()
 {
-   Bool writable = False;
-   Bool canonical = True;    
-
-// The tile shape must not be a subchunk in all dimensions
-
-   pTiledFile_p = std::make_shared<TiledFileAccess>(name_p, fileOffset_p,
-                                                    shape_p.shape(), shape_p.tileShape(),
-                                                    dataType_p, TSMOption(),
-                                                    writable, canonical);
+   pTiledFile_p = makeTiledFile();
 
 // Shares the pTiledFile_p pointer. Scale factors for integers
 
@@ -696,6 +827,19 @@ void FITSImage::open()
    isClosed_p = False;
 }
 
+std::shared_ptr<TiledFileAccess> FITSImage::makeTiledFile() const
+{
+   Bool writable = False;
+   Bool canonical = True;    
+
+// The tile shape must not be a subchunk in all dimensions
+
+   return std::make_shared<TiledFileAccess>(name_p, fileOffset_p,
+                                            shape_p.shape(), shape_p.tileShape(),
+                                            dataType_p, TSMOption(),
+                                            writable, canonical);
+}
+
 
 void FITSImage::getImageAttributes (CoordinateSystem& cSys,
                                     IPosition& shape, ImageInfo& imageInfo,
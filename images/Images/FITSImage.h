@@ -37,6 +37,8 @@
 #include <casacore/fits/FITS/fits.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/DataType.h>
+#include <memory>
+#include <vector>
 
 #ifndef WCSLIB_GETWCSTAB
  #define WCSLIB_GETWCSTAB
@@ -258,6 +260,20 @@ public:
   // Report on cache success.
   virtual void showCacheStatistics (ostream& os) const;
 
+  // Set the number of threads used by doGetSlice to read a large slice.
+  // Such a slice is split at tile boundaries along its last axis with
+  // length > 1. The parts are read and scaled concurrently, each by its
+  // own TiledFileAccess object which is kept for subsequent reads.
+  // Each object has its own tile cache, which is sized by the
+  // cache functions above.
+  // <br>0 (the default) means the number of OpenMP threads; 1 means
+  // that slices are always read serially.
+  // <group>
+  void setNumReadThreads (uInt nthreads);
+  uInt numReadThreads() const
+    { return nReadThreads_p; }
+  // </group>
+
 protected:
   // Set the masking of values 0.0
   void setMaskZero(Bool filterZero);
@@ -282,6 +298,10 @@ private:
   uInt           whichRep_p;
   uInt           whichHDU_p;
   Bool           _hasBeamsTable;
+  uInt           nReadThreads_p;
+  // The extra file access objects used to read slices in parallel.
+  // They are made when needed, so they are not shared by copies.
+  std::vector<std::shared_ptr<TiledFileAccess>> readers_p;
 
 // Reopen the image if needed.
    void reopenIfNeeded() const
@@ -293,6 +313,21 @@ private:
 // Open the image (used by setup and reopen).
    void open();
 
+// Create an object to access the pixels in the file.
+   std::shared_ptr<TiledFileAccess> makeTiledFile() const;
+
+// Get a slice using the given file access object.
+   void getSlice (TiledFileAccess& tiledFile, Array<Float>& buffer,
+                  const Slicer& section) const;
+
+// Get a large slice in parallel parts.
+// It returns False if the slice is not large enough to do so.
+   Bool getSliceParallel (Array<Float>& buffer, const Slicer& section);
+
+// Give each extra file access object its share of the maximum cache size
+// (in bytes), so together they do not use much more memory than the main one.
+   void setReadersCacheSize (uInt64 sizeInBytes);
+
 // Fish things out of the FITS file
    void getImageAttributes (CoordinateSystem& cSys,
                             IPosition& shape, ImageInfo& info,
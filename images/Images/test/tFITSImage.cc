@@ -38,7 +38,12 @@
 #include <casacore/images/Images/FITSImage.h>
 #include <casacore/images/Images/ImageInterface.h>
 #include <casacore/images/Images/ImageFITSConverter.h>
+#include <casacore/images/Images/TempImage.h>
 #include <casacore/coordinates/Coordinates/CoordinateSystem.h>
+#include <casacore/coordinates/Coordinates/CoordinateUtil.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
 
 #include <casacore/casa/iostream.h>
 
@@ -47,6 +52,44 @@ Bool allNear (const Array<Float>& data, const Array<Bool>& dataMask,
               const Array<Float>& fits, const Array<Bool>& fitsMask,
               Float tol=1.0e-5, Float abstol=-1.);
 
+// Check that reading large slices in parallel gives the same result
+// as reading them serially, for a float and a scaled 16-bit image.
+void testParallelRead()
+{
+   IPosition shape(3, 128, 96, 240);
+   TempImage<Float> image(shape, CoordinateUtil::defaultCoords3D());
+   Array<Float> data(shape);
+   indgen (data, Float(-500), Float(0.01));
+   image.put (data);
+   for (Int bitpix : {-32, 16}) {
+      String error;
+      String file = "tFITSImage_tmp.fits";
+      AlwaysAssertExit (ImageFITSConverter::ImageToFITS
+                        (error, image, file, 64, True, True, bitpix,
+                         1.0, -1.0, True));
+      FITSImage serial(file);
+      serial.setNumReadThreads (1);
+      FITSImage parallel(file);
+      parallel.setNumReadThreads (4);
+      AlwaysAssertExit (parallel.numReadThreads() == 4);
+      parallel.setCacheSizeInTiles (2);
+      AlwaysAssertExit (allEQ (parallel.get(), serial.get()));
+      // A strided slice not starting at a tile boundary. It has to be
+      // large enough (>= 1M pixels) to be read in parallel.
+      Slicer slicer(IPosition(3,1,2,3), IPosition(3,127,95,238),
+                    IPosition(3,1,1,2), Slicer::endIsLast);
+      AlwaysAssertExit (slicer.length().product() >= 1024*1024);
+      AlwaysAssertExit (allEQ (parallel.getSlice(slicer),
+                               serial.getSlice(slicer)));
+      // Parallel reading also works after a temporary close.
+      parallel.tempClose();
+      AlwaysAssertExit (allEQ (parallel.get(), serial.get()));
+      if (bitpix < 0) {
+        AlwaysAssertExit (allEQ (parallel.get(), data));
+      }
+   }
+}
+
 int main (int argc, const char* argv[])
 {
 try {
@@ -157,6 +200,7 @@ try {
    AlwaysAssert(allNear(pLoadImage->get(), pLoadImage->getMask(), fitsArray2, fitsMask2, 0.0, 0.001), AipsError);
    delete pLoadImage;
 
+   testParallelRead();
 
 } catch (std::exception& x) {
    cout << "aipserror: error " << x.what() << endl;
@@ -29,7 +29,10 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
 #include <casacore/scimath/Mathematics/NumericTraits.h>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -101,6 +104,15 @@ class LatticeRegion;
 // the chunk of data passed in. The <src>nstepsDone</src> function
 // in these classes can be used to monitor the progress.
 // <p>
+// <src>lineMultiApply</src> and <src>tiledApply</src> process the lattice
+// in parallel if multiple OpenMP threads are available and the collapser
+// implements <src>clone</src>. Otherwise they process it serially.
+// Of the collapsers in this package only
+// <linkto class=StatsTiledCollapser>StatsTiledCollapser</linkto> is
+// cloneable; no LineCollapser in casacore is (collapsers defined in other
+// packages, such as moment calculators, only run in parallel once they
+// implement <src>clone</src>).
+// <p>
 // The class is Doubly templated.  Ths first template type
 // is for the data type you are processing.  The second type is
 // for what type you want the results of the processing assigned to.
@@ -248,6 +260,45 @@ private:
     static IPosition _chunkShape(
         uInt axis, const MaskedLattice<T>& latticeIn
     );
+
+    // Make copies of the collapser for the other threads to process
+    // at most <src>nParts</src> parts in parallel. No copies are made
+    // if a single thread is used or if the collapser cannot be copied.
+    template <class Collapser>
+    static std::vector<std::unique_ptr<Collapser>> _makeClones (
+        const Collapser& collapser, uInt nParts
+    );
+
+    // Collapse all lines in a chunk read by lineMultiApply.
+    static void _lineMultiChunk (
+        LineCollapser<T,U>& collapser,
+        const Array<T>& chunk, const Array<Bool>& maskChunk, Bool useMask,
+        const IPosition& chunkPos, uInt collapseAxis,
+        const IPosition& displayAxes, uInt nOut,
+        std::vector<Array<U>>& resultArray,
+        std::vector<Array<Bool>>& resultArrayMask
+    );
+
+    // Get the contiguous mask of a tile read by tiledApply.
+    static Array<Bool> _tiledGetMask (
+        const MaskedLattice<T>& latticeIn, const IPosition& pos,
+        const IPosition& cursorShape
+    );
+
+    // Initialize the accumulator for the output chunk of a tile group
+    // in tiledApply. It returns the shape of the output chunk.
+    static IPosition _tiledInitAccumulator (
+        TiledCollapser<T,U>& collapser, const IPosition& cursorShape,
+        const IPosition& outShape, const IPosition& ioMap, uInt resultAxis
+    );
+
+    // Collapse the data of a tile in tiledApply.
+    static void _tiledProcess (
+        TiledCollapser<T,U>& collapser,
+        const Array<T>& cursor, const Array<Bool>& mask, Bool useMask,
+        const IPosition& pos, const IPosition& collapseAxes, uInt collStart,
+        const IPosition& iterAxes, const IPosition& ioMap, uInt resultAxis
+    );
 };
 
 } //# NAMESPACE CASACORE - END
@@ -44,7 +44,11 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -228,8 +232,6 @@ void LatticeApply<T,U>::lineMultiApply (PtrBlock<MaskedLattice<U>*>& latticeOut,
         AlwaysAssert(latticeOut[i]->shape() == shape, AipsError);
     }
     const IPosition& inShape = latticeIn.shape();
-    IPosition outPos(outDim, 0);
-    IPosition outShape(outDim, 1);
     // Does the input has a mask?
     // If not, can the collapser handle a null mask.
     Bool useMask = latticeIn.isMasked()
@@ -238,93 +240,100 @@ void LatticeApply<T,U>::lineMultiApply (PtrBlock<MaskedLattice<U>*>& latticeOut,
     const IPosition displayAxes = IPosition::makeAxisPath(inNDim).otherAxes(
         inNDim, IPosition(1, collapseAxis)
     );
-    const uInt nDisplayAxes = displayAxes.size();
-    Vector<U> result(nOut);
-    Vector<Bool> resultMask(nOut);
     // read in larger chunks than before, because that was very
     // Inefficient and brought NRAO cluster to a snail's pace,
     // and then do the accounting for the input lines in memory
-    IPosition chunkSliceStart(inNDim, 0);
-    IPosition chunkSliceEnd = chunkSliceStart;
-    chunkSliceEnd[collapseAxis] = inShape[collapseAxis] - 1;
-    const IPosition chunkSliceEndAtChunkIterBegin = chunkSliceEnd;
     IPosition chunkShapeInit = _chunkShape(collapseAxis, latticeIn);
     LatticeStepper myStepper(inShape, chunkShapeInit, LatticeStepper::RESIZE);
     RO_MaskedLatticeIterator<T> latIter(latticeIn, myStepper);
-    IPosition curPos;
-    static const Vector<Bool> noMask;
     if (tellProgress) {
         uInt nExpectedIters = inShape.product()/chunkShapeInit.product();
         tellProgress->init(nExpectedIters);
     }
+    // If the collapser can be copied, a batch of chunks is read serially
+    // and the chunks are collapsed in parallel, each by its own collapser.
+    // The chunks are copied in that case, because the iterator cursor
+    // is overwritten by the next step.
+    const uInt nExpected = (inShape.product() + chunkShapeInit.product() - 1)
+                           / chunkShapeInit.product();
+    std::vector<std::unique_ptr<LineCollapser<T,U>>> clones =
+        _makeClones (collapser, nExpected);
+    const uInt nBatch = clones.size() + 1;
+    std::vector<Array<T>> chunks(nBatch);
+    std::vector<Array<Bool>> maskChunks(nBatch);
+    std::vector<IPosition> chunkPos(nBatch);
+    std::vector<std::vector<Array<U>>> resultArrays(nBatch);
+    std::vector<std::vector<Array<Bool>>> resultArrayMasks(nBatch);
     uInt nDone = 0;
-    for (latIter.reset(); ! latIter.atEnd(); ++latIter) {
-        const IPosition cp = latIter.position();
-        const Array<T>& chunk = latIter.cursor();
-        IPosition chunkShape = chunk.shape();
-        const Array<Bool> maskChunk = useMask ? latIter.getMask() : Array<Bool>();
-        chunkSliceStart = 0;
-        chunkSliceEnd = chunkSliceEndAtChunkIterBegin;
-        IPosition resultArrayShape = chunkShape;
-        resultArrayShape[collapseAxis] = 1;
-        std::vector<Array<U> > resultArray(nOut);
-        std::vector<Array<Bool> > resultArrayMask(nOut);
-        // need to initialize this way rather than doing it in the constructor,
-        // because using a single Array in the constructor means that all Arrays
-        // in the vector reference the same Array.
-        for (uInt k=0; k<nOut; k++) {
-            resultArray[k] = Array<U>(resultArrayShape);
-            resultArrayMask[k] = Array<Bool>(resultArrayShape);
-        }
-        Bool done = False;
-        while (! done) {
-            Vector<T> data(chunk(chunkSliceStart, chunkSliceEnd));
-            Vector<Bool> mask = useMask
-                ? Vector<Bool>(maskChunk(chunkSliceStart, chunkSliceEnd))
-                : noMask;
-            curPos = cp + chunkSliceStart;
-            collapser.multiProcess(result, resultMask, data, mask, curPos);
-            for (uInt k=0; k<nOut; ++k) {
-                resultArray[k](chunkSliceStart) = result[k];
-                resultArrayMask[k](chunkSliceStart) = resultMask[k];
+    latIter.reset();
+    while (! latIter.atEnd()) {
+        uInt n = 0;
+        if (nBatch == 1) {
+            chunks[0].reference (latIter.cursor());
+            chunkPos[0] = latIter.position();
+            if (useMask) {
+                maskChunks[0].reference (latIter.getMask());
             }
-            done = True;
-            for (uInt k=0; k<nDisplayAxes; ++k) {
-                uInt dax = displayAxes[k];
-                if (chunkSliceStart[dax] < chunkShape[dax] - 1) {
-                    ++chunkSliceStart[dax];
-                    ++chunkSliceEnd[dax];
-                    done = False;
-                    break;
-                }
-                else {
-                    chunkSliceStart[dax] = 0;
-                    chunkSliceEnd[dax] = 0;
+            n = 1;
+        } else {
+            for (; n<nBatch && ! latIter.atEnd(); ++n, ++latIter) {
+                chunks[n].reference (latIter.cursor().copy());
+                chunkPos[n] = latIter.position();
+                if (useMask) {
+                    maskChunks[n].reference (latIter.getMask());
                 }
             }
         }
-        // put the result arrays in the output lattices
-        for (uInt k=0; k<nOut; ++k) {
-            IPosition outpos = inNDim == outDim
-                ? cp : cp.removeAxes(IPosition(1, collapseAxis));
-            Bool keepAxis = resultArray[k].ndim() == latticeOut[k]->ndim();
-            if (! keepAxis) {
-                resultArray[k].removeDegenerate(displayAxes);
+        String errMsg;
+#ifdef _OPENMP
+#pragma omp parallel for if (n > 1) num_threads(n)
+#endif
+        for (Int i=0; i<Int(n); ++i) {
+            try {
+                _lineMultiChunk (i == 0  ?  collapser : *clones[i-1],
+                                 chunks[i], maskChunks[i], useMask,
+                                 chunkPos[i], collapseAxis, displayAxes,
+                                 nOut, resultArrays[i], resultArrayMasks[i]);
+            } catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(LatticeApply_lineMultiApply)
+#endif
+                errMsg = x.what();
             }
-            latticeOut[k]->putSlice(resultArray[k], outpos);
-            if (latticeOut[k]->hasPixelMask()) {
-                Lattice<Bool>& maskOut = latticeOut[k]->pixelMask();
-                if (maskOut.isWritable()) {
-                    if (! keepAxis) {
-                        resultArrayMask[k].removeDegenerate(displayAxes);
+        }
+        if (! errMsg.empty()) {
+            throw AipsError ("LatticeApply::lineMultiApply - " + errMsg);
+        }
+        // put the result arrays in the output lattices
+        for (uInt i=0; i<n; ++i) {
+            std::vector<Array<U>>& resultArray = resultArrays[i];
+            std::vector<Array<Bool>>& resultArrayMask = resultArrayMasks[i];
+            const IPosition& cp = chunkPos[i];
+            for (uInt k=0; k<nOut; ++k) {
+                IPosition outpos = inNDim == outDim
+                    ? cp : cp.removeAxes(IPosition(1, collapseAxis));
+                Bool keepAxis = resultArray[k].ndim() == latticeOut[k]->ndim();
+                if (! keepAxis) {
+                    resultArray[k].removeDegenerate(displayAxes);
+                }
+                latticeOut[k]->putSlice(resultArray[k], outpos);
+                if (latticeOut[k]->hasPixelMask()) {
+                    Lattice<Bool>& maskOut = latticeOut[k]->pixelMask();
+                    if (maskOut.isWritable()) {
+                        if (! keepAxis) {
+                            resultArrayMask[k].removeDegenerate(displayAxes);
+                        }
+                        maskOut.putSlice (resultArrayMask[k], outpos);
                     }
-                    maskOut.putSlice (resultArrayMask[k], outpos);
                 }
             }
+            if (tellProgress != 0) {
+                ++nDone;
+                tellProgress->nstepsDone(nDone);
+            }
         }
-        if (tellProgress != 0) {
-            ++nDone;
-            tellProgress->nstepsDone(nDone);
+        if (nBatch == 1) {
+            ++latIter;
         }
     }
     if (tellProgress != 0) {
@@ -332,6 +341,81 @@ void LatticeApply<T,U>::lineMultiApply (PtrBlock<MaskedLattice<U>*>& latticeOut,
     }
 }
 
+template <class T, class U>
+void LatticeApply<T,U>::_lineMultiChunk (
+    LineCollapser<T,U>& collapser,
+    const Array<T>& chunk, const Array<Bool>& maskChunk, Bool useMask,
+    const IPosition& cp, uInt collapseAxis, const IPosition& displayAxes,
+    uInt nOut, std::vector<Array<U>>& resultArray,
+    std::vector<Array<Bool>>& resultArrayMask
+) {
+    const uInt nDisplayAxes = displayAxes.size();
+    const IPosition& chunkShape = chunk.shape();
+    IPosition chunkSliceStart(chunkShape.size(), 0);
+    IPosition chunkSliceEnd = chunkSliceStart;
+    chunkSliceEnd[collapseAxis] = chunkShape[collapseAxis] - 1;
+    IPosition resultArrayShape = chunkShape;
+    resultArrayShape[collapseAxis] = 1;
+    Vector<U> result(nOut);
+    Vector<Bool> resultMask(nOut);
+    static const Vector<Bool> noMask;
+    resultArray.clear();
+    resultArray.resize(nOut);
+    resultArrayMask.clear();
+    resultArrayMask.resize(nOut);
+    // need to initialize this way rather than doing it in the constructor,
+    // because using a single Array in the constructor means that all Arrays
+    // in the vector reference the same Array.
+    for (uInt k=0; k<nOut; k++) {
+        resultArray[k] = Array<U>(resultArrayShape);
+        resultArrayMask[k] = Array<Bool>(resultArrayShape);
+    }
+    Bool done = False;
+    while (! done) {
+        Vector<T> data(chunk(chunkSliceStart, chunkSliceEnd));
+        Vector<Bool> mask = useMask
+            ? Vector<Bool>(maskChunk(chunkSliceStart, chunkSliceEnd))
+            : noMask;
+        IPosition curPos = cp + chunkSliceStart;
+        collapser.multiProcess(result, resultMask, data, mask, curPos);
+        for (uInt k=0; k<nOut; ++k) {
+            resultArray[k](chunkSliceStart) = result[k];
+            resultArrayMask[k](chunkSliceStart) = resultMask[k];
+        }
+        done = True;
+        for (uInt k=0; k<nDisplayAxes; ++k) {
+            uInt dax = displayAxes[k];
+            if (chunkSliceStart[dax] < chunkShape[dax] - 1) {
+                ++chunkSliceStart[dax];
+                ++chunkSliceEnd[dax];
+                done = False;
+                break;
+            }
+            else {
+                chunkSliceStart[dax] = 0;
+                chunkSliceEnd[dax] = 0;
+            }
+        }
+    }
+}
+
+template <class T, class U>
+template <class Collapser>
+std::vector<std::unique_ptr<Collapser>> LatticeApply<T,U>::_makeClones (
+    const Collapser& collapser, uInt nParts
+) {
+    std::vector<std::unique_ptr<Collapser>> clones;
+    const uInt nthr = std::min (OMP::maxThreads(), nParts);
+    for (uInt i=1; i<nthr; ++i) {
+        Collapser* clone = collapser.clone();
+        if (clone == 0) {
+            break;
+        }
+        clones.emplace_back (clone);
+    }
+    return clones;
+}
+
 template <class T, class U>
 IPosition LatticeApply<T,U>::_chunkShape(
     uInt axis, const MaskedLattice<T>& latticeIn
@@ -407,7 +491,6 @@ void LatticeApply<T,U>::tiledApply (
 
     const IPosition blc = IPosition(inShape.nelements(), 0);
     const IPosition trc = inShape - 1;
-    const IPosition inc = IPosition(inShape.nelements(), 1);
     const uInt collDim = collapseAxes.nelements();
     const uInt iterDim = inDim - collDim;
     IPosition iterAxes(iterDim);
@@ -441,20 +524,6 @@ void LatticeApply<T,U>::tiledApply (
 	    }
     }
 
-    // Set the number of expected steps.
-    // This is the number of tiles to process.
-    // Also give the number of resulting output pixels per line, so the
-    // collapser can check it.
-
-    uInt nsteps = 1;
-    for (j=0; j<inDim; ++j) {
-	    nsteps *= 1 + trc(j)/inTileShape(j) - blc(j)/inTileShape(j);
-    }
-    collapser.init (outShape.product());
-    if (tellProgress != 0) {
-        tellProgress->init (nsteps);
-    }
-
     // Determine the axis where the collapsed values are stored in the output.
     // This is the first unmapped axis (the first axis when all axes are mapped).
     uInt resultAxis = 0;
@@ -465,172 +534,348 @@ void LatticeApply<T,U>::tiledApply (
 	    }
     }
 
+    // The tiles having the same position on the iteration axes form a
+    // group which is collapsed into one output chunk.
+    // If the collapser can be copied, a batch of groups is read serially
+    // and the groups are collapsed in parallel, each by its own collapser.
+    // The number of groups in a batch is limited by the memory needed to
+    // hold their data (an arbitrary, but reasonable, limit of 512 MB).
+
+    uInt nsteps = 1;
+    uInt nGroups = 1;
+    uInt64 groupSize = useMask ? sizeof(T) + sizeof(Bool) : sizeof(T);
+    for (j=0; j<inDim; ++j) {
+        uInt nTiles = 1 + trc(j)/inTileShape(j) - blc(j)/inTileShape(j);
+	    nsteps *= nTiles;
+        if (std::find (collapseAxes.begin(), collapseAxes.end(), ssize_t(j))
+            != collapseAxes.end()) {
+            groupSize *= inShape(j);
+        } else {
+            nGroups *= nTiles;
+            groupSize *= inTileShape(j);
+        }
+    }
+    const uInt64 memoryLimit = 512 * 1024 * 1024;
+    std::vector<std::unique_ptr<TiledCollapser<T,U>>> clones;
+    if (groupSize <= memoryLimit/2) {
+        clones = _makeClones (collapser,
+                              std::min (uInt64(nGroups),
+                                        memoryLimit/groupSize));
+    }
+
+    // Set the number of expected steps.
+    // This is the number of tiles to process.
+    // Also give the number of resulting output pixels per line, so the
+    // collapser can check it.
+
+    collapser.init (outShape.product());
+    for (auto& clone : clones) {
+        clone->init (outShape.product());
+    }
+    if (tellProgress != 0) {
+        tellProgress->init (nsteps);
+    }
+
     // Iterate through all the tiles.
     // TileStepper is set up in such a way that the collapse axes are iterated
     // fastest. When all collapse axes are handled, thus when the iter axes
     // position changes, we have to write that part.
 
-    Bool firstTime = True;
-    IPosition outPos(outDim, 0);
-    IPosition iterPos(outDim, 0);
-    while (! inIter.atEnd()) {
-
-        // Calculate the size of each chunk of output data.
-        // Each chunk contains the data of a tile in each IterAxis.
-        // Determine the index of the first element to take from the cursor.
-
-	    const Array<T>& iterCursor = inIter.cursor();
-	    // In order to use the pointers-to-array-data below, the array *must*
-	    // be contiguous or the results will in general be incorrect.
-	    // Ditto for the mask
-	    const Array<T>& cursor = iterCursor.contiguousStorage()
-	    	? iterCursor : iterCursor.copy();
-	    ThrowIf(
-	    	! cursor.contiguousStorage(), "cursor array is not contiguous"
-	    );
-	    const IPosition& cursorShape = cursor.shape();
-	    IPosition pos = inIter.position();
-	    IPosition latPos = pos;
-	    Array<Bool> mask;
-	    if (useMask) {
-	        // Casting const away is innocent.
-	        ((MaskedLattice<T>&)latticeIn).getMaskSlice(mask, Slicer(pos, cursorShape));
-	        if (! mask.contiguousStorage()) {
-	        	mask = mask.copy();
-	        	ThrowIf(
-	        		! mask.contiguousStorage(), "mask array is not contiguous"
-	        	);
-	        }
-	    }
-	    for (j=0; j<outDim; ++j) {
-	        if (ioMap(j) >= 0) {
-		        uInt axis = ioMap(j);
-		        iterPos(j) = pos(axis);
-	        }
-	    }
-	    if (firstTime  ||  outPos != iterPos) {
-	        if (!firstTime) {
-		        Array<U> result;
-		        Array<Bool> resultMask;
-		        collapser.endAccumulator (result, resultMask, outShape);
-		        latticeOut.putSlice (result, outPos);
-		        if (maskOut != 0) {
-		            maskOut->putSlice (resultMask, outPos);
-		        }
+    if (clones.empty()) {
+        Bool firstTime = True;
+        IPosition outPos(outDim, 0);
+        IPosition iterPos(outDim, 0);
+        IPosition chunkShape;
+        while (! inIter.atEnd()) {
+            // In order to use the pointers-to-array-data, the array *must*
+            // be contiguous or the results will in general be incorrect.
+            // Ditto for the mask
+	        const Array<T>& iterCursor = inIter.cursor();
+	        const Array<T>& cursor = iterCursor.contiguousStorage()
+	    	    ? iterCursor : iterCursor.copy();
+	        ThrowIf(
+	    	    ! cursor.contiguousStorage(), "cursor array is not contiguous"
+	        );
+	        IPosition pos = inIter.position();
+	        Array<Bool> mask;
+	        if (useMask) {
+                mask = _tiledGetMask (latticeIn, pos, cursor.shape());
 	        }
-	        firstTime = False;
-	        outPos = iterPos;
-	        uInt64 n1 = 1;
-	        uInt64 n3 = 1;
 	        for (j=0; j<outDim; ++j) {
-		        if (ioMap(j) >= 0) {
-		            outShape(j) = cursorShape(ioMap(j));
-		            if (j < resultAxis) {
-		                n1 *= outShape(j);
-		            }
-                    else {
-		                n3 *= outShape(j);
+	            if (ioMap(j) >= 0) {
+		            iterPos(j) = pos(ioMap(j));
+	            }
+	        }
+	        if (firstTime  ||  outPos != iterPos) {
+	            if (!firstTime) {
+		            Array<U> result;
+		            Array<Bool> resultMask;
+		            collapser.endAccumulator (result, resultMask, chunkShape);
+		            latticeOut.putSlice (result, outPos);
+		            if (maskOut != 0) {
+		                maskOut->putSlice (resultMask, outPos);
 		            }
-		        }
+	            }
+	            firstTime = False;
+	            outPos = iterPos;
+                chunkShape = _tiledInitAccumulator (collapser, cursor.shape(),
+                                                    outShape, ioMap,
+                                                    resultAxis);
 	        }
-	        collapser.initAccumulator (n1, n3);
-	    }
+            _tiledProcess (collapser, cursor, mask, useMask, pos,
+                           collapseAxes, collStart, iterAxes, ioMap,
+                           resultAxis);
+	        ++inIter;
+	        if (tellProgress != 0) {
+                tellProgress->nstepsDone (inIter.nsteps());
+            }
+        }
+
+        // Write out the last output array.
+        Array<U> result;
+        Array<Bool> resultMask;
+        collapser.endAccumulator (result, resultMask, chunkShape);
+        latticeOut.putSlice (result, outPos);
+        if (maskOut != 0) {
+            maskOut->putSlice (resultMask, outPos);
+        }
+    } else {
+        const uInt nBatch = clones.size() + 1;
+        std::vector<std::vector<Array<T>>> groupData;
+        std::vector<std::vector<Array<Bool>>> groupMask;
+        std::vector<std::vector<IPosition>> groupTilePos;
+        std::vector<IPosition> groupPos;
+        IPosition iterPos(outDim, 0);
+        while (True) {
+            // Collapse the batch when it is full or at the end.
+            // A batch is full if the first tile of the next group is read.
+            if (inIter.atEnd()  ||  groupPos.size() == nBatch) {
+                Bool atEnd = inIter.atEnd();
+                IPosition pos;
+                if (! atEnd) {
+                    pos = inIter.position();
+                    for (j=0; j<outDim; ++j) {
+                        if (ioMap(j) >= 0) {
+                            iterPos(j) = pos(ioMap(j));
+                        }
+                    }
+                }
+                if (atEnd  ||  iterPos != groupPos.back()) {
+                    uInt n = groupPos.size();
+                    std::vector<Array<U>> results(n);
+                    std::vector<Array<Bool>> resultMasks(n);
+                    String errMsg;
+#ifdef _OPENMP
+#pragma omp parallel for if (n > 1) num_threads(n)
+#endif
+                    for (Int g=0; g<Int(n); ++g) {
+                        try {
+                            TiledCollapser<T,U>& coll =
+                                (g == 0  ?  collapser : *clones[g-1]);
+                            IPosition chunkShape = _tiledInitAccumulator
+                                (coll, groupData[g][0].shape(), outShape,
+                                 ioMap, resultAxis);
+                            for (uInt t=0; t<groupData[g].size(); ++t) {
+                                _tiledProcess (coll, groupData[g][t],
+                                               groupMask[g][t], useMask,
+                                               groupTilePos[g][t],
+                                               collapseAxes, collStart,
+                                               iterAxes, ioMap, resultAxis);
+                            }
+                            coll.endAccumulator (results[g], resultMasks[g],
+                                                 chunkShape);
+                        } catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(LatticeApply_tiledApply)
+#endif
+                            errMsg = x.what();
+                        }
+                    }
+                    if (! errMsg.empty()) {
+                        throw AipsError ("LatticeApply::tiledApply - " +
+                                         errMsg);
+                    }
+                    for (uInt g=0; g<n; ++g) {
+                        latticeOut.putSlice (results[g], groupPos[g]);
+                        if (maskOut != 0) {
+                            maskOut->putSlice (resultMasks[g], groupPos[g]);
+                        }
+                    }
+                    groupData.clear();
+                    groupMask.clear();
+                    groupTilePos.clear();
+                    groupPos.clear();
+                }
+                if (atEnd) {
+                    break;
+                }
+            }
+            // Read the next tile; it is copied because the iterator
+            // cursor is overwritten by the next step.
+            IPosition pos = inIter.position();
+            for (j=0; j<outDim; ++j) {
+                if (ioMap(j) >= 0) {
+                    iterPos(j) = pos(ioMap(j));
+                }
+            }
+            if (groupPos.empty()  ||  iterPos != groupPos.back()) {
+                groupPos.push_back (iterPos);
+                groupData.push_back (std::vector<Array<T>>());
+                groupMask.push_back (std::vector<Array<Bool>>());
+                groupTilePos.push_back (std::vector<IPosition>());
+            }
+            Array<T> cursor = inIter.cursor().copy();
+            groupMask.back().push_back (useMask
+                ? _tiledGetMask (latticeIn, pos, cursor.shape())
+                : Array<Bool>());
+            groupData.back().push_back (cursor);
+            groupTilePos.back().push_back (pos);
+            ++inIter;
+            if (tellProgress != 0) {
+                tellProgress->nstepsDone (inIter.nsteps());
+            }
+        }
+        for (const auto& clone : clones) {
+            collapser.merge (*clone);
+        }
+    }
+    if (tellProgress != 0) tellProgress->done();
+}
 
-        // Put the collapsed lines into an output buffer
-        // Initialize the cursor position needed in the loop.
+template <class T, class U>
+Array<Bool> LatticeApply<T,U>::_tiledGetMask (
+    const MaskedLattice<T>& latticeIn, const IPosition& pos,
+    const IPosition& cursorShape
+) {
+    Array<Bool> mask;
+    // Casting const away is innocent.
+    ((MaskedLattice<T>&)latticeIn).getMaskSlice(mask, Slicer(pos, cursorShape));
+    if (! mask.contiguousStorage()) {
+        mask = mask.copy();
+        ThrowIf(
+            ! mask.contiguousStorage(), "mask array is not contiguous"
+        );
+    }
+    return mask;
+}
 
-	    IPosition curPos (inDim, 0);
+template <class T, class U>
+IPosition LatticeApply<T,U>::_tiledInitAccumulator (
+    TiledCollapser<T,U>& collapser, const IPosition& cursorShape,
+    const IPosition& outShape, const IPosition& ioMap, uInt resultAxis
+) {
+    IPosition chunkShape(outShape);
+    uInt64 n1 = 1;
+    uInt64 n3 = 1;
+    for (uInt j=0; j<chunkShape.size(); ++j) {
+        if (ioMap(j) >= 0) {
+            chunkShape(j) = cursorShape(ioMap(j));
+            if (j < resultAxis) {
+                n1 *= chunkShape(j);
+            }
+            else {
+                n3 *= chunkShape(j);
+            }
+        }
+    }
+    collapser.initAccumulator (n1, n3);
+    return chunkShape;
+}
 
-        // Determine the increment for the first collapse axes.
-        // This is done by taking the difference between the adresses of two pixels
-        // in the cursor (if there are 2 pixels).
+template <class T, class U>
+void LatticeApply<T,U>::_tiledProcess (
+    TiledCollapser<T,U>& collapser,
+    const Array<T>& cursor, const Array<Bool>& mask, Bool useMask,
+    const IPosition& pos, const IPosition& collapseAxes, uInt collStart,
+    const IPosition& iterAxes, const IPosition& ioMap, uInt resultAxis
+) {
+    uInt j;
+    const uInt inDim = cursor.ndim();
+    const uInt collDim = collapseAxes.nelements();
+    const uInt iterDim = iterAxes.nelements();
+    const IPosition& cursorShape = cursor.shape();
+    IPosition latPos = pos;
 
-	    IPosition chunkShape (inDim, 1);
-	    for (j=0; j<collStart; ++j) {
-	        const uInt axis = collapseAxes(j);
-	        chunkShape(axis) = cursorShape(axis);
-	    }
-	    uInt nval = chunkShape.product();
-	    const uInt axis = collapseAxes(0);
+    // Put the collapsed lines into an output buffer
+    // Initialize the cursor position needed in the loop.
 
-    	IPosition p0(inDim, 0);
-	    IPosition p1(inDim, 0);
-	    p1[axis] = 1;
-	    // general for Arrays with contiguous or non-contiguous storage.
-	    uInt dataIncr = &(cursor(p1)) - &(cursor(p0));
-	    uInt maskIncr = useMask ? &(mask(p1)) - &(mask(p0)) : 0;
+    IPosition curPos (inDim, 0);
 
-        // Iterate in the outer loop through the iterator axes.
-        // Iterate in the inner loop through the collapse axes.
+    // Determine the increment for the first collapse axes.
+    // This is done by taking the difference between the adresses of two pixels
+    // in the cursor (if there are 2 pixels).
 
-	    uInt index1 = 0;
-	    uInt index3 = 0;
+    IPosition chunkShape (inDim, 1);
+    for (j=0; j<collStart; ++j) {
+	    const uInt axis = collapseAxes(j);
+	    chunkShape(axis) = cursorShape(axis);
+    }
+    uInt nval = chunkShape.product();
+    const uInt axis = collapseAxes(0);
+
+    IPosition p0(inDim, 0);
+    IPosition p1(inDim, 0);
+    p1[axis] = 1;
+    // general for Arrays with contiguous or non-contiguous storage.
+    uInt dataIncr = &(cursor(p1)) - &(cursor(p0));
+    uInt maskIncr = useMask ? &(mask(p1)) - &(mask(p0)) : 0;
+
+    // Iterate in the outer loop through the iterator axes.
+    // Iterate in the inner loop through the collapse axes.
+
+    uInt index1 = 0;
+    uInt index3 = 0;
+    for (;;) {
 	    for (;;) {
-	        for (;;) {
-		        if (useMask) {
-		            collapser.process (
-                        index1, index3, &(cursor(curPos)), &(mask(curPos)),
-				        dataIncr, maskIncr, nval, latPos, chunkShape
-                    );
-		        }
-                else {
-		            collapser.process(
-                        index1, index3,
-				        &(cursor(curPos)), 0,
-				        dataIncr, maskIncr, nval, latPos, chunkShape
-                    );
-		        }
-		        // Increment a collapse axis until all axes are handled.
-		        for (j=collStart; j<collDim; ++j) {
-		            uInt axis = collapseAxes(j);
-		            if (++curPos(axis) < cursorShape(axis)) {
-			            break;
-		            }
-		            curPos(axis) = 0;               // restart this axis
-		        }
-		        if (j == collDim) {
-		            break;                          // all axes are handled
+		    if (useMask) {
+		        collapser.process (
+                    index1, index3, &(cursor(curPos)), &(mask(curPos)),
+				    dataIncr, maskIncr, nval, latPos, chunkShape
+                );
+		    }
+            else {
+		        collapser.process(
+                    index1, index3,
+				    &(cursor(curPos)), 0,
+				    dataIncr, maskIncr, nval, latPos, chunkShape
+                );
+		    }
+		    // Increment a collapse axis until all axes are handled.
+		    for (j=collStart; j<collDim; ++j) {
+		        uInt axis = collapseAxes(j);
+		        if (++curPos(axis) < cursorShape(axis)) {
+			        break;
 		        }
-	        }
+		        curPos(axis) = 0;               // restart this axis
+		    }
+		    if (j == collDim) {
+		        break;                          // all axes are handled
+		    }
+	    }
 	
-            // Increment an iteration axis until all iteration axes are handled.
+        // Increment an iteration axis until all iteration axes are handled.
 	
-	        for (j=0; j<iterDim; ++j) {
-		        uInt arraxis = iterAxes(j);
-		        uInt axis = ioMap(arraxis);
-		        ++latPos(axis);
-		        if (++curPos(axis) < cursorShape(axis)) {
-		            if (arraxis < resultAxis) {
-		                ++index1;
-		            }
-                    else {
-		                ++index3;
-			            index1 = 0;
-		            }
-		            break;
+	    for (j=0; j<iterDim; ++j) {
+		    uInt arraxis = iterAxes(j);
+		    uInt axis = ioMap(arraxis);
+		    ++latPos(axis);
+		    if (++curPos(axis) < cursorShape(axis)) {
+		        if (arraxis < resultAxis) {
+		            ++index1;
+		        }
+                else {
+		            ++index3;
+			        index1 = 0;
 		        }
-		        curPos(axis) = 0;
-		        latPos(axis) = pos(axis);
-	        }
-	        if (j == iterDim) {
 		        break;
-	        }
+		    }
+		    curPos(axis) = 0;
+		    latPos(axis) = pos(axis);
+	    }
+	    if (j == iterDim) {
+		    break;
 	    }
-	    ++inIter;
-	    if (tellProgress != 0) {
-            tellProgress->nstepsDone (inIter.nsteps());
-        }
-    }
-
-    // Write out the last output array.
-    Array<U> result;
-    Array<Bool> resultMask;
-    collapser.endAccumulator (result, resultMask, outShape);
-    latticeOut.putSlice (result, outPos);
-    if (maskOut != 0) {
-        maskOut->putSlice (resultMask, outPos);
     }
-    if (tellProgress != 0) tellProgress->done();
 }
 
 
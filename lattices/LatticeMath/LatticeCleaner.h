@@ -229,6 +229,13 @@ public:
   // Helper function to optimize adding
   static void addTo(Lattice<T>& to, const Lattice<T>& add);
 
+  // Add <src>multiplier*add</src> to <src>to</src> in place.
+  // The lines in each cursor chunk are processed in parallel if the chunk
+  // is large enough. It avoids the LatticeExpr evaluation of the scaled
+  // lattice, so it is used to add and subtract the scaled (convolved) PSF
+  // in the minor cycle.
+  static void addTo(Lattice<T>& to, const Lattice<T>& add, T multiplier);
+
 protected:
   // Make sure that the peak of the Psf is within the image
   Bool validatePsf(const Lattice<T> & psf);
@@ -247,6 +254,25 @@ protected:
   Bool findMaxAbsMaskLattice(const Lattice<T>& lattice, const Lattice<T>& mask,
                              T& maxAbs, IPosition& posMax);
 
+  // Find the Peak of an array (usually a lattice cursor). The lines along
+  // the first axis are searched in parallel, where each thread keeps its own
+  // maximum which are reduced at the end. In that way the result is the same
+  // as the one of a serial search, also if the peak is not unique.
+  // <br>If a mask is given, the array values are multiplied with it. If
+  // <src>maskIsWeight</src> is True, the mask values are used as weights
+  // (the peak is determined per line on the product, while its value is
+  // the unweighted one).
+  // <br>It returns False if all values are zero; maxAbs and posMax are
+  // not set in that case.
+  static Bool findMaxAbsArray(const Array<T>& array, const Array<T>* mask,
+                              Bool maskIsWeight,
+                              T& maxAbs, IPosition& posMax);
+
+  // Get the offset (in elements) of the start of the given line (along the
+  // first axis) in an array with the given shape and steps.
+  static Int64 lineOffset(const IPosition& shape, const IPosition& steps,
+                          Int64 line);
+
   // Helper function to reduce the box sizes until the have the same   
   // size keeping the centers intact  
   static void makeBoxesSameSize(IPosition& blc1, IPosition& trc1,                               
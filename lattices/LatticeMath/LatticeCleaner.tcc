@@ -619,8 +619,7 @@ Int LatticeCleaner<T>::clean(Lattice<T>& model,
     SubLattice<T> scaleSub(*itsScales[optimumScale], subRegionPsf, True);
     
     // Now do the addition of this scale to the model image....
-    LatticeExpr<T> add(scaleFactor*scaleSub);
-    addTo(modelSub, add);
+    addTo(modelSub, scaleSub, scaleFactor);
 
     // and then subtract the effects of this scale from all the precomputed
     // dirty convolutions.
@@ -629,8 +628,7 @@ Int LatticeCleaner<T>::clean(Lattice<T>& model,
       AlwaysAssert(itsPsfConvScales[index(scale,optimumScale)], AipsError);
       SubLattice<T> psfSub(*itsPsfConvScales[index(scale,optimumScale)],
 			   subRegionPsf, True);
-      LatticeExpr<T> sub((-scaleFactor)*psfSub);
-      addTo(dirtySub, sub);
+      addTo(dirtySub, psfSub, -scaleFactor);
     }
   }
   // End of iteration
@@ -672,25 +670,20 @@ Bool LatticeCleaner<T>::findMaxAbsLattice(const Lattice<T>& lattice,
 
   posMaxAbs = IPosition(lattice.shape().nelements(), 0);
   maxAbs=0.0;
-  const IPosition tileShape = lattice.niceCursorShape();
-  TiledLineStepper ls(lattice.shape(), tileShape, 0);
+  // Use cursors containing entire lines, so each chunk can be searched
+  // line by line in parallel.
+  IPosition cursorShape = lattice.niceCursorShape();
+  cursorShape(0) = lattice.shape()(0);
+  LatticeStepper ls(lattice.shape(), cursorShape, LatticeStepper::RESIZE);
   {
     RO_LatticeIterator<T> li(lattice, ls);
     for(li.reset();!li.atEnd();li++) {
-      IPosition posMax=li.position();
-      IPosition posMin=li.position();
-      T maxVal=0.0;
-      T minVal=0.0;
-      minMax(minVal, maxVal, posMin, posMax, li.cursor());
-      if(abs(minVal)>abs(maxAbs)) {
-        maxAbs=minVal;
-	posMaxAbs=li.position();
-	posMaxAbs(0)=posMin(0);
-      }
-      if(abs(maxVal)>abs(maxAbs)) {
-        maxAbs=maxVal;
-	posMaxAbs=li.position();
-	posMaxAbs(0)=posMax(0);
+      T val;
+      IPosition pos;
+      if (findMaxAbsArray(li.cursor(), 0, False, val, pos)  &&
+          abs(val)>abs(maxAbs)) {
+        maxAbs=val;
+	posMaxAbs=li.position()+pos;
       }
     }
   }
@@ -710,44 +703,133 @@ Bool LatticeCleaner<T>::findMaxAbsMaskLattice(const Lattice<T>& lattice,
 
   posMaxAbs = IPosition(lattice.shape().nelements(), 0);
   maxAbs=0.0;
-  const IPosition tileShape = lattice.niceCursorShape();
-  TiledLineStepper ls(lattice.shape(), tileShape, 0);
+  IPosition cursorShape = lattice.niceCursorShape();
+  cursorShape(0) = lattice.shape()(0);
+  LatticeStepper ls(lattice.shape(), cursorShape, LatticeStepper::RESIZE);
   {
     RO_LatticeIterator<T> li(lattice, ls);
     RO_LatticeIterator<T> mi(mask, ls);
     for(li.reset(),mi.reset();!li.atEnd();li++, mi++) {
-      IPosition posMax=li.position();
-      IPosition posMin=li.position();
-      IPosition posMaxMask=li.position();
-      IPosition posMinMask=li.position();
-      T maxVal=0.0;
-      T minVal=0.0;
-      
-      minMaxMasked(minVal, maxVal, posMin, posMax, li.cursor(), mi.cursor());
-      if (itsMaskThreshold<0) {
-          // Mask threhsolding is not used, i.e. mask values are interpreted as weights.
-          // This means that minVal and maxVal are optima of the mask * lattice product, 
-          // we need just values of lattice and have to redetermine them.
-          minVal = li.cursor()(posMin);
-          maxVal = li.cursor()(posMax);
+      // If mask thresholding is not used, the mask values are interpreted
+      // as weights. The peak is found on the mask * lattice product, but
+      // its value is taken from the lattice.
+      T val;
+      IPosition pos;
+      if (findMaxAbsArray(li.cursor(), &(mi.cursor()), itsMaskThreshold<0,
+                          val, pos)  &&
+          abs(val)>abs(maxAbs)) {
+         maxAbs=val;
+         posMaxAbs=li.position()+pos;
       }
+    }
+  }
+
+  return True;
+}
 
-      if(abs(minVal)>abs(maxAbs)) {
-         maxAbs=minVal;
-         posMaxAbs=li.position();
-         posMaxAbs(0)=posMin(0);
+template<class T>
+Bool LatticeCleaner<T>::findMaxAbsArray(const Array<T>& array,
+                                        const Array<T>* mask,
+                                        Bool maskIsWeight,
+                                        T& maxAbs,
+                                        IPosition& posMaxAbs)
+{
+  if (array.nelements() == 0) {
+    return False;
+  }
+  if (mask) {
+    AlwaysAssert (mask->shape().isEqual (array.shape()), AipsError);
+  }
+  const IPosition& shape = array.shape();
+  const Int64 nx = shape(0);
+  const Int64 nlines = array.nelements() / nx;
+  const Int64 incArr = array.steps()(0);
+  const Int64 incMask = (mask ? mask->steps()(0) : 0);
+  // The order of a candidate is 2*line for the minimum and 2*line+1 for
+  // the maximum of a line, which is the order a serial search uses.
+  T bestVal = 0;
+  Int64 bestOrder = -1;
+  Int64 bestIndex = 0;
+#ifdef _OPENMP
+#pragma omp parallel if (array.nelements() >= 65536)
+#endif
+  {
+    T thrVal = 0;
+    Int64 thrOrder = -1;
+    Int64 thrIndex = 0;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (Int64 line=0; line<nlines; ++line) {
+      const T* pa = array.data() + lineOffset(shape, array.steps(), line);
+      const T* pm = 0;
+      if (mask) {
+        pm = mask->data() + lineOffset(shape, mask->steps(), line);
+      }
+      // Same as minMax(Masked): first occurrence of minimum and maximum.
+      T minv = (pm ? pa[0]*pm[0] : pa[0]);
+      T maxv = minv;
+      Int64 minp = 0;
+      Int64 maxp = 0;
+      for (Int64 i=1; i<nx; ++i) {
+        T tmp = (pm ? pa[i*incArr] * pm[i*incMask] : pa[i*incArr]);
+        if (tmp < minv) {
+          minv = tmp;
+          minp = i;
+        } else if (tmp > maxv) {
+          maxv = tmp;
+          maxp = i;
+        }
+      }
+      if (pm && maskIsWeight) {
+        minv = pa[minp*incArr];
+        maxv = pa[maxp*incArr];
+      }
+      if (abs(minv) > abs(thrVal)) {
+        thrVal   = minv;
+        thrOrder = 2*line;
+        thrIndex = line*nx + minp;
+      }
+      if (abs(maxv) > abs(thrVal)) {
+        thrVal   = maxv;
+        thrOrder = 2*line + 1;
+        thrIndex = line*nx + maxp;
       }
-      if(abs(maxVal)>abs(maxAbs)) {
-         maxAbs=maxVal;
-         posMaxAbs=li.position();
-         posMaxAbs(0)=posMax(0);
+    }
+    // Reduce the per-thread results; on equal values the first one wins.
+#ifdef _OPENMP
+#pragma omp critical(LatticeCleaner_findMaxAbsArray)
+#endif
+    {
+      if (thrOrder >= 0  &&
+          (abs(thrVal) > abs(bestVal)  ||
+           (abs(thrVal) == abs(bestVal)  &&  thrOrder < bestOrder))) {
+        bestVal   = thrVal;
+        bestOrder = thrOrder;
+        bestIndex = thrIndex;
       }
     }
   }
-
+  if (bestOrder < 0) {
+    return False;
+  }
+  maxAbs = bestVal;
+  posMaxAbs = toIPositionInArray (bestIndex, shape);
   return True;
 }
 
+template<class T>
+Int64 LatticeCleaner<T>::lineOffset(const IPosition& shape,
+                                    const IPosition& steps, Int64 line)
+{
+  Int64 offset = 0;
+  for (uInt i=1; i<shape.nelements(); ++i) {
+    offset += (line % shape(i)) * steps(i);
+    line /= shape(i);
+  }
+  return offset;
+}
+
 
 
 template<class T>
@@ -1188,6 +1270,49 @@ void LatticeCleaner<T>::addTo(Lattice<T>& to, const Lattice<T>& add)
   }
 }
 
+template<class T>
+void LatticeCleaner<T>::addTo(Lattice<T>& to, const Lattice<T>& add,
+                              T multiplier)
+{
+  // Check the lattice is writable.
+  // Check the shape conformance.
+  AlwaysAssert (to.isWritable(), AipsError);
+  const IPosition shapeIn  = add.shape();
+  const IPosition shapeOut = to.shape();
+  AlwaysAssert (shapeIn.isEqual (shapeOut), AipsError);
+  IPosition cursorShape = to.niceCursorShape();
+  LatticeStepper stepper (shapeOut, cursorShape, LatticeStepper::RESIZE);
+  LatticeIterator<T> toIter(to, stepper);
+  RO_LatticeIterator<T> addIter(add, stepper);
+  for (addIter.reset(), toIter.reset(); !addIter.atEnd();
+       addIter++, toIter++) {
+    Array<T>& toArr = toIter.rwCursor();
+    const Array<T>& addArr = addIter.cursor();
+    const IPosition& shape = toArr.shape();
+    const Int64 nx = shape(0);
+    const Int64 nlines = toArr.nelements() / nx;
+    const Int64 incTo  = toArr.steps()(0);
+    const Int64 incAdd = addArr.steps()(0);
+#ifdef _OPENMP
+#pragma omp parallel for if (toArr.nelements() >= 65536)
+#endif
+    for (Int64 line=0; line<nlines; ++line) {
+      T* pt = toArr.data() + lineOffset(shape, toArr.steps(), line);
+      const T* pa = addArr.data() + lineOffset(shape, addArr.steps(), line);
+      if (incTo == 1  &&  incAdd == 1) {
+        // Unit strides, so the compiler can vectorize the loop.
+        for (Int64 i=0; i<nx; ++i) {
+          pt[i] += multiplier * pa[i];
+        }
+      } else {
+        for (Int64 i=0; i<nx; ++i) {
+          pt[i*incTo] += multiplier * pa[i*incAdd];
+        }
+      }
+    }
+  }
+}
+
 template <class T>
 void LatticeCleaner<T>::makeBoxesSameSize(IPosition& blc1, IPosition& trc1, 
                   IPosition &blc2, IPosition& trc2)
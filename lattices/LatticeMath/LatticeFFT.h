@@ -87,6 +87,24 @@ public:
         Lattice<ComplexType> & cLattice, const Bool toFrequency=True
     );
 
+  // N-D in-place complex->complex FFT for Lattices (much) larger than memory.
+  // Each selected axis is transformed by reading slabs that contain entire
+  // lines along the axis and whole tiles along the other axes. All lines
+  // in a slab are transformed in place by a single batched FFTW plan
+  // (which FFTW can execute using multiple threads). In this way each axis
+  // needs only one pass through the Lattice in its natural tile order.
+  // <br>The slab size is limited to <src>maxSlabPixels</src> pixels (but
+  // it always contains at least one tile per line); the default 0 means an
+  // eighth of the free memory.
+  // <br>The origin of the transform is the centre of the Lattice if
+  // doShift is True, otherwise it is the first element.
+  // <br>cfft and cfft0 use this function.
+    template <class ComplexType> static void cfftBlocked(
+        Lattice<ComplexType> & cLattice, const Vector<Bool> & whichAxes,
+        const Bool toFrequency=True, const Bool doShift=True,
+        uInt64 maxSlabPixels=0
+    );
+
   // N-D real->complex FFT. Only one half of the Hermition result is
   // returned. Transforms are only done on selected dimensions. The origin of
   // the transform is the center of the Lattice ie., [nx/2,ny/2,...] if
@@ -144,6 +162,16 @@ public:
         const Bool doShift=True, Bool doFast=False
     );
   // </group>
+
+private:
+  // Do the blocked complex->complex transform of one axis.
+  // If doShift is True, the origin is the centre of the axis. Otherwise it
+  // is the first element, while the result is unflipped if flipAfter is True
+  // (as done by crfft with doFast=True).
+    template <class ComplexType> static void cfftAxis(
+        Lattice<ComplexType> & cLattice, uInt axis, const Bool toFrequency,
+        const Bool doShift, const Bool flipAfter, uInt64 maxSlabPixels
+    );
 };
 
 // implement template specializations to throw exceptions in the relevant cases.
@@ -43,6 +43,7 @@
 #include <casacore/lattices/Lattices/TiledLineStepper.h>
 #include <casacore/casa/OS/HostInfo.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -80,39 +81,93 @@ template <class ComplexType> void LatticeFFT::cfft2d(
 
 template <class ComplexType> void LatticeFFT::cfft(Lattice<ComplexType>& cLattice,
 		     const Vector<Bool>& whichAxes, const Bool toFrequency) {
+  LatticeFFT::cfftBlocked(cLattice, whichAxes, toFrequency, True);
+}
+
+template <class ComplexType> void LatticeFFT::cfft0(Lattice<ComplexType>& cLattice,
+		       const Vector<Bool>& whichAxes, const Bool toFrequency) {
+  LatticeFFT::cfftBlocked(cLattice, whichAxes, toFrequency, False);
+}
+
+template <class ComplexType> void LatticeFFT::cfftBlocked(
+    Lattice<ComplexType>& cLattice, const Vector<Bool>& whichAxes,
+    const Bool toFrequency, const Bool doShift, uInt64 maxSlabPixels) {
   const uInt ndim = cLattice.ndim();
   DebugAssert(ndim > 0, AipsError);
   DebugAssert(ndim == whichAxes.nelements(), AipsError);
-  FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts;
-  const IPosition latticeShape = cLattice.shape();
-  const IPosition tileShape = cLattice.niceCursorShape();
-
   for (uInt dim = 0; dim < ndim; dim++) {
     if (whichAxes(dim) == True) {
-      TiledLineStepper ts(latticeShape, tileShape, dim);
-      LatticeIterator<ComplexType> li(cLattice, ts);
-      for (li.reset(); !li.atEnd(); li++) {
-	ffts.fft(li.rwVectorCursor(), toFrequency);
-      }
+      LatticeFFT::cfftAxis(cLattice, dim, toFrequency, doShift, False,
+                           maxSlabPixels);
     }
   }
 }
 
-template <class ComplexType> void LatticeFFT::cfft0(Lattice<ComplexType>& cLattice,
-		       const Vector<Bool>& whichAxes, const Bool toFrequency) {
-  const uInt ndim = cLattice.ndim();
-  DebugAssert(ndim > 0, AipsError);
-  DebugAssert(ndim == whichAxes.nelements(), AipsError);
-  FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts;
-  const IPosition latticeShape = cLattice.shape();
+template <class ComplexType> void LatticeFFT::cfftAxis(
+    Lattice<ComplexType>& cLattice, uInt axis, const Bool toFrequency,
+    const Bool doShift, const Bool flipAfter, uInt64 maxSlabPixels) {
+  typedef typename NumericTraits<ComplexType>::ConjugateType RealType;
+  const IPosition& latticeShape = cLattice.shape();
+  const uInt ndim = latticeShape.nelements();
+  const uInt n = latticeShape(axis);
+  // A transform of length 1 does not change the data.
+  if (n <= 1) {
+    return;
+  }
+  if (maxSlabPixels == 0) {
+    // use an eighth of the free memory (which is given in KB), because
+    // the slab can be copied (by the iterator and for measured FFTW plans)
+    maxSlabPixels = (HostInfo::memoryFree()/(sizeof(ComplexType)*8))*1024;
+  }
+  // The slab contains entire lines along the axis and whole tiles along
+  // the other axes. It is extended (first along the fastest varying axes)
+  // as far as the memory limit permits.
   const IPosition tileShape = cLattice.niceCursorShape();
-
-  for (uInt dim = 0; dim < ndim; dim++) {
-    if (whichAxes(dim) == True) {
-      TiledLineStepper ts(latticeShape, tileShape, dim);
-      LatticeIterator<ComplexType> li(cLattice, ts);
-      for (li.reset(); !li.atEnd(); li++) {
-	ffts.fft0(li.rwVectorCursor(), toFrequency);
+  IPosition slabShape(ndim);
+  for (uInt k = 0; k < ndim; k++) {
+    slabShape(k) = std::min(tileShape(k), latticeShape(k));
+  }
+  slabShape(axis) = n;
+  for (uInt k = 0; k < ndim; k++) {
+    if (k != axis) {
+      const uInt64 rest = slabShape.product() / slabShape(k);
+      const uInt64 nTiles = std::max(maxSlabPixels / rest / slabShape(k),
+                                     uInt64(1));
+      slabShape(k) = std::min(ssize_t(nTiles * slabShape(k)), latticeShape(k));
+      if (slabShape(k) < latticeShape(k)) {
+        break;
+      }
+    }
+  }
+  // All lines of a slab are transformed by a single batched (guru) FFTW
+  // plan, which strides through the slab itself, so the lines do not need
+  // to be transposed. FFTW parallelizes the batch using its own threads.
+  FFTServer<RealType,ComplexType> ffts;
+  LatticeStepper stepper(latticeShape, slabShape, LatticeStepper::RESIZE);
+  LatticeIterator<ComplexType> li(cLattice, stepper);
+  for (li.reset(); !li.atEnd(); li++) {
+    Array<ComplexType>& slab = li.rwCursor();
+    if (doShift) {
+      ffts.fftLines(slab, axis, toFrequency);
+    } else {
+      ffts.fft0Lines(slab, axis, toFrequency);
+      if (flipAfter) {
+        // Flip each block of lines (preceded by the axes before them) as
+        // a Hermitian array, so only the transformed axis is flipped.
+        const IPosition& shape = slab.shape();
+        uInt64 stride = 1;
+        for (uInt k = 0; k < axis; k++) {
+          stride *= shape(k);
+        }
+        const uInt64 nOuter = shape.product() / (stride * n);
+        Bool deleteIt;
+        ComplexType* data = slab.getStorage(deleteIt);
+        for (uInt64 i = 0; i < nOuter; i++) {
+          Array<ComplexType> block(IPosition(2, stride, n),
+                                   data + i * stride * n, SHARE);
+          ffts.flip(block, False, True);
+        }
+        slab.putStorage(data, deleteIt);
       }
     }
   }
@@ -185,21 +240,7 @@ template <class ComplexType> void LatticeFFT::rcfft(
 	  }
 	  else { // Do complex->complex transforms
 	    if (inShape(dim) != 1) { 
-	      LatticeIterator<ComplexType> iter(out,
-					    TiledLineStepper(outShape,
-							     tileShape, dim));
-	      for (iter.reset(); !iter.atEnd(); iter++) {
-		if (doShift) {
-		  if(doFast){
-		    ffts.fft0(iter.rwVectorCursor(),True);
-		  }
-		  else{
-		    ffts.fft(iter.rwVectorCursor(),True);
-		  }
-		} else {
-		  ffts.fft0(iter.rwVectorCursor(), True);
-		}
-	      }
+	      LatticeFFT::cfftAxis(out, dim, True, doShift && !doFast, False, 0);
 	    }
 	  }
 	}
@@ -329,22 +370,8 @@ template <class ComplexType> void LatticeFFT::crfft(
     if (whichAxes(dim) == True) {
       if (dim != firstAxis) { // Do complex->complex Transforms
 	if (inShape(dim) != 1) { // no need to do anything unless len > 1
-	  LatticeIterator<ComplexType> iter(in, TiledLineStepper(inShape,
-							     tileShape, dim));
-	  for (iter.reset(); !iter.atEnd(); iter++) {
-	    if (doShift) {
-	      if(doFast){
-		ffts.fft0(iter.rwVectorCursor(), False);
-		ffts.flip(iter.rwVectorCursor(), False, False);
-	      }
-	      else{
-	      //	      ffts.fft(iter.rwVectorCursor(), 2, False);
-	      ffts.fft(iter.rwVectorCursor(),False);
-	      }
-	    } else {
-	      ffts.fft0(iter.rwVectorCursor(), False);
-	    }
-	  }
+	  LatticeFFT::cfftAxis(in, dim, False, doShift && !doFast,
+			       doShift && doFast, 0);
 	}
       } else { // the first axis is treated specially
 	if (inShape(dim) != 1) { // Do complex->real transforms
@@ -109,6 +109,17 @@ public:
 // optimization.
     virtual Bool canHandleNullMask() const;
 
+// Make a copy of the collapser to be used by another thread.
+// LatticeApply uses the copies to process disjoint parts of the lattice
+// in parallel, each by its own copy. The copy must not share modifiable
+// state with this object. If LatticeApply calls <src>init</src>, it does
+// so for the copies as well.
+// <br>The default implementation returns a null pointer, which means that
+// the collapser cannot be copied, so LatticeApply processes serially.
+// Note that no LineCollapser in casacore implements it, so derived classes
+// elsewhere have to do so to benefit from parallel processing.
+    virtual LineCollapser<T,U>* clone() const;
+
 // Collapse the given line and return one value from that operation.
 // The position in the Lattice at the start of the line is input
 // as well.
@@ -176,8 +176,6 @@ private:
   TempLattice<Complex>* cWork_p;
   TempLattice<Float>* tWork_p;
   LatticeIterator<Float>* itertWork_p;
-  
-  LatticeExprNode len_p;
 
   Float lambda_p;
   
@@ -69,6 +69,8 @@
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/scimath/Mathematics/MatrixMathLA.h>
 
+#include <vector>
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 #define MIN(a,b) ((a)<=(b) ? (a) : (b))
@@ -626,25 +628,13 @@ Int MultiTermLatticeCleaner<T>::manageMemory(Bool direction)
 }
 
 /*************************************
- *    Add two subLattices..      -- same code as in copyData.   
+ *    Add a scaled subLattice to another one.
  *************************************/
 template <class T>
 Int MultiTermLatticeCleaner<T>::addTo(Lattice<Float>& to, const Lattice<Float>& add, Float multiplier)
 {
-	// Check the lattice is writable.
-	// Check the shape conformance.
-	AlwaysAssert (to.isWritable(), AipsError);
-	const IPosition shapeIn  = add.shape();
-	const IPosition shapeOut = to.shape();
-	AlwaysAssert (shapeIn.isEqual (shapeOut), AipsError);
-	IPosition cursorShape = to.niceCursorShape();
-	LatticeStepper stepper (shapeOut, cursorShape, LatticeStepper::RESIZE);
-	LatticeIterator<Float> toIter(to, stepper);
-	RO_LatticeIterator<Float> addIter(add, stepper);
-	for (addIter.reset(), toIter.reset(); !addIter.atEnd();addIter++, toIter++) 
-	{
-		toIter.rwCursor()+=addIter.cursor()*multiplier;
-	}
+	// The lines of each chunk are added in parallel.
+	LatticeCleaner<T>::addTo(to, add, multiplier);
 	return 0;
 }
 
@@ -1006,15 +996,48 @@ Int MultiTermLatticeCleaner<T>::computeFluxLimit(Float &fluxlimit, Float thresho
 template <class T>
 Int MultiTermLatticeCleaner<T>::solveMatrixEqn(Int scale)
 {
-	/* Solve for the coefficients */
-	for(Int taylor1=0;taylor1<ntaylor_p;taylor1++)
+	/* Solve for the coefficients, pixel by pixel in parallel */
+	Matrix<Float> invA(ntaylor_p,ntaylor_p);
+	convertArray(invA, *invMatA_p[scale]);
+	
+	for(Int taylor=0;taylor<ntaylor_p;taylor++)
+	{
+		itermatR_p[IND2(taylor,scale)]->reset();
+		itermatCoeffs_p[IND2(taylor,scale)]->reset();
+	}
+	
+	std::vector<const Float*> resid(ntaylor_p);
+	std::vector<Float*> coeffs(ntaylor_p);
+	Block<Bool> delResid(ntaylor_p), delCoeffs(ntaylor_p);
+	
+	while(!itermatR_p[IND2(0,scale)]->atEnd())
 	{
-		len_p = LatticeExprNode(0.0);
-		for(Int taylor2=0;taylor2<ntaylor_p;taylor2++)
+		const Int64 n = itermatR_p[IND2(0,scale)]->cursor().nelements();
+		for(Int taylor=0;taylor<ntaylor_p;taylor++)
+		{
+			resid[taylor] = itermatR_p[IND2(taylor,scale)]->cursor().getStorage(delResid[taylor]);
+			coeffs[taylor] = itermatCoeffs_p[IND2(taylor,scale)]->rwCursor().getStorage(delCoeffs[taylor]);
+		}
+#ifdef _OPENMP
+#pragma omp parallel for if (n >= 65536)
+#endif
+		for(Int64 i=0;i<n;i++)
+		{
+			for(Int taylor1=0;taylor1<ntaylor_p;taylor1++)
+			{
+				Double val = 0.0;
+				for(Int taylor2=0;taylor2<ntaylor_p;taylor2++)
+					val += invA(taylor1,taylor2)*resid[taylor2][i];
+				coeffs[taylor1][i] = val;
+			}
+		}
+		for(Int taylor=0;taylor<ntaylor_p;taylor++)
 		{
-			len_p = len_p + LatticeExprNode((Float)(*invMatA_p[scale])(taylor1,taylor2)*(*matR_p[IND2(taylor2,scale)]));
+			itermatR_p[IND2(taylor,scale)]->cursor().freeStorage(resid[taylor],delResid[taylor]);
+			itermatCoeffs_p[IND2(taylor,scale)]->rwCursor().putStorage(coeffs[taylor],delCoeffs[taylor]);
+			(*itermatR_p[IND2(taylor,scale)])++;
+			(*itermatCoeffs_p[IND2(taylor,scale)])++;
 		}
-		(*matCoeffs_p[IND2(taylor1,scale)]).copyData(LatticeExpr<Float>(len_p));
 	}
 	
 	return 0;
@@ -1032,16 +1055,45 @@ Int MultiTermLatticeCleaner<T>::computePenaltyFunction(Int scale, Float &loopgai
 	for(Int i=0;i<(Int)itercubeA_p.nelements();i++) itercubeA_p[i]->reset();
 	for(Int i=0;i<(Int)itermatR_p.nelements();i++) itermatR_p[i]->reset();
 	
+	/* Pointers to the chunk data of this scale; the pixels are done in parallel */
+	std::vector<const Float*> coeffs(ntaylor_p), resid(ntaylor_p), cubeA(ntaylor_p*ntaylor_p);
+	Block<Bool> delCoeffs(ntaylor_p), delResid(ntaylor_p), delCubeA(ntaylor_p*ntaylor_p);
+	
 	for(itertWork_p->reset(); !(itertWork_p->atEnd()); (*itertWork_p)++)
 	{
+		Bool delWork;
+		Float* work = itertWork_p->rwCursor().getStorage(delWork);
+		const Int64 n = itertWork_p->rwCursor().nelements();
 		if(choosespec)
 		{
 			for(Int taylor1=0;taylor1<ntaylor_p;taylor1++)
 			{
-				itertWork_p->rwCursor() += (Float)2.0*((itermatCoeffs_p[IND2(taylor1,scale)])->rwCursor())*((itermatR_p[IND2(taylor1,scale)])->rwCursor());
-				
+				coeffs[taylor1] = itermatCoeffs_p[IND2(taylor1,scale)]->cursor().getStorage(delCoeffs[taylor1]);
+				resid[taylor1] = itermatR_p[IND2(taylor1,scale)]->cursor().getStorage(delResid[taylor1]);
 				for(Int taylor2=0;taylor2<ntaylor_p;taylor2++)
-					itertWork_p->rwCursor() -= ((itermatCoeffs_p[IND2(taylor1,scale)])->rwCursor())*((itermatCoeffs_p[IND2(taylor2,scale)])->rwCursor())*((itercubeA_p[IND4(taylor1,taylor2,scale,scale)])->rwCursor());
+					cubeA[taylor1*ntaylor_p+taylor2] = itercubeA_p[IND4(taylor1,taylor2,scale,scale)]->cursor().getStorage(delCubeA[taylor1*ntaylor_p+taylor2]);
+			}
+#ifdef _OPENMP
+#pragma omp parallel for if (n >= 65536)
+#endif
+			for(Int64 i=0;i<n;i++)
+			{
+				Float val = work[i];
+				for(Int taylor1=0;taylor1<ntaylor_p;taylor1++)
+				{
+					val += (Float)2.0*coeffs[taylor1][i]*resid[taylor1][i];
+					
+					for(Int taylor2=0;taylor2<ntaylor_p;taylor2++)
+						val -= coeffs[taylor1][i]*coeffs[taylor2][i]*cubeA[taylor1*ntaylor_p+taylor2][i];
+				}
+				work[i] = val;
+			}
+			for(Int taylor1=0;taylor1<ntaylor_p;taylor1++)
+			{
+				itermatCoeffs_p[IND2(taylor1,scale)]->cursor().freeStorage(coeffs[taylor1],delCoeffs[taylor1]);
+				itermatR_p[IND2(taylor1,scale)]->cursor().freeStorage(resid[taylor1],delResid[taylor1]);
+				for(Int taylor2=0;taylor2<ntaylor_p;taylor2++)
+					itercubeA_p[IND4(taylor1,taylor2,scale,scale)]->cursor().freeStorage(cubeA[taylor1*ntaylor_p+taylor2],delCubeA[taylor1*ntaylor_p+taylor2]);
 			}
 			// Constrain location too, based on the I0 flux being > thresh*5 or something..
 		}
@@ -1049,8 +1101,15 @@ Int MultiTermLatticeCleaner<T>::computePenaltyFunction(Int scale, Float &loopgai
 		{
 			if(loopgain > 0.5) loopgain*=0.5;
 			Float norm = sqrt((1.0/(*matA_p[scale])(0,0)));
-			itertWork_p->rwCursor() += norm*((itermatR_p[IND2(0,scale)])->rwCursor());
+			resid[0] = itermatR_p[IND2(0,scale)]->cursor().getStorage(delResid[0]);
+			const Float* resid0 = resid[0];
+#ifdef _OPENMP
+#pragma omp parallel for if (n >= 65536)
+#endif
+			for(Int64 i=0;i<n;i++) work[i] += norm*resid0[i];
+			itermatR_p[IND2(0,scale)]->cursor().freeStorage(resid[0],delResid[0]);
 		}
+		itertWork_p->rwCursor().putStorage(work,delWork);
 		for(Int i=0;i<(Int)itermatCoeffs_p.nelements();i++) (*itermatCoeffs_p[i])++;
 		for(Int i=0;i<(Int)itercubeA_p.nelements();i++) (*itercubeA_p[i])++;
 		for(Int i=0;i<(Int)itermatR_p.nelements();i++) (*itermatR_p[i])++;
@@ -1189,36 +1248,61 @@ Bool MultiTermLatticeCleaner<T>::findMaxAbsLattice(const TempLattice<Float>& mas
 
   AlwaysAssert(masklat.shape()==lattice.shape(), AipsError);
 
-  Array<Float> msk;
-  
   posMaxAbs = IPosition(lattice.shape().nelements(), 0);
   maxAbs=0.0;
   //maxAbs=-1.0e+10;
-  const IPosition tileShape = lattice.niceCursorShape();
-  TiledLineStepper ls(lattice.shape(), tileShape, 0);
-  TiledLineStepper lsm(masklat.shape(), tileShape, 0);
+  const IPosition cursorShape = lattice.niceCursorShape();
+  LatticeStepper ls(lattice.shape(), cursorShape, LatticeStepper::RESIZE);
   {
     RO_LatticeIterator<Float> li(lattice, ls);
-    RO_LatticeIterator<Float> lim(masklat, lsm);
+    RO_LatticeIterator<Float> lim(masklat, ls);
     for(li.reset(),lim.reset();!li.atEnd();li++,lim++) 
     {
-      IPosition posMax=li.position();
-      IPosition posMin=li.position();
-      Float maxVal=0.0;
-      Float minVal=0.0;
-      
-      msk = lim.cursor();
-      if(flip) msk = (Float)1.0 - msk;
-      
-      //minMaxMasked(minVal, maxVal, posMin, posMax, li.cursor(),lim.cursor());
-      minMaxMasked(minVal, maxVal, posMin, posMax, li.cursor(),msk);
+      Bool delData, delMask;
+      const Float* data = li.cursor().getStorage(delData);
+      const Float* msk = lim.cursor().getStorage(delMask);
+      const Int64 n = li.cursor().nelements();
       
+      /* Maximum of the masked values; each thread keeps its own (first)
+         maximum, which are reduced afterwards. */
+      Float maxVal = maxAbs;
+      Int64 maxInx = -1;
+#ifdef _OPENMP
+#pragma omp parallel if (n >= 65536)
+#endif
+      {
+        Float thrVal = maxAbs;
+        Int64 thrInx = -1;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(Int64 i=0;i<n;i++)
+        {
+          Float val = data[i] * (flip ? (Float)1.0-msk[i] : msk[i]);
+          if(val > thrVal)
+          {
+            thrVal = val;
+            thrInx = i;
+          }
+        }
+#ifdef _OPENMP
+#pragma omp critical(MultiTermLatticeCleaner_findMaxAbsLattice)
+#endif
+        {
+          if(thrInx >= 0 && (thrVal > maxVal || (thrVal == maxVal && thrInx < maxInx)))
+          {
+            maxVal = thrVal;
+            maxInx = thrInx;
+          }
+        }
+      }
+      li.cursor().freeStorage(data, delData);
+      lim.cursor().freeStorage(msk, delMask);
       
-      if((maxVal)>(maxAbs)) 
+      if(maxInx >= 0) 
       {
         maxAbs=maxVal;
-	posMaxAbs=li.position();
-	posMaxAbs(0)=posMax(0);
+	posMaxAbs=li.position()+toIPositionInArray(maxInx, li.cursor().shape());
       }
     }
   }
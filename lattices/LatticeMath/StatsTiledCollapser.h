@@ -122,6 +122,13 @@ public:
 
     virtual ~StatsTiledCollapser() {}
 
+    // Make a copy with the same pixel selection to be used by another
+    // thread. The accumulator and min/max positions are not copied.
+    virtual StatsTiledCollapser<T,U>* clone() const;
+
+    // Merge the min/max positions found by a copy made by <src>clone</src>.
+    virtual void merge (const TiledCollapser<T,U>& other);
+
     // Initialize process, making some checks
     virtual void init (uInt nOutPixelsPerCollapse);
 
@@ -146,13 +153,24 @@ public:
     virtual Bool canHandleNullMask() const {return True;};
 
     // Find the location of the minimum and maximum data values
-    // in the input lattice.
+    // in the input lattice. Ties between the positions found for different
+    // output pixels are broken on the position (the first one in the lattice
+    // is taken), so the result does not depend on the number of threads.
      void minMaxPos(IPosition& minPos, IPosition& maxPos);
 
 private:
+    // Tell if the value at the given position replaces the current minimum
+    // (if <src>isMin</src>) or maximum. Ties are broken on the position.
+    static Bool _isBetter(
+        T value, const IPosition& pos, T curValue, const IPosition& curPos,
+        Bool isMin
+    );
+
     Vector<T> _range;
     Bool _include, _exclude, _fixedMinMax, _isReal;
     IPosition _minpos, _maxpos;
+    // The data values at _minpos and _maxpos
+    T _minposValue, _maxposValue;
 
     // Accumulators for sum, sum squared, number of points
     // minimum, and maximum
@@ -37,7 +37,36 @@ StatsTiledCollapser<T,U>::StatsTiledCollapser(
 ) : _range(pixelRange), _include(! noInclude),
     _exclude(! noExclude), _fixedMinMax(fixedMinMax),
     _isReal(isReal(whatType<T>())),
-    _minpos(0), _maxpos(0) {}
+    _minpos(0), _maxpos(0), _minposValue(0), _maxposValue(0) {}
+
+template <class T, class U>
+StatsTiledCollapser<T,U>* StatsTiledCollapser<T,U>::clone() const {
+    return new StatsTiledCollapser<T,U>(
+        _range, ! _include, ! _exclude, _fixedMinMax
+    );
+}
+
+template <class T, class U>
+void StatsTiledCollapser<T,U>::merge (const TiledCollapser<T,U>& other) {
+    const StatsTiledCollapser<T,U>& that =
+        dynamic_cast<const StatsTiledCollapser<T,U>&>(other);
+    if (! that._minpos.empty()
+        && _isBetter(that._minposValue, that._minpos,
+                     _minposValue, _minpos, True)
+    ) {
+        _minpos.resize(that._minpos.size());
+        _minpos = that._minpos;
+        _minposValue = that._minposValue;
+    }
+    if (! that._maxpos.empty()
+        && _isBetter(that._maxposValue, that._maxpos,
+                     _maxposValue, _maxpos, False)
+    ) {
+        _maxpos.resize(that._maxpos.size());
+        _maxpos = that._maxpos;
+        _maxposValue = that._maxposValue;
+    }
+}
 
 template <class T, class U>
 void StatsTiledCollapser<T,U>::init (uInt nOutPixelsPerCollapse) {
@@ -84,6 +113,7 @@ void StatsTiledCollapser<T,U>::process (
     // chunk belongs in one output location in the storage
     // lattices
     uInt64 index = index1 + index3*_n1;
+    const T* pData = pInData;
     U& sum = (*_sum)[index];
     U& sumSq = (*_sumSq)[index];
     Double& nPts = (*_npts)[index];
@@ -188,15 +218,50 @@ void StatsTiledCollapser<T,U>::process (
     // Update overall min and max location.  These are never updated
     // if fixedMinMax is true.  These values are only meaningful for
     // Float images.  For Complex they are useless currently.
+    // The values are kept to find the overall extremes over all chunks
+    // (also when merging the results of the clones).
 
     if (_isReal) {
         if (minLoc != -1) {
-            _minpos = startPos + toIPositionInArray(minLoc, shape);
+            T value = pData[minLoc*dataIncr];
+            IPosition pos = startPos + toIPositionInArray(minLoc, shape);
+            if (_isBetter(value, pos, _minposValue, _minpos, True)) {
+                _minpos.resize(pos.size());
+                _minpos = pos;
+                _minposValue = value;
+            }
         }
         if (maxLoc != -1) {
-            _maxpos = startPos + toIPositionInArray(maxLoc, shape);
+            T value = pData[maxLoc*dataIncr];
+            IPosition pos = startPos + toIPositionInArray(maxLoc, shape);
+            if (_isBetter(value, pos, _maxposValue, _maxpos, False)) {
+                _maxpos.resize(pos.size());
+                _maxpos = pos;
+                _maxposValue = value;
+            }
+        }
+    }
+}
+
+template <class T, class U>
+Bool StatsTiledCollapser<T,U>::_isBetter(
+    T value, const IPosition& pos, T curValue, const IPosition& curPos,
+    Bool isMin
+) {
+    if (curPos.empty()) {
+        return True;
+    }
+    if (value != curValue) {
+        return isMin ? value < curValue : value > curValue;
+    }
+    // Equal values; take the position that comes first in the lattice,
+    // so the result does not depend on the order the chunks are processed.
+    for (Int i=Int(pos.size())-1; i>=0; --i) {
+        if (pos[i] != curPos[i]) {
+            return pos[i] < curPos[i];
         }
     }
+    return False;
 }
 
 template <class T, class U>
@@ -113,6 +113,22 @@ public:
 // optimization.
     virtual Bool canHandleNullMask() const;
 
+// Make a copy of the collapser to be used by another thread.
+// LatticeApply uses the copies to process disjoint parts of the lattice
+// in parallel, each by its own copy. The copy must not share modifiable
+// state with this object. If LatticeApply calls <src>init</src>, it does
+// so for the copies as well.
+// <br>The default implementation returns a null pointer, which means that
+// the collapser cannot be copied, so LatticeApply processes serially.
+    virtual TiledCollapser<T,U>* clone() const;
+
+// Merge the state kept by a copy made by <src>clone</src> into this object.
+// LatticeApply calls it for each copy after all data have been processed.
+// It is only needed for state outside the accumulator (which is returned
+// by <src>endAccumulator</src>), such as the position of the minimum.
+// <br>The default implementation does nothing.
+    virtual void merge (const TiledCollapser<T,U>& other);
+
 // Create and initialize the accumulator.
 // The accumulator can be a cube with shape [n1,n2,n3],
 // where <src>n2</src> is equal to <src>nOutPixelsPerCollapse</src>.
@@ -42,6 +42,16 @@ Bool TiledCollapser<T,U>::canHandleNullMask() const
     return False;
 }
 
+template<class T, class U>
+TiledCollapser<T,U>* TiledCollapser<T,U>::clone() const
+{
+    return 0;
+}
+
+template<class T, class U>
+void TiledCollapser<T,U>::merge (const TiledCollapser<T,U>&)
+{}
+
 } //# NAMESPACE CASACORE - END
 
 
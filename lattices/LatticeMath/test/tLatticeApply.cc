@@ -54,6 +54,9 @@ class MyLineCollapser : public LineCollapser<Int>
 {
 public:
     MyLineCollapser() {}
+    // Make it possible to collapse in parallel.
+    virtual MyLineCollapser* clone() const
+      { return new MyLineCollapser(); }
     virtual void init (uInt nOutPixelsPerCollapse);
     virtual Bool canHandleNullMask() const;
     virtual void process (Int& result, Bool& resultMask,
@@ -120,6 +123,9 @@ class MyTiledCollapser : public TiledCollapser<Int>
 public:
     MyTiledCollapser() : itsSum1(0),itsSum2(0),itsNpts(0) {}
     virtual ~MyTiledCollapser();
+    // Make it possible to collapse in parallel.
+    virtual MyTiledCollapser* clone() const
+      { return new MyTiledCollapser(); }
     virtual void init (uInt nOutPixelsPerCollapse);
     virtual Bool canHandleNullMask() const;
     virtual void initAccumulator (uInt64 n1, uInt64 n3);
@@ -0,0 +1,210 @@
+//# tLatticeCleaner.cc: Test program for class LatticeCleaner
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Quanta/Quantum.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/lattices/LatticeMath/LatticeCleaner.h>
+#include <casacore/lattices/LatticeMath/MultiTermLatticeCleaner.h>
+#include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/SubLattice.h>
+#include <casacore/lattices/LRegions/LCBox.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Fill the array with a Gaussian with the given peak at the given position.
+void addGaussian (Array<Float>& arr, Float peak, const IPosition& pos,
+                  Float width)
+{
+  Matrix<Float> mat(arr.nonDegenerate());
+  for (Int j=0; j<Int(mat.ncolumn()); ++j) {
+    for (Int i=0; i<Int(mat.nrow()); ++i) {
+      Float dx = (i - pos(0)) / width;
+      Float dy = (j - pos(1)) / width;
+      mat(i,j) += peak * exp(-(dx*dx + dy*dy));
+    }
+  }
+}
+
+void testAddTo()
+{
+  // Add a scaled window (non-contiguous) to a window of another lattice;
+  // it is large enough to be done in parallel.
+  IPosition shape(2, 600, 400);
+  Array<Float> toArr(shape);
+  Array<Float> addArr(shape);
+  indgen (toArr);
+  indgen (addArr, Float(3), Float(0.5));
+  Array<Float> expArr(toArr.copy());
+  ArrayLattice<Float> toLat(toArr);
+  ArrayLattice<Float> addLat(addArr);
+  IPosition blc1(2, 10, 20);
+  IPosition blc2(2, 50, 5);
+  IPosition len(2, 520, 350);
+  SubLattice<Float> toSub(toLat, LCBox(blc1, blc1+len-1, shape), True);
+  SubLattice<Float> addSub(addLat, LCBox(blc2, blc2+len-1, shape));
+  LatticeCleaner<Float>::addTo (toSub, addSub, Float(-0.25));
+  Array<Float> expSub(expArr(blc1, blc1+len-1));
+  expSub -= Float(0.25) * addArr(blc2, blc2+len-1);
+  AlwaysAssert (allNear(toArr, expArr, 1e-6), AipsError);
+}
+
+void doClean (Array<Float>& model, const IPosition& shape,
+              CleanEnums::CleanType type)
+{
+  IPosition centre(shape/2);
+  Array<Float> psf(shape);
+  psf = 0;
+  addGaussian (psf, 1, centre, 2);
+  Array<Float> dirty(shape);
+  dirty = 0;
+  addGaussian (dirty, 2, IPosition(2, 200, 280), 2);
+  addGaussian (dirty, -1.5, IPosition(2, 320, 180), 2);
+  ArrayLattice<Float> psfLat(psf);
+  ArrayLattice<Float> dirtyLat(dirty);
+  LatticeCleaner<Float> cleaner(psfLat, dirtyLat);
+  if (type == CleanEnums::MULTISCALE) {
+    cleaner.setscales (2, 3.0);
+  } else {
+    cleaner.setscales (1);
+  }
+  cleaner.setcontrol (type, 500, 0.2, Quantity(1e-3, "Jy"), False);
+  model.resize (shape);
+  model = 0;
+  ArrayLattice<Float> modelLat(model);
+  cleaner.clean (modelLat);
+  AlwaysAssert (cleaner.iteration() > 0, AipsError);
+}
+
+void testClean (CleanEnums::CleanType type)
+{
+  // Use an image large enough for the minor cycle to run in parallel.
+  IPosition shape(2, 512, 512);
+  Array<Float> model;
+  doClean (model, shape, type);
+  // Most flux should be found at the source positions.
+  AlwaysAssert (near(sum(model(IPosition(2,198,278), IPosition(2,202,282))),
+                     Float(2), 0.05), AipsError);
+  AlwaysAssert (near(sum(model(IPosition(2,318,178), IPosition(2,322,182))),
+                     Float(-1.5), 0.05), AipsError);
+  // The result must not depend on the number of threads.
+  uInt nthr = OMP::maxThreads();
+  if (nthr > 1) {
+    OMP::setNumThreads (1);
+    Array<Float> model1;
+    doClean (model1, shape, type);
+    OMP::setNumThreads (nthr);
+    AlwaysAssert (allEQ(model, model1), AipsError);
+  }
+}
+
+void doMTClean (Array<Float>& model0, Array<Float>& model1,
+                const IPosition& shape)
+{
+  // The Taylor term PSFs are scaled copies of a Gaussian; its matrix A
+  // [[1,0.2],[0.2,0.1]] is invertible. The dirty images are made from a
+  // point source with Taylor coefficients 2 and -0.5 (I_k = sum_j B_k+j I_j).
+  const Float coeff[3] = {1, 0.2, 0.1};
+  const Float flux[2] = {2, -0.5};
+  IPosition centre(shape/2);
+  IPosition srcPos(4, 100, 140, 0, 0);
+  MultiTermLatticeCleaner<Float> cleaner;
+  cleaner.setscales (Vector<Float>(1, 0));
+  cleaner.setntaylorterms (2);
+  cleaner.initialise (shape(0), shape(1));
+  for (Int i=0; i<3; ++i) {
+    Array<Float> psf(shape);
+    psf = 0;
+    addGaussian (psf, coeff[i], centre, 2);
+    ArrayLattice<Float> psfLat(psf);
+    cleaner.setpsf (i, psfLat);
+  }
+  for (Int i=0; i<2; ++i) {
+    Array<Float> dirty(shape);
+    dirty = 0;
+    addGaussian (dirty, coeff[i]*flux[0] + coeff[i+1]*flux[1], srcPos, 2);
+    ArrayLattice<Float> dirtyLat(dirty);
+    cleaner.setresidual (i, dirtyLat);
+  }
+  cleaner.setcontrol (CleanEnums::MULTISCALE, 200, 0.5, Quantity(1e-3, "Jy"),
+                      True);
+  cleaner.mtclean();
+  model0.resize (shape);
+  model1.resize (shape);
+  ArrayLattice<Float> model0Lat(model0);
+  ArrayLattice<Float> model1Lat(model1);
+  cleaner.getmodel (0, model0Lat);
+  cleaner.getmodel (1, model1Lat);
+}
+
+void testMTClean()
+{
+  // Use an image large enough for the matrix solve, penalty function
+  // and peak search to run in parallel.
+  IPosition shape(4, 256, 256, 1, 1);
+  Array<Float> model0, model1;
+  doMTClean (model0, model1, shape);
+  // The minor cycle stops at the flux limit (10% of the peak) after 4
+  // iterations with gain 0.5, so a fraction 1-0.5^4 of the Taylor
+  // coefficients of the source must be found at its position.
+  IPosition pos(4, 100, 140, 0, 0);
+  AlwaysAssert (near(model0(pos), Float(2*0.9375), 1e-4), AipsError);
+  AlwaysAssert (near(model1(pos), Float(-0.5*0.9375), 1e-4), AipsError);
+  AlwaysAssert (near(sum(model0), model0(pos), 1e-4), AipsError);
+  AlwaysAssert (near(sum(model1), model1(pos), 1e-4), AipsError);
+  // The result must not depend on the number of threads.
+  uInt nthr = OMP::maxThreads();
+  if (nthr > 1) {
+    OMP::setNumThreads (1);
+    Array<Float> model0s, model1s;
+    doMTClean (model0s, model1s, shape);
+    OMP::setNumThreads (nthr);
+    AlwaysAssert (allEQ(model0, model0s), AipsError);
+    AlwaysAssert (allEQ(model1, model1s), AipsError);
+  }
+}
+
+int main()
+{
+  try {
+    testAddTo();
+    testClean (CleanEnums::HOGBOM);
+    testClean (CleanEnums::MULTISCALE);
+    testMTClean();
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
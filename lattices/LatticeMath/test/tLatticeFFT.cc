@@ -34,6 +34,9 @@
 #include <casacore/lattices/LatticeMath/LatticeFFT.h>
 #include <casacore/lattices/Lattices/LatticeIterator.h>
 #include <casacore/lattices/Lattices/PagedArray.h>
+#include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/TiledShape.h>
+#include <casacore/scimath/Mathematics/FFTServer.h>
 #include <casacore/casa/iostream.h>
 
 #include <casacore/casa/namespace.h>
@@ -174,6 +177,32 @@ int main() {
  	}
       }
     }
+    { // test the blocked fft with slabs smaller than the lattice
+      const IPosition shape(3, 10, 12, 3);
+      PagedArray<Complex> cArr(TiledShape(shape, IPosition(3, 4, 5, 2)));
+      Array<Complex> arr(shape);
+      uInt i = 0;
+      for (Array<Complex>::iterator iter=arr.begin(); iter!=arr.end(); ++iter) {
+	*iter = Complex((i%7)*0.1, (i%5)*0.1);
+	i++;
+      }
+      cArr.put(arr);
+      Vector<Bool> whichAxes(3, True);
+      LatticeFFT::cfftBlocked(cArr, whichAxes, True, True, 40);
+      FFTServer<Float,Complex> ffts;
+      Array<Complex> expected(arr.copy());
+      ffts.fft(expected, True);
+      AlwaysAssert(allNearAbs(cArr.get(), expected, 1E-3), AipsError);
+      LatticeFFT::cfftBlocked(cArr, whichAxes, False, True, 40);
+      AlwaysAssert(allNearAbs(cArr.get(), arr, 1E-4), AipsError);
+      // Compare with a transform of the (single slab) ArrayLattice.
+      whichAxes(0) = False;
+      Array<Complex> arrCopy(arr.copy());
+      ArrayLattice<Complex> aLat(arrCopy);
+      LatticeFFT::cfft0(aLat, whichAxes);
+      LatticeFFT::cfftBlocked(cArr, whichAxes, True, False, 40);
+      AlwaysAssert(allNearAbs(cArr.get(), aLat.get(), 1E-4), AipsError);
+    }
     cout<< "OK"<< endl;
     return 0;
   } catch (std::exception& x) {
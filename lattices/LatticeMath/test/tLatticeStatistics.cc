@@ -26,6 +26,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Inputs/Input.h>
 #include <casacore/casa/Logging.h>
@@ -33,12 +34,16 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/Regex.h>
 #include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/PagedArray.h>
 #include <casacore/lattices/LatticeMath/LatticeStatistics.h>
 #include <casacore/lattices/Lattices/SubLattice.h>
 #include <casacore/lattices/LatticeMath/LatticeStatsBase.h>
+#include <casacore/lattices/LatticeMath/LatticeApply.h>
+#include <casacore/lattices/LatticeMath/StatsTiledCollapser.h>
 #include <casacore/lattices/Lattices/LatticeUtilities.h>
 #include <casacore/lattices/LRegions/LCSlicer.h>
 #include <casacore/scimath/StatsFramework/ClassicalStatistics.h>
+#include <casacore/casa/OS/OMP.h>
 
 #include <casacore/casa/iostream.h>
 
@@ -869,6 +874,64 @@ int main()
                 AlwaysAssert(maxPos.empty(), AipsError);
             }
         }
+        {
+            // The tiled apply method collapses in parallel using clones
+            // of the collapser. The results must be the same as with a
+            // single thread.
+            IPosition shape(3, 64, 64, 32);
+            Array<Float> adata(shape);
+            indgen(adata, Float(-1000), Float(0.01));
+            adata(IPosition(3, 10, 20, 25)) = -5000;
+            adata(IPosition(3, 30, 5, 3)) = 1e5;
+            // Ties in other output pixels must not change the positions.
+            adata(IPosition(3, 2, 3, 28)) = -5000;
+            adata(IPosition(3, 60, 61, 30)) = 1e5;
+            PagedArray<Float> latt(
+                TiledShape(shape, IPosition(3, 16, 16, 4)),
+                "tLatticeStatistics_tmp.pa"
+            );
+            latt.table().markForDelete();
+            latt.put(adata);
+            SubLattice<Float> subLatt(latt);
+            const uInt nthreads = OMP::maxThreads();
+            std::vector<Array<Double>> sums(2), maxs(2), sigmas(2);
+            for (uInt i=0; i<2; ++i) {
+                OMP::setNumThreads(i == 0 ? 1 : 4);
+                LatticeStatistics<Float> stats(subLatt);
+                stats.forceUseOldTiledApplyMethod();
+                stats.getStatistic(sums[i], LatticeStatsBase::SUM);
+                IPosition minPos, maxPos;
+                stats.getMinMaxPos(minPos, maxPos);
+                AlwaysAssert(minPos == IPosition(3, 10, 20, 25), AipsError);
+                AlwaysAssert(maxPos == IPosition(3, 30, 5, 3), AipsError);
+                Vector<Int> axes(2);
+                axes[0] = 0;
+                axes[1] = 1;
+                stats.setAxes(axes);
+                stats.getStatistic(maxs[i], LatticeStatsBase::MAX);
+                stats.getStatistic(sigmas[i], LatticeStatsBase::SIGMA);
+                AlwaysAssert(maxs[i].shape() == IPosition(1, 32), AipsError);
+            }
+            // The positions are only given if all axes are collapsed, which
+            // is done serially. So test the merge of the positions found
+            // by the clones using the collapser directly.
+            StatsTiledCollapser<Float,Double> collapser(
+                Vector<Float>(), True, True, False
+            );
+            ArrayLattice<Double> outLatt(IPosition(2, 32, LatticeStatsBase::NACCUM));
+            SubLattice<Double> outSubLatt(outLatt, True);
+            LatticeApply<Float,Double>::tiledApply(
+                outSubLatt, subLatt, collapser, IPosition(2, 0, 1), 1
+            );
+            IPosition minPos, maxPos;
+            collapser.minMaxPos(minPos, maxPos);
+            AlwaysAssert(minPos == IPosition(3, 10, 20, 25), AipsError);
+            AlwaysAssert(maxPos == IPosition(3, 30, 5, 3), AipsError);
+            OMP::setNumThreads(nthreads);
+            AlwaysAssert(allNear(sums[1], sums[0], 1e-12), AipsError);
+            AlwaysAssert(allEQ(maxs[1], maxs[0]), AipsError);
+            AlwaysAssert(allNear(sigmas[1], sigmas[0], 1e-12), AipsError);
+        }
     }
     catch (const std::exception& x) {
         cerr << "aipserror: error " << x.what() << endl;
@@ -41,7 +41,10 @@
 #include <casacore/measures/Measures/Stokes.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Logging/LogIO.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -149,6 +152,8 @@ void MSIter::construct(
     }
     tabIter_p.resize(nMS_p);
     tabIterAtStart_p.resize(nMS_p);
+    curChunk_p = 0;
+    mutex_p = std::make_shared<std::mutex>();
 
     // Creating the sorting members to be pass to the TableIterator constructor
     Block<String> sortColumnNames;
@@ -177,9 +182,11 @@ void MSIter::construct(
     // Create the table iterators
     for (size_t i=0; i<nMS_p; i++) {
         // create the iterator for each MS
+        // An MS is usually in time order, so check that first to avoid
+        // an expensive sort.
         tabIter_p[i] = new TableIterator(bms_p[i],sortColumnNames,
                                          sortCompareFunctions,sortOrders,
-                                         TableIterator::ParSort, true);
+                                         TableIterator::CheckSort, true);
         tabIterAtStart_p[i]=True;
     }
     setMSInfo();
@@ -261,6 +268,8 @@ void MSIter::construct(const Block<Int>& sortColumns,
   }
   tabIter_p.resize(nMS_p);
   tabIterAtStart_p.resize(nMS_p);
+  curChunk_p = 0;
+  mutex_p = std::make_shared<std::mutex>();
   // 'sort out' the sort orders
   // We normally require the table to be sorted on ARRAY_ID and FIELD_ID,
   // DATA_DESC_ID and TIME for the correct operation of the
@@ -386,10 +395,16 @@ void MSIter::construct(const Block<Int>& sortColumns,
       }
     }
 
+    if (!useIn && !useSorted && bms_p[i].isSorted(columns)) {
+      // the input is already in order (which is usually the case),
+      // so neither a sort nor a sorted table is needed
+      useIn=True;
+      store=False;
+    }
     if (!useIn && !useSorted) {
       // we have to resort the input; enclose in >>> <<< to avoid pollution of test .out file
       if (aips_debug) cout << ">>>"<<endl<<"MSIter::construct - resorting table"<<endl<<"<<<"<<endl;
-      sorted = bms_p[i].sort(columns, Sort::Ascending, Sort::QuickSort);
+      sorted = bms_p[i].sort(columns, Sort::Ascending, Sort::RadixSort);
     }
 
     // Only store if globally requested _and_ locally decided
@@ -427,6 +442,42 @@ MSIter::MSIter(const MSIter& other)
   operator=(other);
 }
 
+MSIter::MSIter (const MSIter& parent,
+                const std::shared_ptr<const std::vector<Chunk>>& chunks,
+                std::vector<size_t>&& chunkIds)
+: bms_p(parent.bms_p),
+  tabIterAtStart_p(parent.nMS_p, True),
+  timeInSort_p(parent.timeInSort_p),
+  arrayInSort_p(parent.arrayInSort_p),
+  ddInSort_p(parent.ddInSort_p),
+  fieldInSort_p(parent.fieldInSort_p),
+  nMS_p(parent.nMS_p),
+  lastMS_p(-1),
+  more_p(true),
+  newMS_p(true),
+  newArrayId_p(true),
+  newFieldId_p(true),
+  newSpectralWindowId_p(true),
+  newPolarizationId_p(true),
+  newDataDescId_p(true),
+  storeSorted_p(parent.storeSorted_p),
+  interval_p(parent.interval_p),
+  prevFirstTimeStamp_p(-1.0),
+  allBeamOffsetsZero_p(True),
+  chunks_p(chunks),
+  chunkIds_p(std::move(chunkIds)),
+  curChunk_p(0),
+  mutex_p(parent.mutex_p)
+{
+  This = (MSIter*)this;
+  // A partition iterator does not use table iterators.
+  tabIter_p.resize(nMS_p);
+  for (size_t i=0; i<nMS_p; i++) tabIter_p[i] = 0;
+  curMS_p = (*chunks_p)[chunkIds_p[0]].msId;
+  std::lock_guard<std::mutex> lock(*mutex_p);
+  setMSInfo();
+}
+
 MSIter::~MSIter()
 {
   for (size_t i=0; i<nMS_p; i++) delete tabIter_p[i];
@@ -442,14 +493,26 @@ MSIter::operator=(const MSIter& other)
   nMS_p = other.nMS_p;
   tabIter_p.resize(nMS_p);
   for (size_t i = 0; i < nMS_p; ++i) {
-    tabIter_p[i] = new TableIterator(*(other.tabIter_p[i]));
-    tabIter_p[i]->copyState(*other.tabIter_p[i]);
+    if (other.tabIter_p[i]) {
+      tabIter_p[i] = new TableIterator(*(other.tabIter_p[i]));
+      tabIter_p[i]->copyState(*other.tabIter_p[i]);
+    } else {
+      tabIter_p[i] = 0;
+    }
   }
   tabIterAtStart_p = other.tabIterAtStart_p;
+  chunks_p = other.chunks_p;
+  chunkIds_p = other.chunkIds_p;
+  curChunk_p = other.curChunk_p;
+  mutex_p = other.mutex_p;
   curMS_p = other.curMS_p;
   lastMS_p = other.lastMS_p;
   msc_p = other.msc_p;
-  curTable_p = tabIter_p[curMS_p]->table();
+  if (chunks_p) {
+    curTable_p = other.curTable_p;
+  } else {
+    curTable_p = tabIter_p[curMS_p]->table();
+  }
   curArrayIdFirst_p = other.curArrayIdFirst_p;
   lastArrayId_p = other.lastArrayId_p;
   curSourceIdFirst_p = other.curSourceIdFirst_p;
@@ -522,10 +585,15 @@ void MSIter::setInterval(Double timeInterval)
 
 void MSIter::origin()
 {
-  curMS_p=0;
   checkFeed_p=True;
-  if (!tabIterAtStart_p[curMS_p]) tabIter_p[curMS_p]->reset();
-  setState();
+  if (chunks_p) {
+    curChunk_p=0;
+    setChunkState();
+  } else {
+    curMS_p=0;
+    if (!tabIterAtStart_p[curMS_p]) tabIter_p[curMS_p]->reset();
+    setState();
+  }
   newMS_p=newArrayId_p=newSpectralWindowId_p=newFieldId_p=newPolarizationId_p=
     newDataDescId_p=more_p=True;
 }
@@ -549,6 +617,15 @@ void MSIter::advance()
 {
   newMS_p=newArrayId_p=newSpectralWindowId_p=newPolarizationId_p=
     newDataDescId_p=newFieldId_p=False;
+  if (chunks_p) {
+    if (++curChunk_p >= chunkIds_p.size()) {
+      curChunk_p--;
+      more_p=False;
+    } else {
+      setChunkState();
+    }
+    return;
+  }
   tabIter_p[curMS_p]->next();
   tabIterAtStart_p[curMS_p]=False;
 
@@ -566,7 +643,11 @@ void MSIter::setState()
   setMSInfo();
   if(newMS_p)
     checkFeed_p=True;
-  curTable_p=tabIter_p[curMS_p]->table();
+  if (chunks_p) {
+    curTable_p=bms_p[curMS_p]((*chunks_p)[chunkIds_p[curChunk_p]].rows);
+  } else {
+    curTable_p=tabIter_p[curMS_p]->table();
+  }
   colArray_p.attach(curTable_p,MS::columnName(MS::ARRAY_ID));
   // msc_p is already defined here (it is set in setMSInfo)
   if(newMS_p)
@@ -666,6 +747,122 @@ void MSIter::setState()
   }
 }
 
+void MSIter::setChunkState()
+{
+  std::lock_guard<std::mutex> lock(*mutex_p);
+  curMS_p=(*chunks_p)[chunkIds_p[curChunk_p]].msId;
+  setState();
+  // Read the lazily evaluated metadata now while the lock is held, so
+  // the accessors do not read the MS.
+  if(curDataDescIdFirst_p==-1)
+  {
+    cacheCurrentDDInfo();
+    cacheExtraDDInfo();
+  }
+  frequency();
+  if(curFieldIdFirst_p==-1)
+    setFieldInfo();
+}
+
+std::shared_ptr<const std::vector<MSIter::Chunk>>
+MSIter::getChunks (std::vector<size_t>& chunkIds) const
+{
+  if (chunks_p) {
+    chunkIds = chunkIds_p;
+    return chunks_p;
+  }
+  std::lock_guard<std::mutex> lock(readMutex());
+  std::shared_ptr<std::vector<Chunk>> chunks =
+    std::make_shared<std::vector<Chunk>>();
+  for (size_t i=0; i<nMS_p; i++) {
+    ScalarColumn<Int> spwCol(bms_p[i].dataDescription(),
+                             MSDataDescription::columnName
+                             (MSDataDescription::SPECTRAL_WINDOW_ID));
+    // Step through a copy of the table iterator, so the state of this
+    // iterator does not change. Reset the time comparator before each
+    // step as done by setState, so the chunks are the same.
+    TableIterator iter(*tabIter_p[i]);
+    if (timeComp_p) timeComp_p->setOffset(0.0);
+    iter.reset();
+    while (!iter.pastEnd()) {
+      Table tab = iter.table();
+      Chunk chunk;
+      chunk.msId = i;
+      chunk.rows = tab.rowNumbers(bms_p[i], True);
+      chunk.spectralWindowId =
+        spwCol(ScalarColumn<Int>(tab, MS::columnName(MS::DATA_DESC_ID))(0));
+      chunk.time = ScalarColumn<Double>(tab, MS::columnName(MS::TIME))(0);
+      chunk.keyChange = iter.keyChangeAtLastNext();
+      chunks->push_back(chunk);
+      if (timeComp_p) timeComp_p->setOffset(0.0);
+      iter.next();
+    }
+  }
+  if (timeComp_p) timeComp_p->setOffset(0.0);
+  chunkIds.resize(chunks->size());
+  for (size_t i=0; i<chunkIds.size(); i++) chunkIds[i] = i;
+  return chunks;
+}
+
+std::vector<std::shared_ptr<MSIter>>
+MSIter::partition (PartitionType type, uInt nPartitions) const
+{
+  std::vector<size_t> chunkIds;
+  std::shared_ptr<const std::vector<Chunk>> chunks = getChunks(chunkIds);
+  std::vector<std::vector<size_t>> parts;
+  if (type == BySpectralWindow) {
+    std::map<Int, std::vector<size_t>> spwParts;
+    for (size_t id : chunkIds) {
+      spwParts[(*chunks)[id].spectralWindowId].push_back(id);
+    }
+    for (auto& part : spwParts) {
+      parts.push_back(std::move(part.second));
+    }
+  } else {
+    if (nPartitions == 0) nPartitions = OMP::maxThreads();
+    // Order the chunks in time and split them at a time change as soon
+    // as the partition has its share of the rows.
+    std::vector<size_t> order(chunkIds);
+    std::stable_sort(order.begin(), order.end(),
+                     [&chunks](size_t i1, size_t i2)
+                     { return (*chunks)[i1].time < (*chunks)[i2].time; });
+    rownr_t nrow = 0;
+    for (size_t id : order) nrow += (*chunks)[id].rows.size();
+    rownr_t nrowDone = 0;
+    std::vector<size_t> part;
+    for (size_t i=0; i<order.size(); i++) {
+      const Chunk& chunk = (*chunks)[order[i]];
+      if (!part.empty()  &&  chunk.time != (*chunks)[order[i-1]].time  &&
+          nrowDone * nPartitions >= (parts.size() + 1) * nrow) {
+        parts.push_back(std::move(part));
+        part.clear();
+      }
+      part.push_back(order[i]);
+      nrowDone += chunk.rows.size();
+    }
+    if (!part.empty()) parts.push_back(std::move(part));
+    // Iterate through the chunks of a partition in the normal order.
+    for (auto& part : parts) {
+      std::sort(part.begin(), part.end());
+    }
+  }
+  std::vector<std::shared_ptr<MSIter>> iters;
+  iters.reserve(parts.size());
+  for (auto& part : parts) {
+    iters.push_back(std::shared_ptr<MSIter>(new MSIter(*this, chunks,
+                                                       std::move(part))));
+  }
+  return iters;
+}
+
+std::mutex& MSIter::readMutex() const
+{
+  if (!mutex_p) {
+    throw(AipsError("MSIter::readMutex - iterator is not constructed"));
+  }
+  return *mutex_p;
+}
+
 const Vector<Double>& MSIter::frequency() const
 {
   if (!freqCacheOK_p) {
@@ -1026,6 +1223,9 @@ void  MSIter::getSpwInFreqRange(Block<Vector<Int> >& spw,
 // Report Name of slowest column that changes at end of current iteration
 const String& MSIter::keyChange() const
 {
+  if (chunks_p) {
+    return (*chunks_p)[chunkIds_p[curChunk_p]].keyChange;
+  }
   return tabIter_p[curMS_p]->keyChangeAtLastNext();
 }
 
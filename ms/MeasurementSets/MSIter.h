@@ -34,10 +34,14 @@
 #include <casacore/measures/Measures/MDirection.h>
 #include <casacore/measures/Measures/MPosition.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/RowNumbers.h>
 #include <casacore/casa/Utilities/Compare.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/scimath/Mathematics/SquareMatrix.h>
 #include <casacore/scimath/Mathematics/RigidVector.h>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -144,6 +148,30 @@ private:
 // </srcblock>
 // </example>
 //
+// <example>
+// <srcblock>
+// // The chunks can be processed in parallel by partitioning them by
+// // spectral window. The MS is sorted only once; each thread iterates
+// // through the chunks of its own partitions.
+// MSIter msIter(ms, Block<Int>(), 0., True, False);
+// std::vector<std::shared_ptr<MSIter>> parts =
+//   msIter.partition(MSIter::BySpectralWindow);
+// #pragma omp parallel for schedule(dynamic)
+// for (size_t i=0; i<parts.size(); ++i) {
+//   MSIter& iter = *parts[i];
+//   for (iter.origin(); iter.more(); iter++) {
+//     Matrix<Complex> data;
+//     {
+//       // Reading the data has to be serialized.
+//       std::lock_guard<std::mutex> lock(iter.readMutex());
+//       ArrayColumn<Complex>(iter.table(), "DATA").getColumn(data);
+//     }
+//     process(iter.spectralWindowId(), iter.frequency(), data);
+//   }
+// }
+// </srcblock>
+// </example>
+//
 // <motivation>
 // This class was originally part of the VisibilityIterator class, but that
 // class was getting too large and complicated. By splitting out the toplevel
@@ -166,6 +194,15 @@ public:
     Linear=1
   };
 
+  // Define how function <src>partition</src> divides the chunks.
+  enum PartitionType {
+    // A partition for each spectral window (of the first row in a chunk).
+    BySpectralWindow=0,
+    // Consecutive time ranges (of the first row in a chunk) having
+    // about the same number of rows.
+    ByTime=1
+  };
+
   // Default constructor - useful only to assign another iterator later.
   // Use of other member functions on this object is likely to dump core.
   MSIter();
@@ -187,6 +224,8 @@ public:
   // to be a problem when the MS is being read in parallel.  If storeSorted is
   // false then the SORTED_TABLE is constructed and used in memory which keeps
   // concurrent readers from interfering with each other.
+  // If the MS is already in the order of the sort columns, it is used
+  // directly without making (and storing) a SORTED_TABLE.
 
   MSIter(const MeasurementSet& ms, const Block<Int>& sortColumns,
          Double timeInterval=0, Bool addDefaultSortColumns=True,
@@ -210,6 +249,7 @@ public:
   // sortColumns[1].first = "ANTENNA1" then the first iterations will go through
   // all possible values of ANTENNA1 for the first DDId, then it will start
   // the iterations for the second DDId and so on.
+  // The MS is not sorted if it is already in the required order.
   MSIter(const MeasurementSet& ms,
          const std::vector<std::pair<String, std::shared_ptr<BaseCompare>>>& sortColumns);
 
@@ -248,6 +288,34 @@ public:
   // Report Name of slowest column that changes at end of current iteration
   const String& keyChange() const;
 
+  // Divide the chunks of this iterator into independent partitions and
+  // return an iterator for each partition, which steps in the normal order
+  // through the chunks in the partition. Partitions without chunks are
+  // not returned.
+  // <br>The chunks are determined once by stepping through the sorted
+  // table(s) without reading any data. The row numbers of the chunks are
+  // kept in a read-only structure shared by the returned iterators, so
+  // no sorting is needed anymore. It makes it possible that each thread
+  // in a pool uses its own partition iterator.
+  // <br>For ByTime, <src>nPartitions</src> gives the number of time
+  // ranges; 0 means the maximum number of OpenMP threads.
+  // It is ignored for BySpectralWindow.
+  // <br>A partition iterator reads the iteration metadata (such as the
+  // data description, spectral window, frequencies, and field) in
+  // <src>origin</src> and <src>operator++</src> while holding the
+  // mutex given by <src>readMutex</src>. Other reads of the MS (data and
+  // other metadata like the feed info or phase center) are not
+  // thread-safe and should be done while holding that mutex.
+  // <br>The partition iterators should be created and destroyed
+  // by a single thread. They can also be partitioned again.
+  std::vector<std::shared_ptr<MSIter>> partition (PartitionType type,
+                                                  uInt nPartitions=0) const;
+
+  // Get the mutex to lock when reading the MS from multiple threads.
+  // It is shared by the iterators created by <src>partition</src>,
+  // their parent, and copies of the iterator.
+  std::mutex& readMutex() const;
+
   // Return the current Table iteration
   Table table() const;
 
@@ -401,6 +469,34 @@ public:
   const String& sourceName() const;
 
 protected:
+  // Description of a chunk used by a partition iterator.
+  struct Chunk {
+    // The MS of the chunk.
+    size_t msId;
+    // The row numbers of the chunk in its MS.
+    RowNumbers rows;
+    // The spectral window of the first row.
+    Int spectralWindowId;
+    // The time of the first row.
+    Double time;
+    // The slowest sort key changed when stepping to this chunk.
+    String keyChange;
+  };
+
+  // Construct an iterator for the given chunks of the parent iterator.
+  MSIter (const MSIter& parent,
+          const std::shared_ptr<const std::vector<Chunk>>& chunks,
+          std::vector<size_t>&& chunkIds);
+
+  // Get the chunks of this iterator by stepping through the sorted
+  // table(s) and the ids of the chunks to iterate through.
+  std::shared_ptr<const std::vector<Chunk>>
+  getChunks (std::vector<size_t>& chunkIds) const;
+
+  // Set the current table to the current chunk of a partition iterator
+  // and set the state accordingly.
+  void setChunkState();
+
   // handle the construction details
   void construct(const Block<Int>& sortColumns, Bool addDefaultSortColumns);
   // handle the construction details using explicit comparison functions
@@ -502,6 +598,14 @@ protected:
 
   std::shared_ptr<MSInterval> timeComp_p; // Points to the time comparator.
                                           // 0 if not using a time interval.
+
+  // The chunks and the ids of the chunks to iterate through in a
+  // partition iterator. chunks_p is null for a normal iterator.
+  std::shared_ptr<const std::vector<Chunk>> chunks_p;
+  std::vector<size_t> chunkIds_p;
+  size_t curChunk_p;
+  // Mutex serializing the reads of the MS.
+  std::shared_ptr<std::mutex> mutex_p;
 };
 
 inline Bool MSIter::more() const { return more_p;}
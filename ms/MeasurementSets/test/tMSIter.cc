@@ -952,6 +952,64 @@ void iterMSCachedFieldInfo ()
   }
 }
 
+// This test checks that the partition iterators step through the same
+// chunks as the normal iterator, each with the correct metadata.
+void iterMSPartition ()
+{
+  MeasurementSet ms("tMSIter_severalddfeed_tmp.ms");
+  Block<int> sort(2);
+  sort[0] = MS::DATA_DESC_ID;
+  sort[1] = MS::TIME;
+  MSIter msIter(ms, sort, 0, False, False);
+  // Collect the rows and spectral windows of the normal iteration.
+  std::vector<Vector<rownr_t>> expRows;
+  std::vector<Int> expSpw;
+  for (msIter.origin(); msIter.more(); msIter++) {
+    expRows.push_back (msIter.table().rowNumbers(ms));
+    expSpw.push_back (msIter.spectralWindowId());
+  }
+  // Partition by spectral window; the chunks are in the normal order.
+  std::vector<std::shared_ptr<MSIter>> parts =
+    msIter.partition (MSIter::BySpectralWindow);
+  AlwaysAssertExit (parts.size() == 5);
+  Vector<Double> expFreqs(8);
+  indgen (expFreqs, 1e9, 1e6);
+  size_t chunk = 0;
+  for (size_t i=0; i<parts.size(); ++i) {
+    MSIter& iter = *parts[i];
+    for (iter.origin(); iter.more(); iter++) {
+      AlwaysAssertExit (chunk < expRows.size());
+      AlwaysAssertExit (allEQ (iter.table().rowNumbers(ms), expRows[chunk]));
+      AlwaysAssertExit (iter.spectralWindowId() == expSpw[chunk]);
+      AlwaysAssertExit (iter.spectralWindowId() == Int(i));
+      AlwaysAssertExit (iter.dataDescriptionId() == Int(i));
+      AlwaysAssertExit (allEQ (iter.frequency(), expFreqs + i*1e7));
+      ++chunk;
+    }
+  }
+  AlwaysAssertExit (chunk == expRows.size());
+  // Partition in time; each time must be in a single partition.
+  parts = msIter.partition (MSIter::ByTime, 2);
+  AlwaysAssertExit (parts.size() == 2);
+  rownr_t nrow = 0;
+  Double lastTime = 0;
+  for (size_t i=0; i<parts.size(); ++i) {
+    MSIter& iter = *parts[i];
+    Double minTime = 1e30;
+    Double maxTime = 0;
+    for (iter.origin(); iter.more(); iter++) {
+      Vector<Double> times =
+        ScalarColumn<Double>(iter.table(), "TIME").getColumn();
+      minTime = std::min (minTime, min(times));
+      maxTime = std::max (maxTime, max(times));
+      nrow += iter.table().nrow();
+    }
+    AlwaysAssertExit (minTime > lastTime);
+    lastTime = maxTime;
+  }
+  AlwaysAssertExit (nrow == ms.nrow());
+}
+
 int main (int argc, char* argv[])
 {
   try {
@@ -991,6 +1049,7 @@ int main (int argc, char* argv[])
     iterMSCachedDDFeedInfo();
     cout << "########" << endl;
     iterMSCachedFieldInfo();
+    iterMSPartition();
   } catch (std::exception& x) {
     cerr << "Unexpected exception: " << x.what() << endl;
     return 1;
@@ -28,7 +28,9 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/scimath/Mathematics/Gridder.h>
+#include <casacore/scimath/Mathematics/NumericTraits.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -36,6 +38,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // Does convolutional gridding
 // </summary>
 
+// <synopsis>
+// Values can be gridded (and degridded) one at a time, or in batches.
+// The batch functions take the positions of all values as a Matrix
+// with shape [ndim,nvalues]. They sort the values into tiles of the grid
+// and process the tiles in parallel (using OpenMP). When gridding, tiles that
+// can be updated at the same time are far enough apart that their
+// convolution footprints cannot overlap, so no atomic updates are needed.
+// Only the order in which values are added to a grid cell differs
+// from one-at-a-time gridding, so the results can differ in the
+// rounding errors only.
+// </synopsis>
+
 template <class Domain, class Range>
 class ConvolveGridder : public Gridder<Domain, Range>
 {
@@ -56,6 +70,25 @@ public:
 		      const Vector<Domain>& position,
 		      Range& value);
 
+  // Grid a batch of values (e.g. visibilities).
+  // <src>positions</src> has shape [ndim,nvalues] and holds the position
+  // of each value like the <src>position</src> argument of the single
+  // value <src>grid</src> function. If <src>weights</src> is not empty,
+  // each value is multiplied by its weight before gridding.
+  // Values whose convolution footprint is not fully on the grid are
+  // skipped. It returns the number of values gridded.
+  uInt grid(Array<Range>& gridded,
+	    const Matrix<Domain>& positions,
+	    const Vector<Range>& values,
+	    const Vector<Float>& weights = Vector<Float>());
+
+  // Degrid a batch of values. <src>positions</src> is as above.
+  // <src>values</src> is resized if needed. Values off the grid are set
+  // to 0. It returns the number of values degridded.
+  uInt degrid(const Array<Range>& gridded,
+	      const Matrix<Domain>& positions,
+	      Vector<Range>& values);
+
   Vector<Double>& cFunction();
 
   Vector<Int>& cSupport();
@@ -66,12 +99,33 @@ protected:
   virtual Range correctionFactor1D(Int loc, Int len);
 
 private:
+  // The type of the convolution kernel weights used in the batch functions.
+  typedef typename NumericTraits<Range>::BaseType KernelType;
+
+  // Determine the grid locations of a batch of values and sort the values
+  // on the grid into tiles. Only the values on the grid are kept. In tile
+  // order it fills their indices in <src>order</src>, their locations in
+  // <src>locs</src> and their grid positions in <src>gpos</src> (both
+  // [n,3], unused axes are 0), so they can be accessed sequentially.
+  // Per tile the index of its first value is returned in
+  // <src>tileStart</src> and the number of tiles per axis in
+  // <src>ntiles</src>.
+  void sortTiles(const Matrix<Domain>& positions, Bool subtractOffset,
+		 std::vector<Int>& locs, std::vector<Domain>& gpos,
+		 std::vector<uInt>& order, std::vector<uInt>& tileStart,
+		 Int ntiles[3]);
+
+  // Fill the 1D convolution kernel (of length 2*support+1) for the given
+  // grid position and return its sum.
+  KernelType makeKernel(Domain gpos, KernelType* kernel) const;
+
   Vector<Double> convFunc;
   Vector<Int> supportVec;
   Vector<Int> loc;
   Int sampling;
   Int support;
   String cType;
+  Int tileSize;
 
 public:
   using Gridder<Domain,Range>::onGrid;
@@ -30,7 +30,12 @@
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <cmath>
+#include <cstdlib>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -378,6 +383,255 @@ Bool ConvolveGridder<Domain, Range>::degrid(const Array<Range> &gridded,
   }
 }
 
+template <class Domain, class Range>
+uInt ConvolveGridder<Domain, Range>::grid(Array<Range>& gridded,
+					  const Matrix<Domain>& positions,
+					  const Vector<Range>& values,
+					  const Vector<Float>& weights)
+{
+  AlwaysAssert(ndim>=1 && ndim<=3, AipsError);
+  AlwaysAssert(Int(positions.nrow())==ndim, AipsError);
+  AlwaysAssert(values.nelements()==positions.ncolumn(), AipsError);
+  AlwaysAssert(weights.empty() || weights.nelements()==values.nelements(),
+	       AipsError);
+  AlwaysAssert(Int(gridded.ndim())>=ndim, AipsError);
+  std::vector<Int> locs;
+  std::vector<Domain> gpos;
+  std::vector<uInt> order;
+  std::vector<uInt> tileStart;
+  Int ntiles[3];
+  sortTiles(positions, True, locs, gpos, order, tileStart, ntiles);
+  const Int64 n0 = gridded.shape()(0);
+  const Int64 n1 = (ndim>1 ? gridded.shape()(1) : 1);
+  // Get the weighted values in tile order.
+  std::vector<Range> sortedValues(order.size());
+  {
+    Bool delVal, delWgt=False;
+    const Range* val = values.getStorage(delVal);
+    const Float* wgt = (weights.empty() ? 0 : weights.getStorage(delWgt));
+    for (uInt inx=0; inx<order.size(); ++inx) {
+      sortedValues[inx] = val[order[inx]];
+      if (wgt) sortedValues[inx] *= wgt[order[inx]];
+    }
+    values.freeStorage(val, delVal);
+    if (wgt) weights.freeStorage(wgt, delWgt);
+  }
+  Bool delGrid;
+  Range* grid = gridded.getStorage(delGrid);
+  // Tiles having the same parity on each axis (called colour here) are
+  // at least one tile apart. The tile size is at least twice the support,
+  // so their convolution footprints do not overlap and the tiles of a
+  // colour can be gridded in parallel without atomic updates.
+  const Int ntile = ntiles[0]*ntiles[1]*ntiles[2];
+  const Int nk = 2*support+1;
+  for (Int colour=0; colour<(1<<ndim); ++colour) {
+    std::vector<Int> tiles;
+    for (Int tile=0; tile<ntile; ++tile) {
+      Int t0 = tile % ntiles[0];
+      Int t1 = (tile / ntiles[0]) % ntiles[1];
+      Int t2 = tile / (ntiles[0]*ntiles[1]);
+      if (tileStart[tile+1] > tileStart[tile]  &&
+	  ((t0&1) | (t1&1)<<1 | (t2&1)<<2) == colour) {
+	tiles.push_back(tile);
+      }
+    }
+    const Int ntodo = tiles.size();
+#ifdef _OPENMP
+#pragma omp parallel if (ntodo > 1  &&  order.size() >= 1024)
+#endif
+    {
+      std::vector<KernelType> kernel(3*nk);
+      KernelType* kx = &(kernel[0]);
+      KernelType* ky = kx + nk;
+      KernelType* kz = ky + nk;
+      ky[0] = kz[0] = 1;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (Int it=0; it<ntodo; ++it) {
+	for (uInt i=tileStart[tiles[it]]; i<tileStart[tiles[it]+1]; ++i) {
+	  KernelType norm = makeKernel(gpos[3*i], kx);
+	  const Int sy = (ndim>1 ? support : 0);
+	  const Int sz = (ndim>2 ? support : 0);
+	  if (ndim > 1) norm *= makeKernel(gpos[3*i+1], ky);
+	  if (ndim > 2) norm *= makeKernel(gpos[3*i+2], kz);
+	  Range wv = sortedValues[i] / norm;
+	  const Int64 li = locs[3*i] - support;
+	  const Int64 lj = locs[3*i+1] - sy;
+	  const Int64 lk = locs[3*i+2] - sz;
+	  for (Int k=0; k<=2*sz; ++k) {
+	    for (Int j=0; j<=2*sy; ++j) {
+	      const Range nv = wv * (ky[j]*kz[k]);
+	      Range* row = grid + ((lk+k)*n1 + lj+j)*n0 + li;
+	      // Unit stride without dependencies, so it can be vectorized.
+	      for (Int x=0; x<nk; ++x) {
+		row[x] += nv * kx[x];
+	      }
+	    }
+	  }
+	}
+      }
+    }
+  }
+  gridded.putStorage(grid, delGrid);
+  return order.size();
+}
+
+template <class Domain, class Range>
+uInt ConvolveGridder<Domain, Range>::degrid(const Array<Range>& gridded,
+					    const Matrix<Domain>& positions,
+					    Vector<Range>& values)
+{
+  AlwaysAssert(ndim>=1 && ndim<=3, AipsError);
+  AlwaysAssert(Int(positions.nrow())==ndim, AipsError);
+  AlwaysAssert(Int(gridded.ndim())>=ndim, AipsError);
+  values.resize(positions.ncolumn());
+  values = Range(0);
+  // As in the single value degrid, the offset is not applied.
+  std::vector<Int> locs;
+  std::vector<Domain> gpos;
+  std::vector<uInt> order;
+  std::vector<uInt> tileStart;
+  Int ntiles[3];
+  sortTiles(positions, False, locs, gpos, order, tileStart, ntiles);
+  const Int64 n0 = gridded.shape()(0);
+  const Int64 n1 = (ndim>1 ? gridded.shape()(1) : 1);
+  Bool delGrid, delVal;
+  const Range* grid = gridded.getStorage(delGrid);
+  Range* val = values.getStorage(delVal);
+  const Int nk = 2*support+1;
+  const Int ntodo = order.size();
+  // Each value is written by one thread only. Processing them in tile order
+  // keeps the grid accesses of a thread local.
+#ifdef _OPENMP
+#pragma omp parallel if (ntodo >= 1024)
+#endif
+  {
+    std::vector<KernelType> kernel(3*nk);
+    KernelType* kx = &(kernel[0]);
+    KernelType* ky = kx + nk;
+    KernelType* kz = ky + nk;
+    ky[0] = kz[0] = 1;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (Int i=0; i<ntodo; ++i) {
+      KernelType norm = makeKernel(gpos[3*i], kx);
+      const Int sy = (ndim>1 ? support : 0);
+      const Int sz = (ndim>2 ? support : 0);
+      if (ndim > 1) norm *= makeKernel(gpos[3*i+1], ky);
+      if (ndim > 2) norm *= makeKernel(gpos[3*i+2], kz);
+      const Int64 li = locs[3*i] - support;
+      const Int64 lj = locs[3*i+1] - sy;
+      const Int64 lk = locs[3*i+2] - sz;
+      Range sum(0);
+      for (Int k=0; k<=2*sz; ++k) {
+	for (Int j=0; j<=2*sy; ++j) {
+	  const Range* row = grid + ((lk+k)*n1 + lj+j)*n0 + li;
+	  Range rowSum(0);
+	  for (Int x=0; x<nk; ++x) {
+	    rowSum += row[x] * kx[x];
+	  }
+	  sum += rowSum * (ky[j]*kz[k]);
+	}
+      }
+      val[order[i]] = sum / norm;
+    }
+  }
+  gridded.freeStorage(grid, delGrid);
+  values.putStorage(val, delVal);
+  return ntodo;
+}
+
+template <class Domain, class Range>
+void ConvolveGridder<Domain, Range>::sortTiles(const Matrix<Domain>& positions,
+					       Bool subtractOffset,
+					       std::vector<Int>& locs,
+					       std::vector<Domain>& gpos,
+					       std::vector<uInt>& order,
+					       std::vector<uInt>& tileStart,
+					       Int ntiles[3])
+{
+  const Int64 nval = positions.ncolumn();
+  ntiles[0] = ntiles[1] = ntiles[2] = 1;
+  for (Int axis=0; axis<ndim; ++axis) {
+    ntiles[axis] = (shapeVec(axis) + tileSize - 1) / tileSize;
+  }
+  const Int ntile = ntiles[0]*ntiles[1]*ntiles[2];
+  // Get the location of each value and the tile it belongs to (-1 means
+  // that it is off the grid).
+  std::vector<Int> valLocs(3*nval, 0);
+  std::vector<Domain> valPos(3*nval, Domain(0));
+  std::vector<Int> tileId(nval);
+#ifdef _OPENMP
+#pragma omp parallel for if (nval >= 65536)
+#endif
+  for (Int64 i=0; i<nval; ++i) {
+    Int tile = 0;
+    Int mult = 1;
+    for (Int axis=0; axis<ndim; ++axis) {
+      Domain g = scale(axis)*positions(axis,i) + offset(axis);
+      Int l = this->nint(g);
+      if (subtractOffset) l -= offsetVec(axis);
+      valPos[3*i+axis] = g;
+      valLocs[3*i+axis] = l;
+      if (tile >= 0) {
+	if (l-support < 0  ||  l+support >= shapeVec(axis)) {
+	  tile = -1;
+	} else {
+	  tile += mult * (l/tileSize);
+	  mult *= ntiles[axis];
+	}
+      }
+    }
+    tileId[i] = tile;
+  }
+  // Do a counting sort on tile, which keeps the order of the values
+  // within a tile. The locations and positions are stored in sorted order,
+  // so the gridding loops access them sequentially.
+  tileStart.assign(ntile+1, 0);
+  for (Int64 i=0; i<nval; ++i) {
+    if (tileId[i] >= 0) {
+      tileStart[tileId[i]+1]++;
+    }
+  }
+  for (Int tile=0; tile<ntile; ++tile) {
+    tileStart[tile+1] += tileStart[tile];
+  }
+  const uInt nsorted = tileStart[ntile];
+  order.resize(nsorted);
+  locs.resize(3*nsorted);
+  gpos.resize(3*nsorted);
+  std::vector<uInt> next(tileStart.begin(), tileStart.end()-1);
+  for (Int64 i=0; i<nval; ++i) {
+    if (tileId[i] >= 0) {
+      const uInt inx = next[tileId[i]]++;
+      order[inx] = i;
+      for (Int axis=0; axis<3; ++axis) {
+	locs[3*inx+axis] = valLocs[3*i+axis];
+	gpos[3*inx+axis] = valPos[3*i+axis];
+      }
+    }
+  }
+}
+
+template <class Domain, class Range>
+typename ConvolveGridder<Domain, Range>::KernelType
+ConvolveGridder<Domain, Range>::makeKernel(Domain gpos,
+					   KernelType* kernel) const
+{
+  // Same offset in the sampled function as the Fortran gridding routines.
+  Double pos = gpos;
+  Int off = std::lround((Double(std::lround(pos)) - pos) * sampling);
+  KernelType sum = 0;
+  for (Int i=-support; i<=support; ++i) {
+    KernelType val = convFunc(std::abs(sampling*i + off));
+    kernel[i+support] = val;
+    sum += val;
+  }
+  return sum;
+}
+
 template <class Domain, class Range>
 Range ConvolveGridder<Domain, Range>::correctionFactor1D(Int loc, Int len)
 {
@@ -426,6 +680,8 @@ void ConvolveGridder<Domain, Range>::setConvolutionFunction(const String& type)
       convFunc(i)=(1.0-nu*nu)*val;
     }
   }
+  // Tiles used by the batch functions must be at least twice the support.
+  tileSize=std::max(32, 2*support);
 }
 
 template <class Domain, class Range>
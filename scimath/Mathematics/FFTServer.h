@@ -324,6 +324,24 @@ public:
 	    const Bool toFrequency=True);
   //# void fft0(Array<T> & rValues, const Bool toFrequency=True);
 
+  // </group>
+
+  // Batched complex to complex in-place transforms done by a single FFTW
+  // plan, which is much faster than transforming the arrays one by one.
+  // <src>fftStack</src> regards the Array as a stack of equally shaped
+  // arrays along its last axis (e.g. a Cube as a stack of planes) and
+  // transforms each of them over all its axes.
+  // <src>fftLines</src> transforms all lines along the given axis.
+  // The direction of the transform is controlled by the toFrequency
+  // variable. Scaling is always done on the backward transform.
+  // As for the other functions, the origin of the transform is the centre
+  // for the <src>fft</src> functions and the first element for the
+  // <src>fft0</src> functions.
+  // <group>
+  void fftStack(Array<S> & cValues, const Bool toFrequency=True);
+  void fft0Stack(Array<S> & cValues, const Bool toFrequency=True);
+  void fftLines(Array<S> & cValues, uInt axis, const Bool toFrequency=True);
+  void fft0Lines(Array<S> & cValues, uInt axis, const Bool toFrequency=True);
   // </group>
   //# Flips the quadrants in a complex Array so that the point at
   //# cData.shape()/2 moves to the origin. This moves, for example, the point
@@ -375,6 +393,14 @@ private:
   //# finds the shape of the output array when doing complex->real transforms
   IPosition determineShape(const IPosition & rShape, const Array<S> & cData);
 
+  //# Do the batched transforms over nAxes axes starting at firstAxis.
+  void fftMany(Array<S> & cValues, uInt firstAxis, uInt nAxes,
+               const Bool toFrequency, const Bool doShift);
+
+  //# Flip the axes to be transformed by fftMany.
+  void flipMany(S * data, const IPosition & shape, uInt firstAxis,
+                uInt nAxes, const Bool toZero);
+
   //# Data members.
   // The size of the last FFT done by this object
   IPosition itsSize;
@@ -390,6 +416,10 @@ private:
   std::vector<T> itsWorkIn;
   std::vector<S> itsWorkOut;
   std::vector<S> itsWorkC2C;
+  // The batched transform last planned (axes, direction, shape and
+  // alignment) and its work buffer (only used for measured plans).
+  IPosition      itsManyKey;
+  std::vector<S> itsWorkMany;
 };
 
 
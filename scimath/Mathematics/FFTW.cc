@@ -34,6 +34,11 @@
 #endif
 
 #include <iostream>
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
 
 
 namespace casacore {
@@ -44,6 +49,16 @@ std::mutex FFTW::theirMutex;
 
 #ifdef HAVE_FFTW3
 
+  // The FFTW planner is not thread-safe, so making and destroying plans is
+  // serialized by this mutex.
+  // It is allocated once and never deleted to avoid problems with the order
+  // of destruction of static objects.
+  static std::mutex& fftwPlannerMutex()
+  {
+    static std::mutex* mutex = new std::mutex;
+    return *mutex;
+  }
+
   class FFTWPlan
   {
   public:
@@ -51,7 +66,10 @@ std::mutex FFTW::theirMutex;
       : itsPlan(plan)
     {}
     ~FFTWPlan()
-      { fftw_destroy_plan(itsPlan); }
+    {
+      std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+      fftw_destroy_plan(itsPlan);
+    }
     fftw_plan getPlan()
       { return itsPlan; }
   private:
@@ -67,7 +85,10 @@ std::mutex FFTW::theirMutex;
       : itsPlan(plan)
     {}
     ~FFTWPlanf()
-      { fftwf_destroy_plan(itsPlan); }
+    {
+      std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+      fftwf_destroy_plan(itsPlan);
+    }
     fftwf_plan getPlan()
       { return itsPlan; }
   private:
@@ -76,9 +97,164 @@ std::mutex FFTW::theirMutex;
     fftwf_plan itsPlan;
   };
 
-    
+  // The plan cache.
+  // A plan can be reused for all arrays having the same shape and the same
+  // alignment as the arrays it was made for (using the new-array execute
+  // functions). The number of threads and the planner flags are part of
+  // the key as well.
+  struct FFTWPlanKey
+  {
+    enum Type {R2C, C2R, C2CF, C2CB, MANYF, MANYB};
+    int type;
+    std::vector<int> dims;
+    int nthreads;
+    unsigned flags;
+    int inAlign;
+    int outAlign;
+
+    bool operator< (const FFTWPlanKey& that) const
+    {
+      return std::tie (type, dims, nthreads, flags, inAlign, outAlign) <
+        std::tie (that.type, that.dims, that.nthreads, that.flags,
+                  that.inAlign, that.outAlign);
+    }
+  };
+
+  // A cached plan with the time it was last used.
+  template<typename PlanType>
+  struct FFTWCachedPlan
+  {
+    std::shared_ptr<PlanType> plan;
+    uInt64 lastUse;
+  };
+
+  // The number of plans is limited. If exceeded, the least recently used
+  // plans not in use by an FFTW object are removed.
+  struct FFTWPlanCache
+  {
+    int nthreads = 0;
+    unsigned flags = FFTW_ESTIMATE;
+    size_t maxPlans = 64;
+    uInt64 nused = 0;
+    std::map<FFTWPlanKey, FFTWCachedPlan<FFTWPlan>>  plans;
+    std::map<FFTWPlanKey, FFTWCachedPlan<FFTWPlanf>> plansf;
+  };
+
+  // Get the plan cache. It has to be used with the planner mutex locked.
+  static FFTWPlanCache& fftwPlanCache()
+  {
+    static FFTWPlanCache* cache = new FFTWPlanCache;
+    return *cache;
+  }
+
+  static std::vector<int> fftwDims (const IPosition& size)
+  {
+    return std::vector<int>(size.begin(), size.end());
+  }
+
+  // Remove the least recently used plans not in use by an FFTW object
+  // until the cache does not exceed its maximum size.
+  // The removed plans are moved to <src>removed</src>, so the caller can
+  // delete them after releasing the planner mutex.
+  template<typename PlanType>
+  static void fftwLimitPlans
+  (std::map<FFTWPlanKey, FFTWCachedPlan<PlanType>>& plans, size_t maxPlans,
+   std::vector<std::shared_ptr<PlanType>>& removed)
+  {
+    while (plans.size() > maxPlans) {
+      auto oldest = plans.end();
+      for (auto iter=plans.begin(); iter!=plans.end(); ++iter) {
+        if (iter->second.plan.use_count() == 1  &&
+            (oldest == plans.end()  ||
+             iter->second.lastUse < oldest->second.lastUse)) {
+          oldest = iter;
+        }
+      }
+      if (oldest == plans.end()) {
+        break;
+      }
+      removed.push_back (oldest->second.plan);
+      plans.erase (oldest);
+    }
+  }
+
+  // Get the plan for the given key from the cache. If not found, it is made
+  // using the given function and added to the cache.
+  template<typename PlanType, typename MakeFunc>
+  static std::shared_ptr<PlanType> fftwGetPlan
+  (std::map<FFTWPlanKey, FFTWCachedPlan<PlanType>> FFTWPlanCache::* plans,
+   int type, const std::vector<int>& dims, int inAlign, int outAlign,
+   MakeFunc makePlan)
+  {
+    // Removed plans are deleted after the lock is released, because the
+    // plan destructors lock the planner mutex.
+    std::vector<std::shared_ptr<PlanType>> removed;
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    FFTWPlanCache& cache = fftwPlanCache();
+    FFTWPlanKey key;
+    key.type = type;
+    key.dims = dims;
+    key.nthreads = 1;
+#ifdef _OPENMP
+    if (! omp_in_parallel()) {
+#endif
+      key.nthreads = cache.nthreads > 0  ?  cache.nthreads
+                                         :  std::max(1, HostInfo::numCPUs());
+#ifdef _OPENMP
+    }
+#endif
+    key.flags = cache.flags;
+    key.inAlign = inAlign;
+    key.outAlign = outAlign;
+    auto iter = (cache.*plans).find (key);
+    if (iter != (cache.*plans).end()) {
+      iter->second.lastUse = ++cache.nused;
+      return iter->second.plan;
+    }
+#ifdef HAVE_FFTW3_THREADS
+    fftwf_plan_with_nthreads(key.nthreads);
+    fftw_plan_with_nthreads(key.nthreads);
+#endif
+    auto plan = makePlan (key.flags);
+    if (plan == 0) {
+      throw std::runtime_error("FFTW could not make a plan");
+    }
+    std::shared_ptr<PlanType> planPtr (new PlanType(plan));
+    // Make room for the new plan.
+    fftwLimitPlans (cache.*plans, std::max(size_t(1), cache.maxPlans) - 1,
+                    removed);
+    FFTWCachedPlan<PlanType>& entry = (cache.*plans)[key];
+    entry.plan = planPtr;
+    entry.lastUse = ++cache.nused;
+    return planPtr;
+  }
+
+  // Make the FFTW guru dimensions for a batched transform of the given axes.
+  // FFTW uses C order, so the axes are reversed.
+  static void fftwManyDims (const IPosition& shape, uInt firstAxis, uInt nAxes,
+                            std::vector<fftw_iodim>& dims,
+                            std::vector<fftw_iodim>& howmanyDims)
+  {
+    std::vector<int> strides(shape.size());
+    int stride = 1;
+    for (uInt i=0; i<shape.size(); ++i) {
+      strides[i] = stride;
+      stride *= shape[i];
+    }
+    for (int i=shape.size()-1; i>=0; --i) {
+      fftw_iodim dim;
+      dim.n  = shape[i];
+      dim.is = dim.os = strides[i];
+      if (uInt(i) >= firstAxis  &&  uInt(i) < firstAxis + nAxes) {
+        dims.push_back (dim);
+      } else if (shape[i] > 1) {
+        howmanyDims.push_back (dim);
+      }
+    }
+  }
 
-  FFTW::FFTW() : flags(FFTW_ESTIMATE)
+
+  FFTW::FFTW()
   { 
     initialize_fftw();
   }
@@ -87,17 +263,9 @@ std::mutex FFTW::theirMutex;
   {
     std::lock_guard<std::mutex> lock(theirMutex);
     if (!is_initialized_fftw) {
-      int numCPUs = HostInfo::numCPUs();
-      int nthreads = 1;
-      if (numCPUs > 1) {
-        nthreads = numCPUs;
-      }
-      
 #ifdef HAVE_FFTW3_THREADS
       fftwf_init_threads();
       fftw_init_threads();
-      fftwf_plan_with_nthreads(nthreads);
-      fftw_plan_with_nthreads(nthreads);
 #endif
       is_initialized_fftw = true;
     }
@@ -119,126 +287,265 @@ std::mutex FFTW::theirMutex;
 
   void FFTW::plan_r2c(const IPosition &size, float *in, std::complex<float> *out) 
   {
-    itsPlanR2Cf.reset( new FFTWPlanf
-      (fftwf_plan_dft_r2c(size.nelements(),
-                          size.asStdVector().data(),
-                          in,
-                          reinterpret_cast<fftwf_complex *>(out), 
-                          flags)) );
+    itsPlanR2Cf = fftwGetPlan
+      (&FFTWPlanCache::plansf, FFTWPlanKey::R2C, fftwDims(size),
+       fftwf_alignment_of(in), fftwf_alignment_of((float*)out),
+       [&] (unsigned flags)
+       { return fftwf_plan_dft_r2c(size.nelements(),
+                                   size.asStdVector().data(),
+                                   in,
+                                   reinterpret_cast<fftwf_complex *>(out), 
+                                   flags); });
   }
 
   void FFTW::plan_r2c(const IPosition &size, double *in, std::complex<double> *out) 
   {
-    itsPlanR2C.reset( new FFTWPlan
-      (fftw_plan_dft_r2c(size.nelements(),
-                         size.asStdVector().data(),
-                         in,
-                         reinterpret_cast<fftw_complex *>(out), 
-                         flags)) );
+    itsPlanR2C = fftwGetPlan
+      (&FFTWPlanCache::plans, FFTWPlanKey::R2C, fftwDims(size),
+       fftw_alignment_of(in), fftw_alignment_of((double*)out),
+       [&] (unsigned flags)
+       { return fftw_plan_dft_r2c(size.nelements(),
+                                  size.asStdVector().data(),
+                                  in,
+                                  reinterpret_cast<fftw_complex *>(out), 
+                                  flags); });
   }
 
   void FFTW::plan_c2r(const IPosition &size, std::complex<float> *in, float *out) {
-    itsPlanC2Rf.reset( new FFTWPlanf
-      (fftwf_plan_dft_c2r(size.nelements(),
-                          size.asStdVector().data(),
-                          reinterpret_cast<fftwf_complex *>(in),
-                          out, 
-                          flags)) );
-
+    itsPlanC2Rf = fftwGetPlan
+      (&FFTWPlanCache::plansf, FFTWPlanKey::C2R, fftwDims(size),
+       fftwf_alignment_of((float*)in), fftwf_alignment_of(out),
+       [&] (unsigned flags)
+       { return fftwf_plan_dft_c2r(size.nelements(),
+                                   size.asStdVector().data(),
+                                   reinterpret_cast<fftwf_complex *>(in),
+                                   out, 
+                                   flags); });
   }
 
   void FFTW::plan_c2r(const IPosition &size, std::complex<double> *in, double *out) {
-    itsPlanC2R.reset( new FFTWPlan
-      (fftw_plan_dft_c2r(size.nelements(),
-                         size.asStdVector().data(),
-                         reinterpret_cast<fftw_complex *>(in), 
-                         out,
-                         flags)) );
+    itsPlanC2R = fftwGetPlan
+      (&FFTWPlanCache::plans, FFTWPlanKey::C2R, fftwDims(size),
+       fftw_alignment_of((double*)in), fftw_alignment_of(out),
+       [&] (unsigned flags)
+       { return fftw_plan_dft_c2r(size.nelements(),
+                                  size.asStdVector().data(),
+                                  reinterpret_cast<fftw_complex *>(in), 
+                                  out,
+                                  flags); });
   }
 
   void FFTW::plan_c2c_forward(const IPosition &size, std::complex<double> *in) {
-    itsPlanC2CF.reset( new FFTWPlan
-      (fftw_plan_dft(size.nelements(),
-                     size.asStdVector().data(),
-                     reinterpret_cast<fftw_complex *>(in), 
-                     reinterpret_cast<fftw_complex *>(in), 
-                     FFTW_FORWARD, flags)) );
-
+    itsPlanC2CF = fftwGetPlan
+      (&FFTWPlanCache::plans, FFTWPlanKey::C2CF, fftwDims(size),
+       fftw_alignment_of((double*)in), 0,
+       [&] (unsigned flags)
+       { return fftw_plan_dft(size.nelements(),
+                              size.asStdVector().data(),
+                              reinterpret_cast<fftw_complex *>(in), 
+                              reinterpret_cast<fftw_complex *>(in), 
+                              FFTW_FORWARD, flags); });
   }
     
   void FFTW::plan_c2c_forward(const IPosition &size, std::complex<float> *in) {
-    itsPlanC2CFf.reset( new FFTWPlanf
-      (fftwf_plan_dft(size.nelements(),
-                      size.asStdVector().data(),
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      FFTW_FORWARD, flags)) );
+    itsPlanC2CFf = fftwGetPlan
+      (&FFTWPlanCache::plansf, FFTWPlanKey::C2CF, fftwDims(size),
+       fftwf_alignment_of((float*)in), 0,
+       [&] (unsigned flags)
+       { return fftwf_plan_dft(size.nelements(),
+                               size.asStdVector().data(),
+                               reinterpret_cast<fftwf_complex *>(in), 
+                               reinterpret_cast<fftwf_complex *>(in), 
+                               FFTW_FORWARD, flags); });
   }
 
   void FFTW::plan_c2c_backward(const IPosition &size, std::complex<double> *in) {
-    itsPlanC2CB.reset( new FFTWPlan
-      (fftw_plan_dft(size.nelements(),
-                     size.asStdVector().data(),
-                     reinterpret_cast<fftw_complex *>(in), 
-                     reinterpret_cast<fftw_complex *>(in), 
-                     FFTW_BACKWARD, flags)) );
-      
+    itsPlanC2CB = fftwGetPlan
+      (&FFTWPlanCache::plans, FFTWPlanKey::C2CB, fftwDims(size),
+       fftw_alignment_of((double*)in), 0,
+       [&] (unsigned flags)
+       { return fftw_plan_dft(size.nelements(),
+                              size.asStdVector().data(),
+                              reinterpret_cast<fftw_complex *>(in), 
+                              reinterpret_cast<fftw_complex *>(in), 
+                              FFTW_BACKWARD, flags); });
   }
     
   void FFTW::plan_c2c_backward(const IPosition &size, std::complex<float> *in) {
-    itsPlanC2CBf.reset( new FFTWPlanf
-      (fftwf_plan_dft(size.nelements(),
-                      size.asStdVector().data(),
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      FFTW_BACKWARD, flags)) );
+    itsPlanC2CBf = fftwGetPlan
+      (&FFTWPlanCache::plansf, FFTWPlanKey::C2CB, fftwDims(size),
+       fftwf_alignment_of((float*)in), 0,
+       [&] (unsigned flags)
+       { return fftwf_plan_dft(size.nelements(),
+                               size.asStdVector().data(),
+                               reinterpret_cast<fftwf_complex *>(in), 
+                               reinterpret_cast<fftwf_complex *>(in), 
+                               FFTW_BACKWARD, flags); });
   }
 
-  // the parameters are used only in order to overload this function
-  void FFTW::r2c(const IPosition&, float*, std::complex<float>*) 
+  void FFTW::plan_c2c_many(const IPosition &shape, uInt firstAxis, uInt nAxes,
+                           std::complex<float> *in, bool forward)
+  {
+    std::vector<int> key (1, firstAxis);
+    key.push_back (nAxes);
+    key.insert (key.end(), shape.begin(), shape.end());
+    itsPlanManyf = fftwGetPlan
+      (&FFTWPlanCache::plansf,
+       forward ? FFTWPlanKey::MANYF : FFTWPlanKey::MANYB, key,
+       fftwf_alignment_of((float*)in), 0,
+       [&] (unsigned flags)
+       { std::vector<fftw_iodim> dims, howmanyDims;
+         fftwManyDims (shape, firstAxis, nAxes, dims, howmanyDims);
+         return fftwf_plan_guru_dft(dims.size(), dims.data(),
+                                    howmanyDims.size(), howmanyDims.data(),
+                                    reinterpret_cast<fftwf_complex *>(in), 
+                                    reinterpret_cast<fftwf_complex *>(in), 
+                                    forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                                    flags); });
+  }
+
+  void FFTW::plan_c2c_many(const IPosition &shape, uInt firstAxis, uInt nAxes,
+                           std::complex<double> *in, bool forward)
   {
-    fftwf_execute(itsPlanR2Cf->getPlan());
+    std::vector<int> key (1, firstAxis);
+    key.push_back (nAxes);
+    key.insert (key.end(), shape.begin(), shape.end());
+    itsPlanMany = fftwGetPlan
+      (&FFTWPlanCache::plans,
+       forward ? FFTWPlanKey::MANYF : FFTWPlanKey::MANYB, key,
+       fftw_alignment_of((double*)in), 0,
+       [&] (unsigned flags)
+       { std::vector<fftw_iodim> dims, howmanyDims;
+         fftwManyDims (shape, firstAxis, nAxes, dims, howmanyDims);
+         return fftw_plan_guru_dft(dims.size(), dims.data(),
+                                   howmanyDims.size(), howmanyDims.data(),
+                                   reinterpret_cast<fftw_complex *>(in), 
+                                   reinterpret_cast<fftw_complex *>(in), 
+                                   forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                                   flags); });
+  }
+
+  // The plans can be shared by multiple objects, so the new-array execute
+  // functions are used.
+  void FFTW::r2c(const IPosition&, float* in, std::complex<float>* out) 
+  {
+    fftwf_execute_dft_r2c(itsPlanR2Cf->getPlan(), in,
+                          reinterpret_cast<fftwf_complex *>(out));
   }
     
-  void FFTW::r2c(const IPosition&, double*, std::complex<double>*) 
+  void FFTW::r2c(const IPosition&, double* in, std::complex<double>* out) 
   {
-    fftw_execute(itsPlanR2C->getPlan());
+    fftw_execute_dft_r2c(itsPlanR2C->getPlan(), in,
+                         reinterpret_cast<fftw_complex *>(out));
   }
 
-  void FFTW::c2r(const IPosition&, std::complex<float>*, float*)
+  void FFTW::c2r(const IPosition&, std::complex<float>* in, float* out)
   {
-    fftwf_execute(itsPlanC2Rf->getPlan());
+    fftwf_execute_dft_c2r(itsPlanC2Rf->getPlan(),
+                          reinterpret_cast<fftwf_complex *>(in), out);
   }
     
-  void FFTW::c2r(const IPosition&, std::complex<double>*, double*)
+  void FFTW::c2r(const IPosition&, std::complex<double>* in, double* out)
   {
-    fftw_execute(itsPlanC2R->getPlan());
+    fftw_execute_dft_c2r(itsPlanC2R->getPlan(),
+                         reinterpret_cast<fftw_complex *>(in), out);
   }
     
-  void FFTW::c2c(const IPosition&, std::complex<float>*, bool forward)
+  void FFTW::c2c(const IPosition&, std::complex<float>* in, bool forward)
   {
+    fftwf_complex* data = reinterpret_cast<fftwf_complex *>(in);
     if (forward) {
-      fftwf_execute(itsPlanC2CFf->getPlan());
+      fftwf_execute_dft(itsPlanC2CFf->getPlan(), data, data);
     } else {
-      fftwf_execute(itsPlanC2CBf->getPlan());
+      fftwf_execute_dft(itsPlanC2CBf->getPlan(), data, data);
     }
   }
     
-  void FFTW::c2c(const IPosition&, std::complex<double>*, bool forward)
+  void FFTW::c2c(const IPosition&, std::complex<double>* in, bool forward)
   {
+    fftw_complex* data = reinterpret_cast<fftw_complex *>(in);
     if (forward) {
-      fftw_execute(itsPlanC2CF->getPlan());
+      fftw_execute_dft(itsPlanC2CF->getPlan(), data, data);
     } else {
-      fftw_execute(itsPlanC2CB->getPlan());
+      fftw_execute_dft(itsPlanC2CB->getPlan(), data, data);
     }
   }
 
+  void FFTW::c2c_many(std::complex<float>* in)
+  {
+    fftwf_complex* data = reinterpret_cast<fftwf_complex *>(in);
+    fftwf_execute_dft(itsPlanManyf->getPlan(), data, data);
+  }
+
+  void FFTW::c2c_many(std::complex<double>* in)
+  {
+    fftw_complex* data = reinterpret_cast<fftw_complex *>(in);
+    fftw_execute_dft(itsPlanMany->getPlan(), data, data);
+  }
+
+  void FFTW::setNumThreads(int nthreads)
+  {
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    fftwPlanCache().nthreads = nthreads;
+  }
+
+  void FFTW::setMeasurePlans(bool measure)
+  {
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    fftwPlanCache().flags = measure ? FFTW_MEASURE : FFTW_ESTIMATE;
+  }
+
+  bool FFTW::measurePlans()
+  {
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    return fftwPlanCache().flags == FFTW_MEASURE;
+  }
+
+  void FFTW::setPlanCacheSize(size_t nplans)
+  {
+    std::vector<std::shared_ptr<FFTWPlan>>  removed;
+    std::vector<std::shared_ptr<FFTWPlanf>> removedf;
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    FFTWPlanCache& cache = fftwPlanCache();
+    cache.maxPlans = nplans;
+    fftwLimitPlans (cache.plans, nplans, removed);
+    fftwLimitPlans (cache.plansf, nplans, removedf);
+  }
+
+  void FFTW::clearPlanCache()
+  {
+    // Delete the plans after releasing the lock, because the plan
+    // destructors lock the planner mutex.
+    std::map<FFTWPlanKey, FFTWCachedPlan<FFTWPlan>>  plans;
+    std::map<FFTWPlanKey, FFTWCachedPlan<FFTWPlanf>> plansf;
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    plans.swap (fftwPlanCache().plans);
+    plansf.swap (fftwPlanCache().plansf);
+  }
+
+  bool FFTW::importWisdom(const std::string &fileName)
+  {
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    bool ok = fftw_import_wisdom_from_filename(fileName.c_str()) != 0;
+    return fftwf_import_wisdom_from_filename((fileName + ".f").c_str()) != 0
+      && ok;
+  }
+
+  bool FFTW::exportWisdom(const std::string &fileName)
+  {
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
+    bool ok = fftw_export_wisdom_to_filename(fileName.c_str()) != 0;
+    return fftwf_export_wisdom_to_filename((fileName + ".f").c_str()) != 0
+      && ok;
+  }
+
   FFTW::Plan FFTW::plan_redft00(const IPosition &size, float *in, float *out)
   {
     initialize_fftw();
     
     std::vector<fftwf_r2r_kind> kinds(size.nelements(), FFTW_REDFT00);
     
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
     return Plan( new FFTWPlanf(
       fftwf_plan_r2r(size.nelements(), size.asStdVector().data(),
                      in, out, kinds.data(), FFTW_ESTIMATE)) );
@@ -250,6 +557,7 @@ std::mutex FFTW::theirMutex;
     
     std::vector<fftw_r2r_kind> kinds(size.nelements(), FFTW_REDFT00);
     
+    std::lock_guard<std::mutex> lock(fftwPlannerMutex());
     return Plan( new FFTWPlan(
       fftw_plan_r2r(size.nelements(), size.asStdVector().data(),
                     in, out, kinds.data(), FFTW_ESTIMATE)) );
@@ -302,6 +610,30 @@ std::mutex FFTW::theirMutex;
   {}
   void FFTW::c2c(const IPosition&, std::complex<double>*, Bool)
   {}
+  void FFTW::plan_c2c_many(const IPosition&, uInt, uInt,
+                           std::complex<float>*, bool)
+  {}
+  void FFTW::plan_c2c_many(const IPosition&, uInt, uInt,
+                           std::complex<double>*, bool)
+  {}
+  void FFTW::c2c_many(std::complex<float>*)
+  {}
+  void FFTW::c2c_many(std::complex<double>*)
+  {}
+  void FFTW::setNumThreads(int)
+  {}
+  void FFTW::setMeasurePlans(bool)
+  {}
+  bool FFTW::measurePlans()
+  { return false; }
+  void FFTW::setPlanCacheSize(size_t)
+  {}
+  void FFTW::clearPlanCache()
+  {}
+  bool FFTW::importWisdom(const std::string&)
+  { return false; }
+  bool FFTW::exportWisdom(const std::string&)
+  { return false; }
 
   FFTW::Plan FFTW::plan_redft00(const IPosition &, float *, float *)
   { throw std::runtime_error("FFTW not available"); }
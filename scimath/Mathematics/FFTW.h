@@ -31,6 +31,7 @@
 #include <complex>
 #include <memory>
 #include <mutex>
+#include <string>
 
 namespace casacore {
 
@@ -49,6 +50,18 @@ class FFTWPlanf;
 // The interface is such that the presence of FFTW3 is only visible
 // in the implementation. The header file does not need to know.
 // In this way external code using this class does not need to set HAVE_FFTW.
+//
+// Plans are kept in a process-wide cache, so creating a plan for a shape
+// (and type and data alignment) that was planned before is cheap. This
+// matters for code doing many transforms of the same size with
+// different FFTServer objects. The size of the cache is limited; the least
+// recently used plans are removed first. Planning is serialized by a mutex, because
+// the FFTW planner is not thread-safe. The execution is thread-safe; the
+// data arrays given to the execute functions should be aligned in the same
+// way as the ones given to the plan functions (which is the case when the
+// same buffers are used).
+// <br>The wisdom gathered by FFTW can be saved in a file and read back in a
+// later run. It is only useful if plans are made with setMeasurePlans(true).
 // </synopsis>
 
 class FFTW
@@ -78,6 +91,58 @@ public:
   void c2c(const IPosition &size, std::complex<float> *in, bool forward);
   void c2c(const IPosition &size, std::complex<double> *in, bool forward);
 
+  // Plan a batch of in-place complex to complex transforms of an array
+  // with the given (casacore) shape. The array is transformed over the
+  // <src>nAxes</src> axes starting at <src>firstAxis</src> and the
+  // transforms are repeated for all other axes. In this way a stack of
+  // arrays (all axes but the last one) or all lines along an axis can be
+  // transformed by a single plan.
+  // <group>
+  void plan_c2c_many(const IPosition &shape, uInt firstAxis, uInt nAxes,
+                     std::complex<float> *in, bool forward);
+  void plan_c2c_many(const IPosition &shape, uInt firstAxis, uInt nAxes,
+                     std::complex<double> *in, bool forward);
+  // </group>
+
+  // Execute the batched transforms planned by plan_c2c_many.
+  // <group>
+  void c2c_many(std::complex<float> *in);
+  void c2c_many(std::complex<double> *in);
+  // </group>
+
+  // Set the number of threads FFTW can use for the plans made hereafter.
+  // The default 0 means the number of CPUs. Plans made in an OpenMP
+  // parallel region always use a single thread.
+  static void setNumThreads(int nthreads);
+
+  // Plan using FFTW_MEASURE instead of FFTW_ESTIMATE (which is the default).
+  // Measuring takes much more time, but can result in faster plans and
+  // useful wisdom.
+  // <br>Note that measuring overwrites the data arrays given to the plan
+  // functions.
+  static void setMeasurePlans(bool measure);
+
+  // Tell if plans are made using FFTW_MEASURE.
+  static bool measurePlans();
+
+  // Set the maximum number of plans (per precision) kept in the plan cache.
+  // When exceeded, the least recently used plans not in use by an FFTW
+  // object are removed from the cache. The default is 64.
+  static void setPlanCacheSize(size_t nplans);
+
+  // Remove all plans from the plan cache. Plans still in use by FFTW
+  // objects are deleted when these objects are deleted.
+  static void clearPlanCache();
+
+  // Read the FFTW wisdom from a file or save it into a file.
+  // The double precision wisdom is kept in the given file, the single
+  // precision wisdom in the file with suffix <src>.f</src>.
+  // They return false if a file could not be read or written.
+  // <group>
+  static bool importWisdom(const std::string &fileName);
+  static bool exportWisdom(const std::string &fileName);
+  // </group>
+
   class Plan
   {
     public:
@@ -107,32 +172,28 @@ public:
 private:
   static void initialize_fftw();
   
-  std::unique_ptr<FFTWPlanf> itsPlanR2Cf;
-  std::unique_ptr<FFTWPlan>  itsPlanR2C;
+  std::shared_ptr<FFTWPlanf> itsPlanR2Cf;
+  std::shared_ptr<FFTWPlan>  itsPlanR2C;
   
-  std::unique_ptr<FFTWPlanf> itsPlanC2Rf;
-  std::unique_ptr<FFTWPlan>  itsPlanC2R;
+  std::shared_ptr<FFTWPlanf> itsPlanC2Rf;
+  std::shared_ptr<FFTWPlan>  itsPlanC2R;
   
-  std::unique_ptr<FFTWPlanf> itsPlanC2CFf;   // forward
-  std::unique_ptr<FFTWPlan>  itsPlanC2CF;
+  std::shared_ptr<FFTWPlanf> itsPlanC2CFf;   // forward
+  std::shared_ptr<FFTWPlan>  itsPlanC2CF;
   
-  std::unique_ptr<FFTWPlanf> itsPlanC2CBf;   // backward
-  std::unique_ptr<FFTWPlan>  itsPlanC2CB;
+  std::shared_ptr<FFTWPlanf> itsPlanC2CBf;   // backward
+  std::shared_ptr<FFTWPlan>  itsPlanC2CB;
   
   std::unique_ptr<FFTWPlanf> itsPlanR2Rf;
   std::unique_ptr<FFTWPlan>  itsPlanR2R;
   
-  unsigned flags;
+  std::shared_ptr<FFTWPlanf> itsPlanManyf;   // batched c2c
+  std::shared_ptr<FFTWPlan>  itsPlanMany;
 
   static bool is_initialized_fftw;  // FFTW needs initialization
                                              // only once per process,
                                              // not once per object
                                              
-  // TODO this mutex does not make FFTW thread safe, because
-  // planning an FFT with FFTW is not thread safe either.
-  // So either the plan..() methods should take the mutex, or
-  // FFTW should leave synchronization fully to the user of
-  // this class: currently it's halfway in between.
   static std::mutex theirMutex;          // Initialization mutex
 };    
     
@@ -0,0 +1,164 @@
+//# tConvolveGridder.cc: Test program for class ConvolveGridder
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/aips.h>
+#include <casacore/scimath/Mathematics/ConvolveGridder.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <random>
+
+#include <casacore/casa/namespace.h>
+
+// Make a value from a random number.
+template <class T> T makeValue (std::mt19937& gen)
+{
+  std::uniform_real_distribution<double> dist(-1, 1);
+  return T(dist(gen));
+}
+template <> Complex makeValue (std::mt19937& gen)
+{
+  std::uniform_real_distribution<float> dist(-1, 1);
+  Float re = dist(gen);
+  return Complex(re, dist(gen));
+}
+
+// Return the maximum amplitude of a real or complex array.
+Double maxAmplitude (const Array<Double>& arr)
+  { return max(abs(arr)); }
+Double maxAmplitude (const Array<Float>& arr)
+  { return max(abs(arr)); }
+Double maxAmplitude (const Array<Complex>& arr)
+  { return max(amplitude(arr)); }
+
+// Grid and degrid random values one at a time and as a batch, and check
+// that the results are the same (within rounding errors).
+// The first two positions are off the grid.
+template <class T>
+void doTest (const IPosition& shape, const String& convType,
+             Bool useOffset, uInt nvalues, Double tol)
+{
+  cout << "Test " << shape << ' ' << convType << endl;
+  const uInt ndim = shape.nelements();
+  Vector<Double> scale(ndim, 2.);
+  Vector<Double> offset(ndim);
+  for (uInt i=0; i<ndim; ++i) {
+    offset[i] = shape[i] / 2;
+  }
+  ConvolveGridder<Double,T> gridder(shape, scale, offset, convType);
+  if (useOffset) {
+    gridder.setOffset (IPosition(ndim, 1));
+  }
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> distPos(-0.2, 0.2);
+  std::uniform_real_distribution<float> distWgt(0.5, 2);
+  Matrix<Double> positions(ndim, nvalues);
+  Vector<T> values(nvalues);
+  Vector<Float> weights(nvalues);
+  for (uInt i=0; i<nvalues; ++i) {
+    for (uInt j=0; j<ndim; ++j) {
+      positions(j,i) = distPos(gen) * shape[j];
+    }
+    values[i] = makeValue<T>(gen);
+    weights[i] = distWgt(gen);
+  }
+  positions(0,0) = 0.3 * shape[0];
+  positions(ndim-1,1) = -0.3 * shape[ndim-1];
+  // Grid one at a time.
+  Array<T> grid1(shape);
+  grid1 = T(0);
+  uInt ngrid = 0;
+  for (uInt i=0; i<nvalues; ++i) {
+    T value = values[i] * weights[i];
+    if (gridder.grid (grid1, positions.column(i), value)) {
+      ngrid++;
+    }
+  }
+  AlwaysAssert (ngrid == nvalues-2, AipsError);
+  // Grid as a batch.
+  Array<T> grid2(shape);
+  grid2 = T(0);
+  AlwaysAssert (gridder.grid (grid2, positions, values, weights) == ngrid,
+                AipsError);
+  Double maxAbs = maxAmplitude(grid1);
+  AlwaysAssert (allNearAbs (grid1, grid2, tol*maxAbs), AipsError);
+  // The convolution function is normalized, so the flux is preserved.
+  T expSum(0);
+  for (uInt i=2; i<nvalues; ++i) {
+    expSum += values[i] * weights[i];
+  }
+  AlwaysAssert (abs(sum(grid2) - expSum) <= tol*nvalues, AipsError);
+  // Without weights.
+  Array<T> grid3(shape);
+  grid3 = T(0);
+  AlwaysAssert (gridder.grid (grid3, positions, values) == ngrid,
+                AipsError);
+  // The result must not depend on the number of threads.
+  uInt nthr = OMP::maxThreads();
+  if (nthr > 1) {
+    Array<T> grid4(shape);
+    grid4 = T(0);
+    OMP::setNumThreads (1);
+    gridder.grid (grid4, positions, values, weights);
+    OMP::setNumThreads (nthr);
+    AlwaysAssert (allEQ (grid2, grid4), AipsError);
+  }
+  // Degrid from the gridded data.
+  Vector<T> degrid2;
+  uInt ndegrid = gridder.degrid (grid2, positions, degrid2);
+  AlwaysAssert (degrid2.size() == nvalues, AipsError);
+  uInt ndegrid1 = 0;
+  for (uInt i=0; i<nvalues; ++i) {
+    T value(0);
+    if (gridder.degrid (grid2, positions.column(i), value)) {
+      ndegrid1++;
+    }
+    AlwaysAssert (abs(value - degrid2[i]) <= tol*maxAbs, AipsError);
+  }
+  AlwaysAssert (ndegrid == ndegrid1, AipsError);
+}
+
+int main()
+{
+  try {
+    doTest<Complex> (IPosition(2, 256, 200), "SF", False, 50000, 1e-5);
+    doTest<Complex> (IPosition(2, 256, 200), "SF", True, 50000, 1e-5);
+    doTest<Complex> (IPosition(2, 128, 128), "BOX", False, 20000, 1e-5);
+    doTest<Double> (IPosition(2, 300, 150), "SF", False, 50000, 1e-10);
+    doTest<Float> (IPosition(1, 1000), "SF", False, 10000, 1e-5);
+    doTest<Double> (IPosition(3, 64, 48, 40), "SF", False, 20000, 1e-10);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,118 @@
+//# tConvolveGridderPerf.cc: Performance test of class ConvolveGridder
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/aips.h>
+#include <casacore/scimath/Mathematics/ConvolveGridder.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <random>
+#include <cstdlib>
+
+#include <casacore/casa/namespace.h>
+
+// This program compares the time of gridding and degridding visibilities
+// one at a time and as a batch.
+// It can be run as: tConvolveGridderPerf [gridsize] [nvalues]
+
+int main (int argc, char* argv[])
+{
+  try {
+    Int size = 1024;
+    uInt nvalues = 1000000;
+    if (argc > 1) size = atoi(argv[1]);
+    if (argc > 2) nvalues = atoi(argv[2]);
+    cout << "Gridding " << nvalues << " values on a " << size << 'x' << size
+         << " grid using " << OMP::maxThreads() << " threads" << endl;
+    IPosition shape(2, size, size);
+    Vector<Double> scale(2, 1.);
+    Vector<Double> offset(2, Double(size/2));
+    ConvolveGridder<Double,Complex> gridder(shape, scale, offset, "SF");
+    // Make uv positions with a density decreasing with uv distance.
+    // Keep them away from the grid edges, so all values are gridded.
+    std::mt19937 gen(1);
+    std::normal_distribution<double> distPos(0., size/8.);
+    std::uniform_real_distribution<float> distVal(-1., 1.);
+    Matrix<Double> uv(2, nvalues);
+    Vector<Complex> values(nvalues);
+    Vector<Float> weights(nvalues, 1.);
+    for (uInt i=0; i<nvalues; ++i) {
+      for (uInt j=0; j<2; ++j) {
+        do {
+          uv(j,i) = distPos(gen);
+        } while (abs(uv(j,i)) > size/2 - 4);
+      }
+      Float re = distVal(gen);
+      values[i] = Complex(re, distVal(gen));
+    }
+    Array<Complex> grid1(shape);
+    Array<Complex> grid2(shape);
+    grid1 = Complex();
+    grid2 = Complex();
+    {
+      Timer timer;
+      Vector<Double> pos(2);
+      for (uInt i=0; i<nvalues; ++i) {
+        pos[0] = uv(0,i);
+        pos[1] = uv(1,i);
+        gridder.grid (grid1, pos, values[i]);
+      }
+      timer.show ("grid single  ");
+    }
+    {
+      Timer timer;
+      gridder.grid (grid2, uv, values, weights);
+      timer.show ("grid batch   ");
+    }
+    cout << "max difference " << max(amplitude(grid1 - grid2)) << endl;
+    Vector<Complex> degrid1(nvalues, Complex());
+    Vector<Complex> degrid2;
+    {
+      Timer timer;
+      Vector<Double> pos(2);
+      for (uInt i=0; i<nvalues; ++i) {
+        pos[0] = uv(0,i);
+        pos[1] = uv(1,i);
+        gridder.degrid (grid2, pos, degrid1[i]);
+      }
+      timer.show ("degrid single");
+    }
+    {
+      Timer timer;
+      gridder.degrid (grid2, uv, degrid2);
+      timer.show ("degrid batch ");
+    }
+    cout << "max difference " << max(amplitude(degrid1 - degrid2)) << endl;
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/Cube.h>
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/VectorIter.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Arrays/IPosition.h>
@@ -42,6 +43,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/iostream.h>
+#include <cstdio>
 
 #include <casacore/casa/namespace.h>
 
@@ -2199,6 +2201,102 @@ class TestC2C
 
 
 
+template <class T, class S>
+class TestMany
+{
+public:
+  TestMany()  // test the batched complex->complex functions
+  {
+    FFTServer<T, S> server;
+    FFTServer<T, S> server1;
+    Cube<S> input(6, 5, 3);
+    for (uInt i = 0; i < input.nelements(); ++i) {
+      input.data()[i] = S(i%7, Int(i%4) - 2);
+    }
+    for (int shifted = 0; shifted < 2; ++shifted) {
+      // Stack of planes.
+      Cube<S> result(input.copy());
+      Cube<S> expected(input.copy());
+      if (shifted) {
+        server.fftStack(result);
+      } else {
+        server.fft0Stack(result);
+      }
+      for (uInt i = 0; i < expected.nplane(); ++i) {
+        Matrix<S> plane(expected.xyPlane(i));
+        if (shifted) {
+          server1.fft(plane);
+        } else {
+          server1.fft0(plane);
+        }
+      }
+      AlwaysTrue(allNearAbs(result, expected, 100*FLT_EPSILON), AipsError);
+      if (shifted) {
+        server.fftStack(result, False);
+      } else {
+        server.fft0Stack(result, False);
+      }
+      AlwaysTrue(allNearAbs(result, input, 100*FLT_EPSILON), AipsError);
+      // Lines along each axis.
+      for (uInt axis = 0; axis < 3; ++axis) {
+        Array<S> result(input.copy());
+        Array<S> expected(input.copy());
+        if (shifted) {
+          server.fftLines(result, axis);
+        } else {
+          server.fft0Lines(result, axis);
+        }
+        VectorIterator<S> iter(expected, axis);
+        while (!iter.pastEnd()) {
+          if (shifted) {
+            server1.fft(iter.vector());
+          } else {
+            server1.fft0(iter.vector());
+          }
+          iter.next();
+        }
+        AlwaysTrue(allNearAbs(result, expected, 100*FLT_EPSILON), AipsError);
+        if (shifted) {
+          server.fftLines(result, axis, False);
+        } else {
+          server.fft0Lines(result, axis, False);
+        }
+        AlwaysTrue(allNearAbs(result, input, 100*FLT_EPSILON), AipsError);
+      }
+    }
+#ifdef HAVE_FFTW3
+    // Save and read back the wisdom.
+    AlwaysTrue(FFTW::exportWisdom("tFFTServer_tmp.wisdom"), AipsError);
+    AlwaysTrue(FFTW::importWisdom("tFFTServer_tmp.wisdom"), AipsError);
+    std::remove("tFFTServer_tmp.wisdom");
+    std::remove("tFFTServer_tmp.wisdom.f");
+    // Plans still in use must survive clearing the cache.
+    FFTW::clearPlanCache();
+    Array<S> result(input.copy());
+    server.fft0Lines(result, 1);
+    server.fft0Lines(result, 1, False);
+    AlwaysTrue(allNearAbs(result, input, 100*FLT_EPSILON), AipsError);
+    // A tiny plan cache must evict plans without affecting the results.
+    // Also transform unaligned data and use measured plans (which plan
+    // on a work buffer).
+    FFTW::setPlanCacheSize(1);
+    for (uInt i = 0; i < 2; ++i) {
+      FFTW::setMeasurePlans(i == 1);
+      for (uInt axis = 0; axis < 3; ++axis) {
+        Vector<S> buf(input.nelements() + 1);
+        Array<S> unaligned(input.shape(), buf.data() + 1, SHARE);
+        unaligned = input;
+        server.fft0Lines(unaligned, axis);
+        server.fft0Lines(unaligned, axis, False);
+        AlwaysTrue(allNearAbs(unaligned, input, 100*FLT_EPSILON), AipsError);
+      }
+    }
+    FFTW::setMeasurePlans(false);
+    FFTW::setPlanCacheSize(64);
+#endif
+  }
+};
+
 template <class T, class S>
 void run_tests()
 {
@@ -2278,6 +2376,7 @@ void run_tests()
     TestC2C<S, C2C4Doddoddoddeven2, T, S> c2c21(server, 500*FLT_EPSILON, 2*FLT_EPSILON);
 
     TestFFTShift<T, S> ();
+    TestMany<T, S> ();
 
     return;
 }
@@ -2295,6 +2394,7 @@ int main()
       // - fft() / fft0()
       // - inplace / copy
       // - const / non-const input
+      // - batched transforms
 
       run_tests<Float, Complex>();
       run_tests<Double, DComplex>();
@@ -39,6 +39,7 @@
 #include <casacore/tables/DataMan/TiledCellStMan.h>
 #include <casacore/tables/DataMan/TiledColumnStMan.h>
 #include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledCompressStMan.h>
 #include <casacore/tables/DataMan/MemoryStMan.h>
 
 //#   virtual column engines
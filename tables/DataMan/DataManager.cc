@@ -34,6 +34,7 @@
 #include <casacore/tables/DataMan/TiledCellStMan.h>
 #include <casacore/tables/DataMan/TiledColumnStMan.h>
 #include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledCompressStMan.h>
 #include <casacore/tables/DataMan/MemoryStMan.h>
 #include <casacore/tables/DataMan/CompressFloat.h>
 #include <casacore/tables/DataMan/CompressComplex.h>
@@ -419,6 +420,7 @@ std::map<String,DataManagerCtor> DataManager::initRegisterMap()
   theirRegisterMap.insert (std::make_pair("TiledCellStMan",   TiledCellStMan::makeObject));
   theirRegisterMap.insert (std::make_pair("TiledColumnStMan", TiledColumnStMan::makeObject));
   theirRegisterMap.insert (std::make_pair("TiledShapeStMan",  TiledShapeStMan::makeObject));
+  theirRegisterMap.insert (std::make_pair("TiledCompressStMan", TiledCompressStMan::makeObject));
   theirRegisterMap.insert (std::make_pair("MemoryStMan",      MemoryStMan::makeObject));
 #ifdef HAVE_ADIOS2
   theirRegisterMap.insert (std::make_pair("Adios2StMan",      Adios2StMan::makeObject));
@@ -57,6 +57,7 @@ ISMBase::ISMBase (uInt bucketSize, Bool checkBucketSize, uInt cacheSize)
   index_p           (0),
   persCacheSize_p   (cacheSize),
   cacheSize_p       (0),
+  prefetch_p        (0),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -78,6 +79,7 @@ ISMBase::ISMBase (const String& dataManagerName,
   index_p           (0),
   persCacheSize_p   (cacheSize),
   cacheSize_p       (0),
+  prefetch_p        (0),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -98,6 +100,7 @@ ISMBase::ISMBase (const String& dataManagerName, const Record& spec)
   index_p           (0),
   persCacheSize_p   (1),
   cacheSize_p       (0),
+  prefetch_p        (0),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -128,6 +131,7 @@ ISMBase::ISMBase (const ISMBase& that)
   index_p           (0),
   persCacheSize_p   (that.persCacheSize_p),
   cacheSize_p       (that.cacheSize_p),
+  prefetch_p        (that.prefetch_p),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -272,6 +276,14 @@ void ISMBase::setCacheSize (uInt cacheSize, Bool canExceedNrBuckets)
     }
 }
 
+void ISMBase::setPrefetch (uInt nrBuckets)
+{
+    prefetch_p = nrBuckets;
+    if (cache_p != 0) {
+	cache_p->setPrefetch (prefetch_p);
+    }
+}
+
 void ISMBase::makeCache()
 {
     if (cache_p == 0) {
@@ -288,6 +300,7 @@ void ISMBase::makeCache()
 				   ISMBucket::initCallBack,
 				   ISMBucket::deleteCallBack);
 	cache_p->resync (nbucketInit_p, nFreeBucket_p, firstFree_p);
+	cache_p->setPrefetch (prefetch_p);
 	// Allocate a buffer for temporary storage by all ISM classes.
 	if (tempBuffer_p == 0) {
 	    tempBuffer_p = new char [bucketSize_p];
@@ -645,6 +658,10 @@ StManArrayFile* ISMBase::openArrayFile (ByteIO::OpenOption opt)
 
 void ISMBase::reopenRW()
 {
+    // The file gets reopened, so stop reading ahead in it.
+    if (cache_p != 0) {
+	cache_p->clearPrefetch();
+    }
     file_p->setRW();
     uInt nrcol = ncolumn();
     for (uInt i=0; i<nrcol; i++) {
@@ -147,6 +147,15 @@ public:
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
+    // Set the maximum number of buckets to be read ahead in a background
+    // thread when a sequential or strided access pattern is detected
+    // (see class <linkto class=BucketCache>BucketCache</linkto>).
+    // A value of 0 (the default) switches prefetching off.
+    void setPrefetch (uInt nrBuckets);
+
+    // Get the maximum number of buckets to be read ahead.
+    uInt prefetch() const;
+
     // Clear the cache used by this storage manager.
     // It will flush the cache as needed and remove all buckets from it.
     void clearCache();
@@ -361,6 +370,8 @@ private:
     uInt persCacheSize_p;
     // The actual cache size.
     uInt cacheSize_p;
+    // The maximum number of buckets to read ahead.
+    uInt prefetch_p;
     // The initial number of buckets in the cache.
     uInt nbucketInit_p;
     // The nr of free buckets.
@@ -391,6 +402,10 @@ inline uInt ISMBase::cacheSize() const
 {
     return cacheSize_p;
 }
+inline uInt ISMBase::prefetch() const
+{
+    return prefetch_p;
+}
 
 inline uInt ISMBase::uniqueNr()
 {
@@ -75,6 +75,15 @@ uInt ROIncrementalStManAccessor::cacheSize() const
     return dataManPtr_p->cacheSize();
 }
 
+void ROIncrementalStManAccessor::setPrefetch (uInt nrBuckets)
+{
+    dataManPtr_p->setPrefetch (nrBuckets);
+}
+uInt ROIncrementalStManAccessor::prefetch() const
+{
+    return dataManPtr_p->prefetch();
+}
+
 void ROIncrementalStManAccessor::clearCache()
 {
     dataManPtr_p->clearCache();
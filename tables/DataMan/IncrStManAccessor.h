@@ -130,6 +130,15 @@ public:
     // Get the cache size (in buckets).
     uInt cacheSize() const;
 
+    // Set the maximum number of buckets the storage manager reads ahead
+    // in a background thread when it detects a sequential or strided
+    // access pattern. 0 switches prefetching off (which is the default).
+    // Like the cache size given in this way, it is not persistent.
+    void setPrefetch (uInt nrBuckets);
+
+    // Get the maximum number of buckets read ahead.
+    uInt prefetch() const;
+
     // Clear the caches used by the hypercubes in this storage manager.
     // It will flush the caches as needed and remove all buckets from them
     // resulting in a possibly large drop in memory used.
@@ -62,6 +62,8 @@ SSMBase::SSMBase (Int aBucketSize, uInt aCacheSize)
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
   itsCacheSize         (0),
+  itsPrefetch          (0),
+  itsConcurrentShards  (0),
   itsNrBuckets         (0), 
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -94,6 +96,8 @@ SSMBase::SSMBase (const String& aDataManName,
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
   itsCacheSize         (0),
+  itsPrefetch          (0),
+  itsConcurrentShards  (0),
   itsNrBuckets         (0), 
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -126,6 +130,8 @@ SSMBase::SSMBase (const String& aDataManName,
   itsStringHandler     (0),
   itsPersCacheSize     (2),
   itsCacheSize         (0),
+  itsPrefetch          (0),
+  itsConcurrentShards  (0),
   itsNrBuckets         (0), 
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -167,6 +173,8 @@ SSMBase::SSMBase (const SSMBase& that)
   itsStringHandler     (0),
   itsPersCacheSize     (that.itsPersCacheSize),
   itsCacheSize         (0),
+  itsPrefetch          (0),
+  itsConcurrentShards  (0),
   itsNrBuckets         (0),
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -182,6 +190,7 @@ SSMBase::SSMBase (const SSMBase& that)
 
 SSMBase::~SSMBase()
 {
+  itsConcurrentCache.reset();
   for (uInt i=0; i<ncolumn(); i++) {
     delete itsPtrColumn[i];
   }
@@ -347,6 +356,39 @@ void SSMBase::setCacheSize (uInt aCacheSize, Bool canExceedNrBuckets)
   }
 }
 
+void SSMBase::setPrefetch (uInt nrBuckets)
+{
+  itsPrefetch = nrBuckets;
+  if (itsCache != 0) {
+    itsCache->setPrefetch (itsPrefetch);
+  }
+}
+
+void SSMBase::setConcurrentRead (uInt nrShards)
+{
+  getCache();
+  if (nrShards > 0  &&  itsFile->isWritable()) {
+    throw DataManError ("SSMBase::setConcurrentRead: concurrent reading of "
+                        "StandardStMan " + itsDataManName +
+                        " is not possible, because it is writable");
+  }
+  itsConcurrentShards = nrShards;
+  makeConcurrentCache();
+}
+
+void SSMBase::makeConcurrentCache()
+{
+  itsConcurrentCache.reset();
+  if (itsConcurrentShards > 0) {
+    itsConcurrentCache.reset (new ConcurrentBucketCache
+                              (itsFile, 512, itsBucketSize, itsNrBuckets,
+                               itsCacheSize, itsConcurrentShards,
+                               this,
+                               SSMBase::readCallBack,
+                               SSMBase::deleteCallBack));
+  }
+}
+
 void SSMBase::makeCache()
 {
   if (itsCache == 0) {
@@ -371,6 +413,7 @@ void SSMBase::makeCache()
 				SSMBase::deleteCallBack);
     itsCache->resync (itsNrBuckets, itsFreeBucketsNr, 
 		      itsFirstFreeBucket);
+    itsCache->setPrefetch (itsPrefetch);
 
     if (forceFill) {
       readIndexBuckets();
@@ -896,6 +939,21 @@ char* SSMBase::initCallBack (void* anOwner)
   return aBucket;
 }
 
+ConcurrentBucketCache::PinnedBucket
+SSMBase::findPinned (rownr_t aRowNr, uInt aColNr, const char*& aData,
+                     rownr_t& aStartRow, rownr_t& anEndRow,
+                     const String& colName)
+{
+  AlwaysAssert (itsConcurrentCache != 0, AipsError);
+  SSMIndex* anIndexPtr = itsPtrIndex[itsColIndexMap[aColNr]];
+  uInt aBucketNr;
+  anIndexPtr->find(aRowNr,aBucketNr,aStartRow,anEndRow, colName);
+  ConcurrentBucketCache::PinnedBucket aBucket =
+    itsConcurrentCache->getBucket(aBucketNr);
+  aData = aBucket.get() + itsColumnOffset[aColNr];
+  return aBucket;
+}
+
 char* SSMBase::find(rownr_t aRowNr,     uInt aColNr, 
 		    rownr_t& aStartRow, rownr_t& anEndRow,
                     const String& colName)
@@ -914,6 +972,8 @@ char* SSMBase::find(rownr_t aRowNr,     uInt aColNr,
 
 void SSMBase::recreate()
 {
+  itsConcurrentCache.reset();
+  itsConcurrentShards = 0;
   delete itsCache;
   itsCache = 0;
   delete itsFile;
@@ -994,6 +1054,10 @@ rownr_t SSMBase::resync64 (rownr_t aNrRows)
   if (itsStringHandler != 0) {
     itsStringHandler->resync();
   }
+  // The number of buckets might have changed.
+  if (itsConcurrentCache) {
+    makeConcurrentCache();
+  }
 
   uInt aNrCol = ncolumn();
   if (itsIosFile != 0) {
@@ -1045,6 +1109,13 @@ StManArrayFile* SSMBase::openArrayFile (ByteIO::OpenOption anOpt)
 
 void SSMBase::reopenRW()
 {
+  // Concurrent reading is not possible anymore.
+  itsConcurrentCache.reset();
+  itsConcurrentShards = 0;
+  // The file gets reopened, so stop reading ahead in it.
+  if (itsCache != 0) {
+    itsCache->clearPrefetch();
+  }
   if (itsFile != 0) {
     itsFile->setRW();
   }
@@ -1055,6 +1126,7 @@ void SSMBase::reopenRW()
 
 void SSMBase::deleteManager()
 {
+  itsConcurrentCache.reset();
   delete itsIosFile;
   itsIosFile = 0;
   // Clear cache without flushing.
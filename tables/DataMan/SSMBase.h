@@ -31,6 +31,8 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/IO/ConcurrentBucketCache.h>
+#include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -209,6 +211,35 @@ public:
 
   // Get the current cache size (in buckets).
   uInt getCacheSize() const;
+
+  // Set the maximum number of buckets to be read ahead in a background
+  // thread when a sequential or strided access pattern is detected
+  // (see class <linkto class=BucketCache>BucketCache</linkto>).
+  // A value of 0 (the default) switches prefetching off.
+  void setPrefetch (uInt nrBuckets);
+
+  // Get the maximum number of buckets to be read ahead.
+  uInt getPrefetch() const;
+
+  // Make it possible (or not) to read the scalar columns in this storage
+  // manager from multiple threads simultaneously, for example by calling
+  // <src>ScalarColumn::getColumnRange</src> on different row ranges using
+  // a separate ScalarColumn object per thread.
+  // <br>A value >0 gives the number of shards in the
+  // <linkto class=ConcurrentBucketCache>ConcurrentBucketCache</linkto>
+  // shared by the threads; its size is the cache size of this object.
+  // 0 switches concurrent reading off (which is the default).
+  // <br>It can only be used if the table is not writable. Note that only
+  // bulk reads of non-String columns are thread-safe, thus not
+  // <src>ScalarColumn::get</src> of a single row.
+  // The table should be opened with a lock mode that does not need to
+  // acquire a lock while reading (e.g. PermanentLocking or NoLocking).
+  // <br>This function itself is not thread-safe; it must be called before
+  // the threads start reading.
+  void setConcurrentRead (uInt nrShards);
+
+  // Is concurrent reading enabled?
+  Bool isConcurrentRead() const;
   
   // Clear the cache used by this storage manager.
   // It will flush the cache as needed and remove all buckets from it.
@@ -262,6 +293,17 @@ public:
   // Return a pointer to the object.
   StManArrayFile* openArrayFile (ByteIO::OpenOption anOpt);
 
+  // Find the bucket containing the column and row in the concurrent cache
+  // and pin it. It sets <src>aData</src> to the beginning of the column
+  // data in that bucket and fills in the start and end row for it.
+  // It can only be used if concurrent reading is enabled.
+  ConcurrentBucketCache::PinnedBucket findPinned (rownr_t aRowNr,
+                                                  uInt aColNr,
+                                                  const char*& aData,
+                                                  rownr_t& aStartRow,
+                                                  rownr_t& anEndRow,
+                                                  const String& colName);
+
   // Find the bucket containing the column and row and return the pointer
   // to the beginning of the column data in that bucket.
   // It also fills in the start and end row for the column data.
@@ -379,6 +421,9 @@ private:
   
   // Construct the cache object (if not constructed yet).
   void makeCache();
+
+  // (Re)construct the concurrent cache object if concurrent reading is used.
+  void makeConcurrentCache();
   
   // Read the header.
   void readHeader();
@@ -423,6 +468,15 @@ private:
   
   // The actual cache size.
   uInt itsCacheSize;
+
+  // The maximum number of buckets to read ahead.
+  uInt itsPrefetch;
+
+  // The number of shards of the concurrent cache (0 = not used).
+  uInt itsConcurrentShards;
+
+  // The cache for concurrent reading.
+  std::unique_ptr<ConcurrentBucketCache> itsConcurrentCache;
   
   // The initial number of buckets in the cache.
   uInt itsNrBuckets;
@@ -471,6 +525,16 @@ inline uInt SSMBase::getCacheSize() const
   return itsCacheSize;
 }
 
+inline uInt SSMBase::getPrefetch() const
+{
+  return itsPrefetch;
+}
+
+inline Bool SSMBase::isConcurrentRead() const
+{
+  return itsConcurrentShards > 0;
+}
+
 inline rownr_t SSMBase::getNRow() const
 {
   return itsNrRows;
@@ -513,9 +513,8 @@ void SSMColumn::getColumnValue(void* anArray,rownr_t aNrRows)
   while (rowsToDo > 0) {
     rownr_t aStartRow;
     rownr_t anEndRow;
-    char*   aValue;
-    aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
-                              columnName());
+    ConcurrentBucketCache::PinnedBucket aPin;
+    const char* aValue = findData (aRowNr, aStartRow, anEndRow, aPin);
     aRowNr = anEndRow+1;
     rownr_t aNr = anEndRow-aStartRow+1;
     rowsToDo -= aNr;
@@ -524,6 +523,73 @@ void SSMColumn::getColumnValue(void* anArray,rownr_t aNrRows)
   }
 }
 
+void SSMColumn::getScalarColumnCellsV (const RefRows& aRowNrs,
+                                       ArrayBase& aDataPtr)
+{
+  // Strings can be stored indirectly, so use the row by row access.
+  if (dtype() == TpString) {
+    getScalarColumnCellsBase (aRowNrs, aDataPtr);
+    return;
+  }
+  Bool deleteIt;
+  void* anArray = aDataPtr.getVStorage(deleteIt);
+  char* aTo = static_cast<char*>(anArray);
+  RefRowsSliceIter anIter(aRowNrs);
+  while (! anIter.pastEnd()) {
+    rownr_t aRowNr = anIter.sliceStart();
+    rownr_t anEnd  = anIter.sliceEnd();
+    rownr_t anIncr = anIter.sliceIncr();
+    while (aRowNr <= anEnd) {
+      rownr_t aStartRow;
+      rownr_t anEndRow;
+      ConcurrentBucketCache::PinnedBucket aPin;
+      const char* aValue = findData (aRowNr, aStartRow, anEndRow, aPin);
+      rownr_t aLast = std::min (anEnd, anEndRow);
+      if (anIncr == 1) {
+        // Contiguous rows can be converted at once.
+        rownr_t aNr = aLast - aRowNr + 1;
+        readValues (aTo, aValue, aRowNr-aStartRow, aNr);
+        aTo += aNr * itsLocalSize;
+        aRowNr += aNr;
+      } else {
+        for (; aRowNr <= aLast; aRowNr += anIncr) {
+          readValues (aTo, aValue, aRowNr-aStartRow, 1);
+          aTo += itsLocalSize;
+        }
+      }
+    }
+    anIter++;
+  }
+  aDataPtr.putVStorage(anArray, deleteIt);
+}
+
+const char* SSMColumn::findData (rownr_t aRowNr, rownr_t& aStartRow,
+                                 rownr_t& anEndRow,
+                                 ConcurrentBucketCache::PinnedBucket& aPin)
+{
+  if (itsSSMPtr->isConcurrentRead()) {
+    const char* aData;
+    aPin = itsSSMPtr->findPinned (aRowNr, itsColNr, aData, aStartRow,
+                                  anEndRow, columnName());
+    return aData;
+  }
+  return itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                          columnName());
+}
+
+void SSMColumn::readValues (void* aTo, const char* aData, rownr_t anOffset,
+                            rownr_t aNrRows)
+{
+  if (dtype() == TpBool) {
+    // Bools are stored as bits, so the offset is not a whole byte.
+    Conversion::bitToBool (aTo, aData, anOffset*itsNrElem,
+                           aNrRows*itsNrElem);
+  } else {
+    itsReadFunc (aTo, aData + anOffset*itsExternalSizeBytes,
+                 aNrRows * itsNrCopy);
+  }
+}
+
 void SSMColumn::putScalarColumnV (const ArrayBase& aDataPtr)
 {
   if (dtype() == TpString) {
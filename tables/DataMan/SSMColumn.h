@@ -172,6 +172,14 @@ public:
   
   // Get the scalar values of the entire column.
   virtual void getScalarColumnV (ArrayBase& aDataPtr);
+
+  // Get the scalar values of some cells of the column.
+  // The data are copied directly from the buckets, so the cache of the
+  // last value read is not used nor changed. In this way it can be used
+  // by multiple threads if the storage manager allows concurrent reading
+  // (except for String columns).
+  virtual void getScalarColumnCellsV (const RefRows& aRowNrs,
+                                      ArrayBase& aDataPtr);
   
   // Put the scalar values of the entire column.
   // It invalidates the cache.
@@ -226,6 +234,18 @@ protected:
   // Get the values for the entire column.
   // The data from all buckets is copied to the array.
   void getColumnValue (void* anArray, rownr_t aNrRows);
+
+  // Find the column data in the bucket containing the given row.
+  // If concurrent reading is enabled, the bucket is pinned in
+  // <src>aPin</src>.
+  const char* findData (rownr_t aRowNr, rownr_t& aStartRow,
+                        rownr_t& anEndRow,
+                        ConcurrentBucketCache::PinnedBucket& aPin);
+
+  // Convert <src>aNrRows</src> values from the column data in a bucket
+  // starting at the given row offset in that bucket.
+  void readValues (void* aTo, const char* aData, rownr_t anOffset,
+                   rownr_t aNrRows);
   
   // Put the values from the array in the entire column.
   // Each data bucket is filled with the the appropriate part of the array.
@@ -76,6 +76,21 @@ uInt ROStandardStManAccessor::getCacheSize() const
     return itsSSMPtr->getCacheSize();
 }
 
+void ROStandardStManAccessor::setPrefetch (uInt nrBuckets)
+{
+    itsSSMPtr->setPrefetch (nrBuckets);
+}
+
+uInt ROStandardStManAccessor::getPrefetch() const
+{
+    return itsSSMPtr->getPrefetch();
+}
+
+void ROStandardStManAccessor::setConcurrentRead (uInt nrShards)
+{
+    itsSSMPtr->setConcurrentRead (nrShards);
+}
+
 void ROStandardStManAccessor::clearCache()
 {
     itsSSMPtr->clearCache();
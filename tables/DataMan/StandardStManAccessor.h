@@ -133,6 +133,23 @@ public:
     // Get the cache size (in buckets).
     uInt getCacheSize() const;
 
+    // Set the maximum number of buckets the storage manager reads ahead
+    // in a background thread when it detects a sequential or strided
+    // access pattern. 0 switches prefetching off (which is the default).
+    // Like the cache size given in this way, it is not persistent.
+    void setPrefetch (uInt nrBuckets);
+
+    // Get the maximum number of buckets read ahead.
+    uInt getPrefetch() const;
+
+    // Make it possible to read the scalar columns of the storage manager
+    // from multiple threads simultaneously using the given number of shards
+    // in the cache shared by the threads. 0 switches it off.
+    // It can only be used for a table opened read-only.
+    // See <linkto class=SSMBase>SSMBase::setConcurrentRead</linkto>
+    // for more information.
+    void setConcurrentRead (uInt nrShards);
+
     // Clear the cache used by this storage manager.
     // It will flush the cache as needed and remove all buckets from it
     // resulting in a drop in memory used.
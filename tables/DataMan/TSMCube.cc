@@ -41,14 +41,19 @@
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/string.h>                           // for memcpy
 #include <casacore/casa/iostream.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// The maximum number of bytes read by a single read in readSectionDirect.
+static const uInt theMaxReadSize = 4*1024*1024;
+
 // memcpy with constant argument is inlined
 #define TSM_COPY(a, b, n) case n: memcpy(a, b, n); break
+
 static void TSMCube_MoveData(char * a, char * b, int n)
 {
     switch (n) {
@@ -400,6 +405,11 @@ void TSMCube::deleteCache()
     cache_p = 0;
 }
 
+const char* TSMCube::mappedTile (uInt)
+{
+    return 0;
+}
+
 
 Bool TSMCube::isExtensible() const
 {
@@ -911,7 +921,7 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
 	stmanPtr_p->setDataChanged();
     }
     // Prepare for the iteration through the necessary tiles.
-    uInt i, j;
+    uInt i;
 
     // Initialize the various variables and determine the number of
     // tiles needed (which will determine the cache size).
@@ -987,6 +997,13 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
         return;
     }
 
+    // A large section is read directly (in parallel) if possible.
+    if (!writeFlag  &&
+        readSectionDirect (start, end, section,
+                           pixelOffset, localPixelSize, cachePtr)) {
+        return;
+    }
+
     // At this point we start looping through all tiles.
     // startPixel and endPixel will contain the first and last pixels
     // needed in the current tile.
@@ -999,11 +1016,6 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     IPosition tilePos    (startTile_p);
     IPosition tileIncr = 
       expandedTilesPerDim_p.offsetIncrement (nrTileSection_p);
-    IPosition dataLength(nrdim_p);
-    IPosition dataPos   (nrdim_p);
-    IPosition sectionPos(nrdim_p);
-    uInt dataOffset;
-    size_t sectionOffset;
     uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
 
     while (True) {
@@ -1017,60 +1029,9 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
         if (writeFlag) {
             cachePtr->setDirty();
         }
-
-        // At this point we start looping through all pixels in the tile.
-        // We do a vector at a time.
-        // Calculate the start and end pixel in the tile.
-        // Initialize the pixel position in the data and section.
-        for (i=0; i<nrdim_p; i++) {
-            dataLength(i) = 1 + endPixel(i) - startPixel(i);
-            dataPos(i)    = startPixel(i);
-            sectionPos(i) = tilePos(i) * tileShape_p(i)
-                            + startPixel(i) - startSection(i);
-        }
-        dataOffset = pixelOffset + localPixelSize *
-                            expandedTileShape_p.offset (startPixel);
-        sectionOffset = localPixelSize *
-                            expandedSectionShape.offset (sectionPos);
-        IPosition dataIncr    = localPixelSize *
-                            expandedTileShape_p.offsetIncrement (dataLength);
-        IPosition sectionIncr = localPixelSize *
-                            expandedSectionShape.offsetIncrement (dataLength);
-
-        while (True) {
-            uInt localSize = dataLength(0) * localPixelSize;
-            /* merge zero increments into one copy */
-            for (j = 1; j < nrdim_p; j++) {
-                if (dataIncr(j) == 0 && sectionIncr(j) == 0) {
-                    localSize *= dataLength(j);
-                    dataPos(j) = endPixel(j);
-                }
-                else {
-                    break;
-                }
-            }
-
-            if (writeFlag) {
-                TSMCube_MoveData(dataArray + dataOffset,
-                                 section + sectionOffset, localSize);
-            } else {
-                TSMCube_MoveData(section + sectionOffset,
-                                 dataArray + dataOffset, localSize);
-            }
-            dataOffset += localSize;
-            sectionOffset += localSize;
-            for (j = 1; j < nrdim_p; j++) {
-                dataOffset += dataIncr(j);
-                sectionOffset += sectionIncr(j);
-                if (++dataPos(j) <= endPixel(j)) {
-                    break;
-                }
-                dataPos(j) = startPixel(j);
-            }
-            if (j == nrdim_p) {
-                break;
-            }
-        }
+        copyTilePart (dataArray, section, tilePos, startPixel, endPixel,
+                      startSection, expandedSectionShape,
+                      pixelOffset, localPixelSize, writeFlag);
 
         // Determine the next tile to access and the starting and
         // ending pixels in it.
@@ -1097,6 +1058,280 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     }
 }
 
+void TSMCube::copyTilePart (char* dataArray, char* section,
+                            const IPosition& tilePos,
+                            const IPosition& startPixel,
+                            const IPosition& endPixel,
+                            const IPosition& startSection,
+                            const TSMShape& expandedSectionShape,
+                            uInt pixelOffset, uInt localPixelSize,
+                            Bool writeFlag) const
+{
+    // At this point we start looping through all pixels in the tile.
+    // We do a vector at a time.
+    // Calculate the start and end pixel in the tile.
+    // Initialize the pixel position in the data and section.
+    uInt i, j;
+    IPosition dataLength(nrdim_p);
+    IPosition dataPos   (nrdim_p);
+    IPosition sectionPos(nrdim_p);
+    for (i=0; i<nrdim_p; i++) {
+        dataLength(i) = 1 + endPixel(i) - startPixel(i);
+        dataPos(i)    = startPixel(i);
+        sectionPos(i) = tilePos(i) * tileShape_p(i)
+                        + startPixel(i) - startSection(i);
+    }
+    uInt dataOffset = pixelOffset + localPixelSize *
+                        expandedTileShape_p.offset (startPixel);
+    size_t sectionOffset = localPixelSize *
+                        expandedSectionShape.offset (sectionPos);
+    IPosition dataIncr    = localPixelSize *
+                        expandedTileShape_p.offsetIncrement (dataLength);
+    IPosition sectionIncr = localPixelSize *
+                        expandedSectionShape.offsetIncrement (dataLength);
+
+    while (True) {
+        uInt localSize = dataLength(0) * localPixelSize;
+        /* merge zero increments into one copy */
+        for (j = 1; j < nrdim_p; j++) {
+            if (dataIncr(j) == 0 && sectionIncr(j) == 0) {
+                localSize *= dataLength(j);
+                dataPos(j) = endPixel(j);
+            }
+            else {
+                break;
+            }
+        }
+
+        if (writeFlag) {
+            TSMCube_MoveData(dataArray + dataOffset,
+                             section + sectionOffset, localSize);
+        } else {
+            TSMCube_MoveData(section + sectionOffset,
+                             dataArray + dataOffset, localSize);
+        }
+        dataOffset += localSize;
+        sectionOffset += localSize;
+        for (j = 1; j < nrdim_p; j++) {
+            dataOffset += dataIncr(j);
+            sectionOffset += sectionIncr(j);
+            if (++dataPos(j) <= endPixel(j)) {
+                break;
+            }
+            dataPos(j) = startPixel(j);
+        }
+        if (j == nrdim_p) {
+            break;
+        }
+    }
+}
+
+Bool TSMCube::readSectionDirect (const IPosition& start,
+                                 const IPosition& end,
+                                 char* section,
+                                 uInt pixelOffset, uInt localPixelSize,
+                                 BucketCache* cachePtr)
+{
+    // It is only worthwhile if multiple tiles have to be read.
+    if (nrTileSection_p.product() < 2) {
+        return False;
+    }
+    // The file must be readable from multiple threads.
+    std::shared_ptr<ByteIO> file = filePtr_p->bucketFile()->preadFile();
+    if (!file) {
+        return False;
+    }
+    // Make a list of the tiles in the order used by accessSection.
+    std::vector<uInt> tileNrs;
+    std::vector<IPosition> tilePositions;
+    IPosition tilePos (startTile_p);
+    IPosition tileIncr =
+      expandedTilesPerDim_p.offsetIncrement (nrTileSection_p);
+    uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
+    uInt i;
+    while (True) {
+        tileNrs.push_back (tileNr);
+        tilePositions.push_back (tilePos);
+        for (i=0; i<nrdim_p; i++) {
+            tileNr += tileIncr(i);
+            if (++tilePos(i) <= endTile_p(i)) {
+                break;
+            }
+            tilePos(i) = startTile_p(i);
+        }
+        if (i == nrdim_p) {
+            break;
+        }
+    }
+    // The tiles are handled in batches, so no more tiles are held in
+    // memory than the cache can contain (but at least one per thread).
+    uInt nthread = OMP::maxThreads();
+    const size_t maxBatch = std::max (cachePtr->cacheSize(), nthread);
+    // The tiles to read are the ones in the file, but not in the cache.
+    // Determine for the tiles in [first,last) their index in the tiles
+    // to read (-1 = no). The batch ends when maxBatch tiles are to be read.
+    const uInt nrTileInFile = cachePtr->nBucketInFile();
+    std::vector<Int64> readIndex (tileNrs.size(), -1);
+    auto findTiles = [&] (size_t first, size_t& last) -> Int64
+    {
+        Int64 nread = 0;
+        for (last=first; last<tileNrs.size(); ++last) {
+            if (tileNrs[last] < nrTileInFile  &&
+                !cachePtr->isCached (tileNrs[last])) {
+                if (size_t(nread) == maxBatch) {
+                    break;
+                }
+                readIndex[last] = nread++;
+            } else {
+                readIndex[last] = -1;
+            }
+        }
+        return nread;
+    };
+    // Group the tiles to read into runs of tiles adjacent in the file,
+    // so each run can be read with a single read.
+    // Limit the run length, so all threads get work.
+    std::vector<size_t> toRead;           // index in tileNrs
+    std::vector<size_t> runStart;         // index in toRead
+    auto makeRuns = [&] (size_t first, size_t last, Int64 nread) -> Int64
+    {
+        Int64 maxRun = std::max (Int64(1),
+                                 std::min (Int64(theMaxReadSize / bucketSize_p),
+                                           (nread + nthread - 1) / nthread));
+        toRead.clear();
+        runStart.clear();
+        for (size_t k=first; k<last; ++k) {
+            if (readIndex[k] >= 0) {
+                if (toRead.empty()  ||
+                    tileNrs[k] != tileNrs[toRead.back()] + 1  ||
+                    Int64(toRead.size() - runStart.back()) >= maxRun) {
+                    runStart.push_back (toRead.size());
+                }
+                toRead.push_back (k);
+            }
+        }
+        Int64 nrun = runStart.size();
+        runStart.push_back (toRead.size());
+        return nrun;
+    };
+    // Doing it in this way only pays off if multiple threads can be
+    // used or if tiles can be read together. Serially the reads can only
+    // be coalesced within a batch (thus within the cache size), so
+    // accessSection is used if the cache cannot hold multiple tiles.
+    size_t last;
+    Int64 nread = findTiles (0, last);
+    if (nread < 2) {
+        return False;
+    }
+    Int64 nrun = makeRuns (0, last, nread);
+    if (nthread <= 1  &&  (cachePtr->cacheSize() < 2  ||  nrun == nread)) {
+        return False;
+    }
+    IPosition startSection (start);
+    TSMShape expandedSectionShape (end - start + 1);
+    // Get the first and last pixel needed in a tile.
+    auto tilePart = [this] (const IPosition& pos,
+                            IPosition& startPixel, IPosition& endPixel)
+    {
+        for (uInt j=0; j<nrdim_p; j++) {
+            startPixel(j) = (pos(j) == startTile_p(j)  ?
+                             startPixelInFirstTile_p(j) : 0);
+            endPixel(j)   = (pos(j) == endTile_p(j)  ?
+                             endPixelInLastTile_p(j) : tileShape_p(j) - 1);
+        }
+    };
+    std::vector<char*> tiles;
+    size_t first = 0;
+    try {
+        while (True) {
+            // Read the runs of tiles, convert the tiles and copy their parts
+            // into the section (in parallel if possible).
+            // The converted tiles are kept to be added to the cache.
+            tiles.assign (nread, static_cast<char*>(0));
+            uInt nthr = std::max (Int64(1), std::min (Int64(nthread), nrun));
+            String errorMsg;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthr) if (nthr > 1)
+#endif
+            {
+                std::vector<char> external;
+                IPosition startPixel(nrdim_p);
+                IPosition endPixel(nrdim_p);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+                for (Int64 r=0; r<nrun; ++r) {
+                    try {
+                        size_t firstRead = runStart[r];
+                        size_t ntile = runStart[r+1] - firstRead;
+                        external.resize (ntile * bucketSize_p);
+                        file->pread (ntile * bucketSize_p,
+                                     fileOffset_p +
+                                     Int64(tileNrs[toRead[firstRead]]) *
+                                       bucketSize_p,
+                                     external.data());
+                        for (size_t k=0; k<ntile; ++k) {
+                            size_t inx = toRead[firstRead+k];
+                            char* local = new char[localTileLength_p];
+                            tiles[firstRead+k] = local;
+                            stmanPtr_p->readTile (local, localOffset_p,
+                                                  external.data() +
+                                                    k*bucketSize_p,
+                                                  externalOffset_p,
+                                                  tileSize_p);
+                            tilePart (tilePositions[inx],
+                                      startPixel, endPixel);
+                            copyTilePart (local, section, tilePositions[inx],
+                                          startPixel, endPixel,
+                                          startSection, expandedSectionShape,
+                                          pixelOffset, localPixelSize, False);
+                        }
+                    } catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(TSMCube_readSectionDirect)
+#endif
+                        errorMsg = x.what();
+                    }
+                }
+            }
+            if (! errorMsg.empty()) {
+                throw DataManError ("TSMCube::accessSection: " + errorMsg);
+            }
+            // Now go through the tiles of the batch in the same order as
+            // accessSection does to keep the cache administration the same.
+            // The tiles read are handed over to the cache; the others are
+            // copied from it.
+            IPosition startPixel(nrdim_p);
+            IPosition endPixel(nrdim_p);
+            for (size_t k=first; k<last; ++k) {
+                if (readIndex[k] >= 0) {
+                    char* local = tiles[readIndex[k]];
+                    tiles[readIndex[k]] = 0;
+                    cachePtr->adoptBucket (tileNrs[k], local);
+                } else {
+                    tilePart (tilePositions[k], startPixel, endPixel);
+                    copyTilePart (cachePtr->getBucket (tileNrs[k]), section,
+                                  tilePositions[k], startPixel, endPixel,
+                                  startSection, expandedSectionShape,
+                                  pixelOffset, localPixelSize, False);
+                }
+            }
+            if (last == tileNrs.size()) {
+                break;
+            }
+            first = last;
+            nread = findTiles (first, last);
+            nrun  = makeRuns (first, last, nread);
+        }
+    } catch (...) {
+        for (char* tile : tiles) {
+            delete [] tile;
+        }
+        throw;
+    }
+    return True;
+}
+
 void TSMCube::accessLine (char* section, uInt pixelOffset,
                           uInt localPixelSize,
                           Bool writeFlag, BucketCache* cachePtr,
@@ -1295,6 +1530,30 @@ void TSMCube::accessLine (char* section, uInt pixelOffset,
 }
 
 
+const char* TSMCube::mappedSection (const IPosition& start,
+                                    const IPosition& end,
+                                    uInt colnr, IPosition& startInTile)
+{
+    if (nrTiles_p == 0) {
+        return 0;
+    }
+    // The section has to be contained in a single tile.
+    IPosition startTile(nrdim_p);
+    startInTile.resize (nrdim_p);
+    for (uInt i=0; i<nrdim_p; i++) {
+        startTile(i) = start(i) / tileShape_p(i);
+        if (end(i) / tileShape_p(i) != startTile(i)) {
+            return 0;
+        }
+        startInTile(i) = start(i) - startTile(i) * tileShape_p(i);
+    }
+    const char* tile = mappedTile (expandedTilesPerDim_p.offset (startTile));
+    if (tile == 0) {
+        return 0;
+    }
+    return tile + externalOffset_p[colnr];
+}
+
 void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
                              const IPosition& stride,
                              char* section, uInt colnr,
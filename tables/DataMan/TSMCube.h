@@ -155,7 +155,7 @@ public:
     virtual void showCacheStatistics (ostream& os) const;
 
     // Put the data of the object into the AipsIO stream.
-    void putObject (AipsIO& ios);
+    virtual void putObject (AipsIO& ios);
 
     // Get the data of the object from the AipsIO stream.
     // It returns the data manager sequence number, which is -1 if
@@ -232,6 +232,15 @@ public:
                                 uInt localPixelSize, uInt externalPixelSize,
                                 Bool writeFlag);
 
+    // Get a pointer to the data of the given column in the tile containing
+    // the section given by start and end (inclusive). The position of
+    // <src>start</src> in that tile is returned in <src>startInTile</src>.
+    // The data are in external format.
+    // A null pointer is returned if the section is not contained in a
+    // single tile or if the tiles are not memory-mapped.
+    const char* mappedSection (const IPosition& start, const IPosition& end,
+                               uInt colnr, IPosition& startInTile);
+
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
@@ -308,7 +317,19 @@ protected:
     // if nrdim_p changes value.
     void resizeTileSections();
 
-private:
+    // Copy the part of a tile given by startPixel and endPixel
+    // to or from the section.
+    // It only uses its arguments and constant members, so it can be
+    // executed by multiple threads simultaneously.
+    void copyTilePart (char* dataArray, char* section,
+                       const IPosition& tilePos,
+                       const IPosition& startPixel,
+                       const IPosition& endPixel,
+                       const IPosition& startSection,
+                       const TSMShape& expandedSectionShape,
+                       uInt pixelOffset, uInt localPixelSize,
+                       Bool writeFlag) const;
+
     // Get the cache object.
     // This will construct the cache object if not present yet.
     BucketCache* getCache();
@@ -322,6 +343,12 @@ private:
     // Delete the cache object.
     virtual void deleteCache();
 
+private:
+    // Get a pointer to a tile in memory if the hypercube is memory-mapped.
+    // By default a null pointer is returned, because the tiles are
+    // held in a cache.
+    virtual const char* mappedTile (uInt tileNr);
+
     // Access a line in a more optimized way.
     void accessLine (char* section, uInt pixelOffset,
 		     uInt localPixelSize,
@@ -331,6 +358,23 @@ private:
 		     uInt endPixelInLastTile,
 		     uInt lineIndex);
 
+    // Read a section spanning multiple tiles directly from the file.
+    // The tiles in the file, but not in the cache are read, converted and
+    // copied into the section. Tiles adjacent in the file are read with
+    // a single read and, if OpenMP is used, multiple threads do it in
+    // parallel. Thereafter the tiles are added to the cache in the same
+    // order as done by the serial loop in accessSection, so the cache
+    // contents and statistics do not change.
+    // The tiles are handled in batches of at most the cache size (but at
+    // least one tile per thread), which limits the memory used.
+    // It returns False (and does nothing) if it does not pay off, thus if
+    // only one thread can be used and no tiles can be read together
+    // (e.g. because the cache cannot hold more than one tile).
+    Bool readSectionDirect (const IPosition& start, const IPosition& end,
+                            char* section,
+                            uInt pixelOffset, uInt localPixelSize,
+                            BucketCache* cachePtr);
+
     // Define the callback functions for the BucketCache.
     // <group>
     static char* readCallBack (void* owner, const char* external);
@@ -0,0 +1,618 @@
+//# TSMCubeCompress.cc: Tiled hypercube in a table holding compressed tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/DataMan/TSMCubeCompress.h>
+#include <casacore/tables/DataMan/TiledStMan.h>
+#include <casacore/tables/DataMan/TSMFile.h>
+#include <casacore/tables/DataMan/TSMColumn.h>
+#include <casacore/tables/DataMan/TSMDataColumn.h>
+#include <casacore/tables/DataMan/TSMShape.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/FilebufIO.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# The minimum length of a run of equal bytes to be run-length encoded.
+//# Shorter runs are stored as part of a literal.
+static const uInt minRunLength = 4;
+
+//# Write a length as a variable length integer (7 bits per byte).
+inline static void putLength (std::vector<uChar>& out, uInt64 value)
+{
+  while (value >= 128) {
+    out.push_back (uChar(value | 128));
+    value >>= 7;
+  }
+  out.push_back (uChar(value));
+}
+
+//# Read a variable length integer.
+inline static uInt64 getLength (const uChar*& in, const uChar* inEnd)
+{
+  uInt64 value = 0;
+  for (uInt shift=0; shift<64; shift+=7) {
+    if (in >= inEnd) {
+      break;
+    }
+    uChar byte = *in++;
+    value |= uInt64(byte & 127) << shift;
+    if (byte < 128) {
+      return value;
+    }
+  }
+  throw DataManError ("TSMCubeCompress: compressed tile is corrupt");
+}
+
+
+TSMCubeCompress::TSMCubeCompress (TiledStMan* stman, TSMFile* file,
+                                  const IPosition& cubeShape,
+                                  const IPosition& tileShape,
+                                  const Record& values)
+  : TSMCube (stman, file, IPosition(), IPosition(), values, -1, True)
+{
+  // The TSMCube constructor is given an empty shape, because the
+  // setShape of TSMCube would reserve the space for uncompressed tiles.
+  if (! cubeShape.empty()) {
+    extensible_p = cubeShape(cubeShape.nelements()-1) == 0;
+    setShape (cubeShape, tileShape);
+  }
+}
+
+TSMCubeCompress::TSMCubeCompress (TiledStMan* stman, AipsIO& ios)
+  : TSMCube (stman, ios, True)
+{
+  getIndex (ios);
+}
+
+TSMCubeCompress::~TSMCubeCompress()
+{}
+
+void TSMCubeCompress::putObject (AipsIO& ios)
+{
+  TSMCube::putObject (ios);
+  // A cube without a file (for rows without an array) has no tiles,
+  // so it is written in the same way as a TSMCube.
+  if (filePtr_p != 0) {
+    ios.putstart ("TSMCubeCompress", 1);
+    ios.put (tileOffset_p);
+    ios.put (tileLength_p);
+    ios.put (tileSpace_p);
+    ios.putend();
+  }
+}
+
+void TSMCubeCompress::getIndex (AipsIO& ios)
+{
+  if (filePtr_p != 0) {
+    ios.getstart ("TSMCubeCompress");
+    ios.get (tileOffset_p);
+    ios.get (tileLength_p);
+    ios.get (tileSpace_p);
+    ios.getend();
+  }
+  resizeIndex();
+}
+
+void TSMCubeCompress::resync (AipsIO& ios)
+{
+  TSMCube::resync (ios);
+  getIndex (ios);
+}
+
+void TSMCubeCompress::resizeIndex()
+{
+  tileOffset_p.resize (nrTiles_p, -1);
+  tileLength_p.resize (nrTiles_p, 0);
+  tileSpace_p.resize  (nrTiles_p, 0);
+}
+
+void TSMCubeCompress::setShape (const IPosition& cubeShape,
+                                const IPosition& tileShape)
+{
+  // Check if the shape matches the shape of already known columns.
+  stmanPtr_p->checkCubeShape (this, cubeShape);
+  deleteCache();
+  nrdim_p     = cubeShape.nelements();
+  resizeTileSections();
+  cubeShape_p = cubeShape;
+  tileShape_p = adjustTileShape (cubeShape, tileShape);
+  setup();
+  // No space is reserved in the file; tiles are added when written.
+  fileOffset_p = 0;
+  tileOffset_p.clear();
+  tileLength_p.clear();
+  tileSpace_p.clear();
+  resizeIndex();
+  stmanPtr_p->initCoordinates (this);
+  stmanPtr_p->setDataChanged();
+}
+
+void TSMCubeCompress::extend (uInt64 nr, const Record& coordValues,
+                              const TSMColumn* lastCoordColumn)
+{
+  if (!extensible_p) {
+    throw TSMError ("Hypercube in TSM " + stmanPtr_p->dataManagerName() +
+                    " is not extensible");
+  }
+  // Make the cache here, otherwise nrTiles_p is too high.
+  makeCache();
+  uInt lastDim = nrdim_p - 1;
+  uInt nrold = nrTiles_p;
+  cubeShape_p(lastDim) += nr;
+  tilesPerDim_p(lastDim) = (cubeShape_p(lastDim) + tileShape_p(lastDim) - 1)
+                           / tileShape_p(lastDim);
+  nrTiles_p = nrTilesSubCube_p * tilesPerDim_p(lastDim);
+  getCache()->extend (nrTiles_p - nrold);
+  resizeIndex();
+  // Update the last coordinate (if there).
+  if (lastCoordColumn != 0) {
+    extendCoordinates (coordValues, lastCoordColumn->columnName(),
+                       cubeShape_p(lastDim));
+  }
+}
+
+
+void TSMCubeCompress::makeCache()
+{
+  // Use the TSMCube cache, but let it call this object to read and
+  // write the compressed tiles.
+  if (cache_p == 0) {
+    TSMCube::makeCache();
+    cache_p->setBucketIO (readTileCallBack, writeTileCallBack);
+  }
+}
+
+char* TSMCubeCompress::readTileCallBack (void* owner, uInt tileNr)
+{
+  return static_cast<TSMCubeCompress*>(owner)->readCompressedTile (tileNr);
+}
+
+void TSMCubeCompress::writeTileCallBack (void* owner, uInt tileNr,
+                                         const char* local)
+{
+  static_cast<TSMCubeCompress*>(owner)->writeCompressedTile (tileNr, local);
+}
+
+void TSMCubeCompress::flushCache()
+{
+  TSMCube::flushCache();
+  if (filePtr_p != 0) {
+    FilebufIO* bufFile = filePtr_p->bucketFile()->bufferedFile();
+    if (bufFile) {
+      bufFile->flush();
+    }
+  }
+}
+
+void TSMCubeCompress::showCacheStatistics (ostream& os) const
+{
+  os << ">>> TSMCubeCompress cache statistics:" << endl;
+  os << "cubeShape: " << cubeShape_p << endl;
+  os << "tileShape: " << tileShape_p << endl;
+  os << "maxCacheSz:" << stmanPtr_p->maximumCacheSize() << " MiB" << endl;
+  if (cache_p != 0) {
+    cache_p->showStatistics (os);
+  }
+  uInt nwritten = nrTilesWritten();
+  os << "#tiles:    " << nwritten << " of " << nrTiles_p
+     << " stored" << endl;
+  if (nwritten > 0) {
+    os << "ratio:     "
+       << double(nwritten) * bucketSize_p / compressedLength()
+       << " (compression ratio of stored tiles)" << endl;
+  }
+  os << "<<<" << endl;
+}
+
+Int64 TSMCubeCompress::compressedLength() const
+{
+  Int64 length = 0;
+  for (uInt i=0; i<tileLength_p.size(); ++i) {
+    length += tileLength_p[i];
+  }
+  return length;
+}
+
+uInt TSMCubeCompress::nrTilesWritten() const
+{
+  uInt nr = 0;
+  for (uInt i=0; i<tileOffset_p.size(); ++i) {
+    if (tileOffset_p[i] >= 0) {
+      nr++;
+    }
+  }
+  return nr;
+}
+
+
+uInt TSMCubeCompress::valueSize (uInt colnr) const
+{
+  // The values are compressed per basic element, thus a complex value
+  // as two floats. Bools are stored as bits, thus compressed per byte.
+  const TSMDataColumn* dataColumn = stmanPtr_p->getDataColumn (colnr);
+  uInt64 nrval  = uInt64(tileSize_p) * dataColumn->getNrConvert();
+  uInt64 length = dataColumn->dataLength (tileSize_p);
+  if (nrval > 0  &&  length >= nrval  &&  length % nrval == 0) {
+    return length / nrval;
+  }
+  return 1;
+}
+
+char* TSMCubeCompress::readCompressedTile (uInt tileNr)
+{
+  // Reuse the buffer kept by the deleteCallBack of TSMCube.
+  char* local = cachedTile_p;
+  if (local != 0) {
+    cachedTile_p = 0;
+  } else {
+    local = new char[localTileLength_p];
+  }
+  // A tile never written contains zeroes.
+  if (tileOffset_p[tileNr] < 0) {
+    memset (local, 0, localTileLength_p);
+    return local;
+  }
+  try {
+    uInt length = tileLength_p[tileNr];
+    compressed_p.resize (length);
+    readFile (compressed_p.data(), length, tileOffset_p[tileNr]);
+    external_p.resize (bucketSize_p);
+    const uChar* in    = compressed_p.data();
+    const uChar* inEnd = in + length;
+    uInt nrcol = externalOffset_p.nelements();
+    for (uInt i=0; i<nrcol; ++i) {
+      uInt end = (i+1 < nrcol  ?  externalOffset_p[i+1] : bucketSize_p);
+      in = decompress (in, inEnd, external_p.data() + externalOffset_p[i],
+                       end - externalOffset_p[i], valueSize(i));
+    }
+  } catch (...) {
+    delete [] local;
+    throw;
+  }
+  stmanPtr_p->readTile (local, localOffset_p, external_p.data(),
+                        externalOffset_p, tileSize_p);
+  return local;
+}
+
+void TSMCubeCompress::writeCompressedTile (uInt tileNr, const char* local)
+{
+  external_p.resize (bucketSize_p);
+  stmanPtr_p->writeTile (external_p.data(), externalOffset_p,
+                         local, localOffset_p, tileSize_p);
+  // Values are usually most alike along the first or second axis
+  // (e.g. the weights of a correlation along frequency), so XOR them
+  // with the previous value on both axes and use the best one.
+  compressed_p.clear();
+  std::vector<uChar> other;
+  uInt nrcol = externalOffset_p.nelements();
+  for (uInt i=0; i<nrcol; ++i) {
+    uInt end = (i+1 < nrcol  ?  externalOffset_p[i+1] : bucketSize_p);
+    size_t start = compressed_p.size();
+    compress (external_p.data() + externalOffset_p[i],
+              end - externalOffset_p[i], valueSize(i), 1, compressed_p);
+    if (nrdim_p > 1  &&  tileShape_p(0) > 1  &&
+        compressed_p.size() - start > 16) {
+      other.clear();
+      compress (external_p.data() + externalOffset_p[i],
+                end - externalOffset_p[i], valueSize(i), tileShape_p(0),
+                other);
+      if (other.size() < compressed_p.size() - start) {
+        compressed_p.resize (start);
+        compressed_p.insert (compressed_p.end(), other.begin(), other.end());
+      }
+    }
+  }
+  // Rewrite the tile in place if it fits. Otherwise release its space
+  // and allocate new space (which can be space released before).
+  uInt length = compressed_p.size();
+  if (tileOffset_p[tileNr] < 0  ||  length > tileSpace_p[tileNr]) {
+    if (tileOffset_p[tileNr] >= 0) {
+      filePtr_p->release (tileOffset_p[tileNr], tileSpace_p[tileNr]);
+    }
+    tileOffset_p[tileNr] = filePtr_p->allocate (length);
+    tileSpace_p[tileNr]  = length;
+  }
+  writeFile (compressed_p.data(), length, tileOffset_p[tileNr]);
+  tileLength_p[tileNr] = length;
+}
+
+void TSMCubeCompress::readFile (void* buffer, uInt length, Int64 offset)
+{
+  BucketFile* file = filePtr_p->bucketFile();
+  file->open();
+  Int64 nread;
+  FilebufIO* bufFile = file->bufferedFile();
+  if (bufFile) {
+    bufFile->seek (offset);
+    nread = bufFile->read (length, buffer, False);
+  } else {
+    file->seek (offset);
+    nread = file->read (buffer, length);
+  }
+  if (nread != length) {
+    throw DataManError ("TSMCubeCompress: error reading a tile from " +
+                        file->name());
+  }
+}
+
+void TSMCubeCompress::writeFile (const void* buffer, uInt length,
+                                 Int64 offset)
+{
+  BucketFile* file = filePtr_p->bucketFile();
+  file->open();
+  FilebufIO* bufFile = file->bufferedFile();
+  if (bufFile) {
+    bufFile->seek (offset);
+    bufFile->write (length, buffer);
+  } else {
+    file->seek (offset);
+    file->write (buffer, length);
+  }
+}
+
+
+void TSMCubeCompress::compress (const char* data, uInt length,
+                                uInt valueSize, uInt distance,
+                                std::vector<uChar>& out)
+{
+  if (valueSize == 0  ||  length % valueSize != 0) {
+    valueSize = 1;
+  }
+  uInt nrval = length / valueSize;
+  if (distance == 0  ||  distance > nrval) {
+    distance = 1;
+  }
+  // XOR each byte with the same byte in the value the given distance
+  // before and shuffle the bytes, so equal or slowly varying values
+  // give runs of zeroes.
+  const uChar* in = reinterpret_cast<const uChar*>(data);
+  std::vector<uChar> shuffled(length);
+  for (uInt b=0; b<valueSize; ++b) {
+    uChar* plane = shuffled.data() + size_t(b) * nrval;
+    const uChar* inb = in + b;
+    for (uInt i=0; i<distance && i<nrval; ++i) {
+      plane[i] = inb[size_t(i) * valueSize];
+    }
+    for (uInt i=distance; i<nrval; ++i) {
+      plane[i] = inb[size_t(i) * valueSize] ^
+                 inb[size_t(i - distance) * valueSize];
+    }
+  }
+  // Run-length encode the result. Each run starts with its length,
+  // where the lowest bit tells if it is a run of equal bytes (1) or
+  // a literal (0). Stop if the result gets larger than the input.
+  size_t start = out.size();
+  out.push_back (1);
+  putLength (out, distance);
+  const uChar* p = shuffled.data();
+  uInt literalStart = 0;
+  uInt i = 0;
+  while (i < length  &&  out.size() - start <= length) {
+    uInt j = i + 1;
+    while (j < length  &&  p[j] == p[i]) {
+      j++;
+    }
+    if (j - i >= minRunLength) {
+      if (i > literalStart) {
+        putLength (out, uInt64(i - literalStart) << 1);
+        out.insert (out.end(), p + literalStart, p + i);
+      }
+      putLength (out, (uInt64(j - i) << 1) | 1);
+      out.push_back (p[i]);
+      literalStart = j;
+    }
+    i = j;
+  }
+  if (i == length  &&  length > literalStart) {
+    putLength (out, uInt64(length - literalStart) << 1);
+    out.insert (out.end(), p + literalStart, p + length);
+  }
+  // Store the data as is if compression does not pay off.
+  if (out.size() - start > length) {
+    out.resize (start);
+    out.push_back (0);
+    out.insert (out.end(), in, in + length);
+  }
+}
+
+const uChar* TSMCubeCompress::decompress (const uChar* in, const uChar* inEnd,
+                                          char* data, uInt length,
+                                          uInt valueSize)
+{
+  if (in >= inEnd  ||  *in > 1) {
+    throw DataManError ("TSMCubeCompress: compressed tile is corrupt");
+  }
+  if (*in++ == 0) {
+    if (inEnd - in < Int64(length)) {
+      throw DataManError ("TSMCubeCompress: compressed tile is corrupt");
+    }
+    memcpy (data, in, length);
+    return in + length;
+  }
+  if (valueSize == 0  ||  length % valueSize != 0) {
+    valueSize = 1;
+  }
+  uInt nrval = length / valueSize;
+  uInt64 distance = getLength (in, inEnd);
+  if (distance == 0  ||  (distance > nrval  &&  distance > 1)) {
+    throw DataManError ("TSMCubeCompress: compressed tile is corrupt");
+  }
+  std::vector<uChar> shuffled(length);
+  uChar* p = shuffled.data();
+  uInt i = 0;
+  while (i < length) {
+    uInt64 value = getLength (in, inEnd);
+    uInt64 n = value >> 1;
+    if (n > length - i) {
+      throw DataManError ("TSMCubeCompress: compressed tile is corrupt");
+    }
+    if (value & 1) {
+      if (in >= inEnd) {
+        throw DataManError ("TSMCubeCompress: compressed tile is corrupt");
+      }
+      memset (p + i, *in++, n);
+    } else {
+      if (uInt64(inEnd - in) < n) {
+        throw DataManError ("TSMCubeCompress: compressed tile is corrupt");
+      }
+      memcpy (p + i, in, n);
+      in += n;
+    }
+    i += n;
+  }
+  // Unshuffle and undo the XOR with the value the distance before.
+  uChar* out = reinterpret_cast<uChar*>(data);
+  for (uInt b=0; b<valueSize; ++b) {
+    const uChar* plane = p + size_t(b) * nrval;
+    uChar* outb = out + b;
+    for (uInt i=0; i<nrval; ++i) {
+      outb[size_t(i) * valueSize] = (i < distance  ?  plane[i] :
+                                     plane[i] ^ outb[size_t(i - distance) *
+                                                     valueSize]);
+    }
+  }
+  return in;
+}
+
+
+void TSMCubeCompress::accessSection (const IPosition& start,
+                                     const IPosition& end,
+                                     char* section, uInt colnr,
+                                     uInt localPixelSize, uInt,
+                                     Bool writeFlag)
+{
+  // Set flag if writing.
+  if (writeFlag) {
+    stmanPtr_p->setDataChanged();
+  }
+  uInt i;
+  for (i=0; i<nrdim_p; i++) {
+    startTile_p(i) = start(i) / tileShape_p(i);
+    endTile_p(i)   = end(i) / tileShape_p(i);
+    nrTileSection_p(i)         = 1 + endTile_p(i) - startTile_p(i);
+    startPixelInFirstTile_p(i) = start(i) - startTile_p(i)*tileShape_p(i);
+    endPixelInLastTile_p(i)    = end(i) - endTile_p(i) * tileShape_p(i);
+    endPixelInFirstTile_p(i)   = tileShape_p(i) - 1;
+    if (nrTileSection_p(i) == 1) {
+      endPixelInFirstTile_p(i) = endPixelInLastTile_p(i);
+    }
+  }
+  BucketCache* cachePtr = getCache();
+  // A tile can contain more than one data array.
+  uInt pixelOffset = localOffset_p[colnr];
+  // Loop through all tiles needed and copy the part needed.
+  IPosition startSection (start);
+  IPosition sectionShape (end - start + 1);
+  TSMShape expandedSectionShape (sectionShape);
+  IPosition startPixel (startPixelInFirstTile_p);
+  IPosition endPixel   (endPixelInFirstTile_p);
+  IPosition tilePos    (startTile_p);
+  IPosition tileIncr =
+    expandedTilesPerDim_p.offsetIncrement (nrTileSection_p);
+  uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
+  while (True) {
+    char* dataArray = cachePtr->getBucket (tileNr);
+    if (writeFlag) {
+      cachePtr->setDirty();
+    }
+    copyTilePart (dataArray, section, tilePos, startPixel, endPixel,
+                  startSection, expandedSectionShape,
+                  pixelOffset, localPixelSize, writeFlag);
+    // Determine the next tile to access and the starting and
+    // ending pixels in it.
+    for (i=0; i<nrdim_p; i++) {
+      tileNr += tileIncr(i);
+      startPixel(i) = 0;
+      if (++tilePos(i) < endTile_p(i)) {
+        break;                                 // not at last tile
+      }
+      if (tilePos(i) == endTile_p(i)) {
+        endPixel(i) = endPixelInLastTile_p(i);   // last tile
+        break;
+      }
+      // Past last tile in this dimension.
+      // Reset start and end.
+      tilePos(i) = startTile_p(i);
+      startPixel(i) = startPixelInFirstTile_p(i);
+      endPixel(i)   = endPixelInFirstTile_p(i);
+    }
+    if (i == nrdim_p) {
+      break;                                     // ready
+    }
+  }
+}
+
+void TSMCubeCompress::accessStrided (const IPosition& start,
+                                     const IPosition& end,
+                                     const IPosition& stride,
+                                     char* section, uInt colnr,
+                                     uInt localPixelSize,
+                                     uInt externalPixelSize,
+                                     Bool writeFlag)
+{
+  // If no strides, use accessSection.
+  if (stride.allOne()) {
+    accessSection (start, end, section, colnr,
+                   localPixelSize, externalPixelSize, writeFlag);
+    return;
+  }
+  // Get the data by getting the array part and stride it thereafter
+  // (like TSMCubeBuff does). When writing it is the opposite.
+  // Handle the arrays as chars to be type-agnostic, so add an axis for it.
+  IPosition sectShape ((end - start + stride) / stride);
+  IPosition fullShape (end - start + 1);
+  IPosition incr(stride);
+  if (localPixelSize != 1) {
+    sectShape.prepend (IPosition(1, localPixelSize));
+    fullShape.prepend (IPosition(1, localPixelSize));
+    incr.prepend (IPosition(1,1));
+  }
+  IPosition fst(incr.size(), 0);
+  IPosition fend(fullShape - 1);
+  Array<char> fullArr(fullShape);
+  Array<char> partArr = fullArr(fst, fend, incr);
+  Array<char> sectArr(sectShape, section, SHARE);
+  accessSection (start, end, fullArr.data(), colnr,
+                 localPixelSize, externalPixelSize, False);
+  if (writeFlag) {
+    partArr = sectArr;
+    accessSection (start, end, fullArr.data(), colnr,
+                   localPixelSize, externalPixelSize, True);
+  } else {
+    sectArr = partArr;
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
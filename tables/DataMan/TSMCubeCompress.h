@@ -0,0 +1,231 @@
+//# TSMCubeCompress.h: Tiled hypercube in a table holding compressed tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TSMCUBECOMPRESS_H
+#define TABLES_TSMCUBECOMPRESS_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/DataMan/TSMCube.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Tiled hypercube in a table holding losslessly compressed tiles
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTiledCompressStMan">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TSMCube>TSMCube</linkto>
+//   <li> <linkto class=TiledCompressStMan>TiledCompressStMan</linkto>
+// </prerequisite>
+
+// <etymology>
+// TSMCubeCompress represents a hypercube with compressed tiles
+// in the Tiled Storage Manager.
+// </etymology>
+
+// <synopsis>
+// TSMCubeCompress is a hypercube using the same tile addressing as
+// TSMCube, but each tile is compressed when written to the TSMFile and
+// decompressed when read back. Because compressed tiles have a variable
+// length, the tiles are not stored at fixed positions in the file.
+// Instead the offset and length of each tile are kept in an index that is
+// written with the other hypercube data in the header file.
+// The space for a tile is allocated in the TSMFile when the tile is
+// written for the first time. When a tile is rewritten, it is stored in
+// its old place if it still fits. Otherwise its old space is released in
+// the TSMFile and new space is allocated, which reuses released space if
+// possible. A tile that has never been written is not stored at all; it
+// reads as zeroes like an uninitialized tile in TSMCube.
+// <p>
+// The data of each data column in a tile (in external format) is
+// compressed separately. The values are XOR-ed with the preceding value
+// on the first or second axis (whichever compresses best),
+// whereafter the bytes are shuffled such that the first bytes of all
+// values come first, then the second bytes, etc.. The result is run-length
+// encoded. In this way a constant or slowly varying array (such as a
+// WEIGHT_SPECTRUM) gives long runs of zero bytes, just like the
+// bit-packed Bools of a FLAG column having the same flag for many
+// channels or correlations. If compression does not reduce the size,
+// the data are stored as is.
+// <p>
+// The tiles are held in local format in the BucketCache used by TSMCube,
+// so a tile is only decompressed once while it stays in the cache.
+// The BucketCache lets this class read and write the tiles, because
+// compressed tiles are not stored at fixed offsets.
+// </synopsis>
+
+// <motivation>
+// FLAG and WEIGHT_SPECTRUM columns are highly redundant, but take as
+// much disk space and I/O as the visibility data when stored in a
+// normal tiled hypercube.
+// </motivation>
+
+//# <todo asof="$DATE:$">
+//# A List of bugs, limitations, extensions or planned refinements.
+//# </todo>
+
+
+class TSMCubeCompress: public TSMCube
+{
+public:
+    // Construct the hypercube using the given file with the given shape.
+    // The record contains the id and possible coordinate values.
+    TSMCubeCompress (TiledStMan* stman, TSMFile* file,
+                     const IPosition& cubeShape,
+                     const IPosition& tileShape,
+                     const Record& values);
+
+    // Reconstruct the hypercube by reading its data from the AipsIO stream.
+    // It will link itself to the correct TSMFile. The TSMFile objects
+    // must have been reconstructed in advance.
+    TSMCubeCompress (TiledStMan* stman, AipsIO& ios);
+
+    ~TSMCubeCompress() override;
+
+    // Forbid copy constructor.
+    TSMCubeCompress (const TSMCubeCompress&) = delete;
+
+    // Forbid assignment.
+    TSMCubeCompress& operator= (const TSMCubeCompress&) = delete;
+
+    // Flush the data in the cache.
+    void flushCache() override;
+
+    // Show the cache statistics.
+    void showCacheStatistics (ostream& os) const override;
+
+    // Put the data of the object (including the tile index)
+    // into the AipsIO stream.
+    void putObject (AipsIO& ios) override;
+
+    // Resync the object with the data file.
+    void resync (AipsIO& ios) override;
+
+    // Set the hypercube shape.
+    // This is only possible if the shape was not defined yet.
+    void setShape (const IPosition& cubeShape,
+                   const IPosition& tileShape) override;
+
+    // Extend the last dimension of the cube with the given number.
+    // The record can contain the coordinates of the elements added.
+    void extend (uInt64 nr, const Record& coordValues,
+                 const TSMColumn* lastCoordColumn) override;
+
+    // Read or write a section in the cube.
+    // It is assumed that the section buffer is long enough.
+    void accessSection (const IPosition& start, const IPosition& end,
+                        char* section, uInt colnr,
+                        uInt localPixelSize, uInt externalPixelSize,
+                        Bool writeFlag) override;
+
+    // Read or write a section in a strided way.
+    // It is assumed that the section buffer is long enough.
+    void accessStrided (const IPosition& start, const IPosition& end,
+                        const IPosition& stride,
+                        char* section, uInt colnr,
+                        uInt localPixelSize, uInt externalPixelSize,
+                        Bool writeFlag) override;
+
+    // Get the total length (in bytes) of the compressed tiles written.
+    Int64 compressedLength() const;
+
+    // Get the number of tiles written.
+    uInt nrTilesWritten() const;
+
+    // Compress the data of a data column in a tile. The data consist of
+    // values of <src>valueSize</src> bytes. Each value is XOR-ed with the
+    // value <src>distance</src> values before it. The result is appended
+    // to <src>out</src>.
+    static void compress (const char* data, uInt length, uInt valueSize,
+                          uInt distance, std::vector<uChar>& out);
+
+    // Decompress the data of a data column in a tile compressed by
+    // <src>compress</src>. It returns a pointer to the first byte after
+    // the compressed data. An exception is thrown if the compressed data
+    // are corrupt.
+    static const uChar* decompress (const uChar* in, const uChar* inEnd,
+                                    char* data, uInt length, uInt valueSize);
+
+private:
+    // Construct the cache object (if not constructed yet).
+    // It uses the callback functions below to read and write the tiles.
+    void makeCache() override;
+
+    // Read the tile index from the AipsIO stream.
+    void getIndex (AipsIO& ios);
+
+    // Resize the tile index after the number of tiles changed.
+    void resizeIndex();
+
+    // Define the callback functions for the BucketCache to read and
+    // write a tile.
+    // <group>
+    static char* readTileCallBack (void* owner, uInt tileNr);
+    static void writeTileCallBack (void* owner, uInt tileNr,
+                                   const char* local);
+    // </group>
+
+    // Read a tile from the file and decompress it into a new buffer
+    // in local format.
+    char* readCompressedTile (uInt tileNr);
+
+    // Compress a tile from the local buffer and write it into the file.
+    void writeCompressedTile (uInt tileNr, const char* local);
+
+    // Get the size of the values in a data column when compressing it.
+    uInt valueSize (uInt colnr) const;
+
+    // Read or write data in the file.
+    // <group>
+    void readFile (void* buffer, uInt length, Int64 offset);
+    void writeFile (const void* buffer, uInt length, Int64 offset);
+    // </group>
+
+    //# Declare member variables.
+    // Offset of each tile in the file (-1 is not written yet).
+    std::vector<Int64> tileOffset_p;
+    // Length of each compressed tile.
+    std::vector<uInt>  tileLength_p;
+    // Space available for each compressed tile.
+    std::vector<uInt>  tileSpace_p;
+    // Buffers for a tile in external and compressed format.
+    std::vector<char>  external_p;
+    std::vector<uChar> compressed_p;
+};
+
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
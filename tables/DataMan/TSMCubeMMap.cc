@@ -111,6 +111,11 @@ void TSMCubeMMap::deleteCache()
     cache_p = 0;
 }
 
+const char* TSMCubeMMap::mappedTile (uInt tileNr)
+{
+    return getCache()->getBucket (tileNr);
+}
+
 void TSMCubeMMap::setShape (const IPosition& cubeShape,
                             const IPosition& tileShape)
 {
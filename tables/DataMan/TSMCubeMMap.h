@@ -180,6 +180,9 @@ private:
     // Delete the cache object.
     virtual void deleteCache();
 
+    // Get a pointer to a tile in the mapped file.
+    virtual const char* mappedTile (uInt tileNr);
+
     //# Declare member variables.
     // The bucket cache.
     BucketMapped* cache_p;
@@ -295,6 +295,60 @@ void TSMDataColumn::accessColumnSlice (const Slicer& ns,
 }
 
 
+const char* TSMDataColumn::mappedColumnSlice (const Slicer* ns,
+                                              rownr_t startRow, rownr_t nrow,
+                                              IPosition& tileShape,
+                                              Slicer& tileSection)
+{
+    // Bools are stored as bits, so they cannot be used directly.
+    if (mustConvert_p  ||  tilePixelSize_p != localPixelSize_p
+    ||  nrow == 0) {
+        return 0;
+    }
+    // The rows have to be on the last axis of the hypercube.
+    IPosition startPos;
+    TSMCube* hypercube = stmanPtr_p->getHypercube (startRow, startPos);
+    uInt nrcell = stmanPtr_p->nrCoordVector();
+    if (startPos.nelements() != nrcell+1) {
+        return 0;
+    }
+    IPosition blc(nrcell, 0);
+    IPosition trc(startPos.getFirst(nrcell) - 1);
+    IPosition inc(nrcell, 1);
+    if (ns != 0) {
+        ns->inferShapeFromSource (startPos.getFirst(nrcell), blc, trc, inc);
+    }
+    IPosition start(nrcell+1);
+    IPosition end(nrcell+1);
+    IPosition stride(nrcell+1, 1);
+    for (uInt i=0; i<nrcell; i++) {
+        start(i)  = blc(i);
+        end(i)    = trc(i);
+        stride(i) = inc(i);
+    }
+    start(nrcell) = startPos(nrcell);
+    end(nrcell)   = startPos(nrcell) + nrow - 1;
+    IPosition startInTile;
+    const char* data = hypercube->mappedSection (start, end, colnr_p,
+                                                 startInTile);
+    if (data == 0) {
+        return 0;
+    }
+    // The section is within a tile, so only a few rows have to be checked.
+    IPosition pos;
+    for (rownr_t i=1; i<nrow; i++) {
+        if (stmanPtr_p->getHypercube (startRow+i, pos) != hypercube
+        ||  pos(nrcell) != startPos(nrcell) + Int64(i)) {
+            return 0;
+        }
+    }
+    tileShape = hypercube->tileShape();
+    tileSection = Slicer (startInTile, startInTile + end - start, stride,
+                          Slicer::endIsLast);
+    return data;
+}
+
+
 void TSMDataColumn::accessColumnCells (const RefRows& rownrs,
 				       const IPosition& arrShape,
 				       const void* dataPtr, Bool writeFlag)
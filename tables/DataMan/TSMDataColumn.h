@@ -270,6 +270,20 @@ public:
       { return mustConvert_p; }
 
 private:
+    friend class ROTiledStManAccessor;
+
+    // Get a pointer to the data of a section of the cells in the rows
+    // <src>startRow</src> till <src>startRow+nrow-1</src> in a tile of a
+    // memory-mapped hypercube. The shape of the tile's data array and the
+    // section in that array are returned.
+    // A null pointer is returned if the data are not in local format, if
+    // the section is not contained in a single tile, or if the rows are not
+    // consecutive in the last axis of the hypercube.
+    // It is only used by ROTiledStManAccessor::getColumnView.
+    const char* mappedColumnSlice (const Slicer* ns, rownr_t startRow,
+                                   rownr_t nrow, IPosition& tileShape,
+                                   Slicer& tileSection);
+
     // The (canonical) size of a pixel in a tile.
     uInt tilePixelSize_p;
     // The local size of a pixel.
@@ -33,6 +33,7 @@
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/stdio.h>		// for snprintf
+#include <iterator>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 TSMFile::TSMFile (const TiledStMan* stman, uInt fileSequenceNr,
@@ -100,7 +101,11 @@ TSMFile::~TSMFile()
 void TSMFile::putObject (AipsIO& ios) const
 {
     // Take care of forward compatibility (for small enough files).
+    // Version 3 is only needed if there are free extents.
     uInt version = (length_p < 2u*1024u*1024u*1024u  ?  1 : 2);
+    if (! freeSpace_p.empty()) {
+        version = 3;
+    }
     ios << version;
     ios << fileSeqnr_p;
     if (version == 1) {
@@ -109,6 +114,12 @@ void TSMFile::putObject (AipsIO& ios) const
     } else {
         ios << length_p;
     }
+    if (version == 3) {
+        ios << uInt64(freeSpace_p.size());
+        for (const auto& extent : freeSpace_p) {
+            ios << extent.first << extent.second;
+        }
+    }
 }
 
 void TSMFile::getObject (AipsIO& ios)
@@ -123,6 +134,70 @@ void TSMFile::getObject (AipsIO& ios)
     } else {
         ios >> length_p;
     }
+    if (version == 3) {
+        uInt64 nfree;
+        ios >> nfree;
+        for (uInt64 i=0; i<nfree; i++) {
+            Int64 offset, length;
+            ios >> offset >> length;
+            freeSpace_p[offset] = length;
+        }
+    }
+}
+
+Int64 TSMFile::allocate (Int64 length)
+{
+    // Use the first free extent large enough.
+    for (auto iter=freeSpace_p.begin(); iter!=freeSpace_p.end(); ++iter) {
+        if (iter->second >= length) {
+            Int64 offset = iter->first;
+            Int64 rest   = iter->second - length;
+            freeSpace_p.erase (iter);
+            if (rest > 0) {
+                freeSpace_p[offset + length] = rest;
+            }
+            return offset;
+        }
+    }
+    Int64 offset = length_p;
+    length_p += length;
+    return offset;
+}
+
+void TSMFile::release (Int64 offset, Int64 length)
+{
+    if (length <= 0) {
+        return;
+    }
+    // Merge with the next and previous free extent if adjacent.
+    auto next = freeSpace_p.lower_bound (offset);
+    if (next != freeSpace_p.end()  &&  offset + length == next->first) {
+        length += next->second;
+        next = freeSpace_p.erase (next);
+    }
+    if (next != freeSpace_p.begin()) {
+        auto prev = std::prev (next);
+        if (prev->first + prev->second == offset) {
+            offset  = prev->first;
+            length += prev->second;
+            freeSpace_p.erase (prev);
+        }
+    }
+    // Space at the end of the file is given back to the file.
+    if (offset + length == length_p) {
+        length_p = offset;
+    } else {
+        freeSpace_p[offset] = length;
+    }
+}
+
+Int64 TSMFile::freeLength() const
+{
+    Int64 length = 0;
+    for (const auto& extent : freeSpace_p) {
+        length += extent.second;
+    }
+    return length;
 }
 
 } //# NAMESPACE CASACORE - END
@@ -29,6 +29,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -66,6 +67,12 @@ class AipsIO;
 // <p>
 // Underneath it uses a BucketFile to access the file.
 // In this way the IO details are well encapsulated.
+// <p>
+// Hypercubes with variable length tiles (see
+// <linkto class=TSMCubeCompress>TSMCubeCompress</linkto>) allocate the
+// space for a tile in the file and release it when the tile is moved.
+// TSMFile keeps a list of the released extents, so they can be reused.
+// The list is written with the other TSMFile data.
 // </synopsis> 
 
 // <motivation>
@@ -127,6 +134,18 @@ public:
     // Increment the logical file length.
     void extend (Int64 increment);
 
+    // Allocate the given number of bytes in the file. A free extent is
+    // used if possible, otherwise the file is extended.
+    // It returns the offset of the space allocated.
+    Int64 allocate (Int64 length);
+
+    // Release the space at the given offset, so it can be reused.
+    // It is merged with adjacent free extents.
+    void release (Int64 offset, Int64 length);
+
+    // Get the total length of the free extents.
+    Int64 freeLength() const;
+
 
 private:
     // The file sequence number.
@@ -135,6 +154,8 @@ private:
     BucketFile* file_p;
     // The (logical) length of the file.
     Int64 length_p;
+    // The free extents in the file (offset and length).
+    std::map<Int64,Int64> freeSpace_p;
 };
 
 
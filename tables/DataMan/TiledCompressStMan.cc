@@ -0,0 +1,80 @@
+//# TiledCompressStMan.cc: Tiled Storage Manager compressing the tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/DataMan/TiledCompressStMan.h>
+#include <casacore/tables/DataMan/TSMCubeCompress.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+TiledCompressStMan::TiledCompressStMan (const String& hypercolumnName,
+                                        const IPosition& defaultTileShape,
+                                        uInt64 maximumCacheSize)
+: TiledShapeStMan (hypercolumnName, defaultTileShape, maximumCacheSize)
+{}
+
+TiledCompressStMan::TiledCompressStMan (const String& hypercolumnName,
+                                        const Record& spec)
+: TiledShapeStMan (hypercolumnName, spec)
+{}
+
+TiledCompressStMan::~TiledCompressStMan()
+{}
+
+DataManager* TiledCompressStMan::clone() const
+{
+    TiledCompressStMan* smp = new TiledCompressStMan (hypercolumnName_p,
+                                                      defaultTileShape(),
+                                                      maximumCacheSize());
+    return smp;
+}
+
+DataManager* TiledCompressStMan::makeObject (const String& group,
+                                             const Record& spec)
+{
+    TiledCompressStMan* smp = new TiledCompressStMan (group, spec);
+    return smp;
+}
+
+String TiledCompressStMan::dataManagerType() const
+    { return "TiledCompressStMan"; }
+
+TSMCube* TiledCompressStMan::makeTSMCube (TSMFile* file,
+                                          const IPosition& cubeShape,
+                                          const IPosition& tileShape,
+                                          const Record& values,
+                                          Int64)
+{
+    return new TSMCubeCompress (this, file, cubeShape, tileShape, values);
+}
+
+TSMCube* TiledCompressStMan::makeTSMCube (AipsIO& headerFile)
+{
+    return new TSMCubeCompress (this, headerFile);
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,148 @@
+//# TiledCompressStMan.h: Tiled Storage Manager compressing the tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TILEDCOMPRESSSTMAN_H
+#define TABLES_TILEDCOMPRESSSTMAN_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Tiled Storage Manager using the shape as id and compressing the tiles.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTiledCompressStMan">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TiledShapeStMan>TiledShapeStMan</linkto>
+//   <li> <linkto class=TSMCubeCompress>TSMCubeCompress</linkto>
+// </prerequisite>
+
+// <etymology>
+// TiledCompressStMan is the Tiled Storage Manager compressing its tiles.
+// </etymology>
+
+// <synopsis>
+// TiledCompressStMan behaves like
+// <linkto class=TiledShapeStMan>TiledShapeStMan</linkto>, thus creates
+// a hypercube for each different shape of the data arrays. However, its
+// hypercubes losslessly compress each tile when written to disk (see class
+// <linkto class=TSMCubeCompress>TSMCubeCompress</linkto> for the details).
+// The tile addressing is the same as in the other tiled storage managers,
+// so arbitrary slices of the data can be accessed efficiently.
+// <p>
+// The compression is very effective for highly redundant columns like
+// the FLAG column (Bools are stored as bits and usually have long
+// runs of equal flags) and the WEIGHT_SPECTRUM column (whose weights are
+// often constant along frequency). It is not meant for noise-like data
+// like visibilities, which are stored uncompressed if the compression does
+// not pay off.
+// <br>Note that a rewritten tile is stored in a new place if it no longer
+// fits in its old place, so the file can contain some unused space if
+// the data are changed frequently (e.g. by flagging).
+// <p>
+// The storage manager can be used in the same way as TiledShapeStMan.
+// The tables using it cannot be read by casacore versions not having
+// this storage manager.
+// </synopsis>
+
+// <motivation>
+// FLAG and WEIGHT_SPECTRUM columns can take as much disk space and I/O
+// as the DATA column, although they contain much less information.
+// </motivation>
+
+// <example>
+// <srcblock>
+//  // Store FLAG and WEIGHT_SPECTRUM in compressing hypercubes with
+//  // tiles of 4 correlations, 64 channels and 16 rows.
+//  TiledCompressStMan stman1 ("TiledFlag", IPosition(3,4,64,16));
+//  newtab.bindColumn ("FLAG", stman1);
+//  TiledCompressStMan stman2 ("TiledWeightSpectrum", IPosition(3,4,64,16));
+//  newtab.bindColumn ("WEIGHT_SPECTRUM", stman2);
+// </srcblock>
+// </example>
+
+//# <todo asof="$DATE:$">
+//# A List of bugs, limitations, extensions or planned refinements.
+//# </todo>
+
+
+class TiledCompressStMan : public TiledShapeStMan
+{
+public:
+    // Create a TiledCompressStMan storage manager for the hypercolumn
+    // with the given name.
+    // The arguments are the same as for
+    // <linkto class=TiledShapeStMan>TiledShapeStMan</linkto>.
+    // <group>
+    TiledCompressStMan (const String& hypercolumnName,
+                        const IPosition& defaultTileShape,
+                        uInt64 maximumCacheSize = 0);
+    TiledCompressStMan (const String& hypercolumnName,
+                        const Record& spec);
+    // </group>
+
+    ~TiledCompressStMan() override;
+
+    // Forbid copy constructor.
+    TiledCompressStMan (const TiledCompressStMan&) = delete;
+
+    // Forbid assignment.
+    TiledCompressStMan& operator= (const TiledCompressStMan&) = delete;
+
+    // Clone this object.
+    // It does not clone TSMColumn objects possibly used.
+    DataManager* clone() const override;
+
+    // Get the type name of the data manager (i.e. TiledCompressStMan).
+    String dataManagerType() const override;
+
+    // Make a TSMCubeCompress object.
+    // The tiles are always compressed, so the TSMOption is not used.
+    // <group>
+    TSMCube* makeTSMCube (TSMFile* file, const IPosition& cubeShape,
+                          const IPosition& tileShape,
+                          const Record& values,
+                          Int64 fileOffset=-1) override;
+    TSMCube* makeTSMCube (AipsIO& headerFile) override;
+    // </group>
+
+    // Make the object from the type name string.
+    // This function gets registered in the DataManager "constructor" map.
+    static DataManager* makeObject (const String& dataManagerType,
+                                    const Record& spec);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -238,15 +238,16 @@ public:
     static DataManager* makeObject (const String& dataManagerType,
 				    const Record& spec);
 
+protected:
+    // Get the default tile shape.
+    virtual IPosition defaultTileShape() const;
+
 private:
     // Create a TiledShapeStMan.
     // This constructor is private, because it should only be used
     // by makeObject.
     TiledShapeStMan();
 
-    // Get the default tile shape.
-    virtual IPosition defaultTileShape() const;
-
     // Add rows to the storage manager.
     void addRow64 (rownr_t nrrow);
 
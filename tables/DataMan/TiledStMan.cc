@@ -401,6 +401,22 @@ TSMCube* TiledStMan::makeTSMCube (TSMFile* file, const IPosition& cubeShape,
     return hypercube;
 }
 
+TSMCube* TiledStMan::makeTSMCube (AipsIO& headerFile)
+{
+    TSMCube* hypercube;
+    if (tsmOption().option() == TSMOption::MMap) {
+        //cout << "mmapping TSM" << endl;
+        hypercube = new TSMCubeMMap (this, headerFile);
+    } else if (tsmOption().option() == TSMOption::Buffer) {
+        //cout << "buffered TSM" << endl;
+        hypercube = new TSMCubeBuff (this, headerFile);
+    } else {
+        //cout << "caching TSM" << endl;
+        hypercube = new TSMCube (this, headerFile);
+    }
+    return hypercube;
+}
+
 TSMCube* TiledStMan::getTSMCube (uInt hypercube)
 {
     if (hypercube >= nhypercubes()  ||  cubeSet_p[hypercube] == 0) {
@@ -593,6 +609,18 @@ int TiledStMan::coordinateDataType (const String& columnName) const
     return 0;
 }
 
+TSMDataColumn* TiledStMan::findDataColumn (const String& columnName)
+{
+    for (uInt i=0; i<dataCols_p.nelements(); i++) {
+	if (columnName == dataCols_p[i]->columnName()) {
+	    return dataCols_p[i];
+	}
+    }
+    throw (TSMError ("findDataColumn: column " + columnName +
+		     " is not a data column"));
+    return 0;
+}
+
 // Get the proper array data type.
 int TiledStMan::arrayDataType (int dataType) const
 {
@@ -1218,16 +1246,7 @@ uInt TiledStMan::headerFileGet (AipsIO& headerFile, rownr_t tabNrrow,
     }
     for (uInt64 i=0; i<nrCube; i++) {
 	if (cubeSet_p[i] == 0) {
-            if (tsmOption().option() == TSMOption::MMap) {
-                //cout << "mmapping TSM" << endl;
-                cubeSet_p[i] = new TSMCubeMMap (this, headerFile);
-            } else if (tsmOption().option() == TSMOption::Buffer) {
-                //cout << "buffered TSM" << endl;
-                cubeSet_p[i] = new TSMCubeBuff (this, headerFile);
-            }else{
-                //cout << "caching TSM" << endl;
-	        cubeSet_p[i] = new TSMCube (this, headerFile);
-            }
+            cubeSet_p[i] = makeTSMCube (headerFile);
 	}else{
 	    cubeSet_p[i]->resync (headerFile);
 	}
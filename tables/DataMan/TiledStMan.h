@@ -305,9 +305,13 @@ public:
     virtual TSMCube* getHypercube (rownr_t rownr, IPosition& position) = 0;
 
     // Make the correct TSMCube type (depending on tsmOption()).
-    TSMCube* makeTSMCube (TSMFile* file, const IPosition& cubeShape,
-                          const IPosition& tileShape,
-                          const Record& values, Int64 fileOffset=-1);
+    // The second version reconstructs the hypercube from the header file.
+    // <group>
+    virtual TSMCube* makeTSMCube (TSMFile* file, const IPosition& cubeShape,
+                                  const IPosition& tileShape,
+                                  const Record& values, Int64 fileOffset=-1);
+    virtual TSMCube* makeTSMCube (AipsIO& headerFile);
+    // </group>
 
     // Read a tile and convert the data to local format.
     void readTile (char* local, const Block<uInt>& localOffset,
@@ -381,6 +385,10 @@ public:
     const TSMDataColumn* getDataColumn (uInt colnr) const
       { return dataCols_p[colnr]; }
 
+    // Get pointer to the data column object with the given name.
+    // An exception is thrown when the column is unknown.
+    TSMDataColumn* findDataColumn (const String& columnName);
+
 protected:
     // Set the persistent maximum cache size (in MiB).
     void setPersMaxCacheSize (uInt nMiB);
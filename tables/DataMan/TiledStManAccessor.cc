@@ -27,6 +27,7 @@
 #include <casacore/tables/DataMan/TiledStManAccessor.h>
 #include <casacore/tables/DataMan/TiledStMan.h>
 #include <casacore/tables/DataMan/TSMCube.h>
+#include <casacore/tables/DataMan/TSMDataColumn.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/BasicSL/String.h>
@@ -200,5 +201,23 @@ void ROTiledStManAccessor::clearCaches()
     dataManPtr_p->emptyCaches();
 }
 
+const void* ROTiledStManAccessor::mappedColumnSlice
+                                        (const String& columnName,
+                                         DataType dtype,
+                                         const Slicer* cellSection,
+                                         rownr_t startRow, rownr_t nrow,
+                                         IPosition& tileShape,
+                                         Slicer& tileSection) const
+{
+    TSMDataColumn* column = dataManPtr_p->findDataColumn (columnName);
+    if (column->dataType() != dtype) {
+	throw (DataManError ("ROTiledStManAccessor::getColumnView: "
+			     "data type mismatch for column " + columnName));
+    }
+    return column->mappedColumnSlice (cellSection, startRow, nrow,
+				      tileShape, tileSection);
+}
+
+
 } //# NAMESPACE CASACORE - END
 
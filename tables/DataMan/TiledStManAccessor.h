@@ -29,7 +29,11 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/DataManAccessor.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/iosfwd.h>
+#include <cstdint>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -123,6 +127,18 @@ class Record;
 // The 'get' functions get the information for the given hypercube,
 // while similar functions without the 'get' prefix do the same for the
 // given row.
+// <p>
+// If the tiles are memory-mapped (see
+// <linkto class=TSMOption>TSMOption</linkto>), the function
+// <src>getColumnView</src> can be used to get a
+// <linkto class=TiledColumnView>TiledColumnView</linkto> referencing the
+// data of some rows directly in the mapped file, thus without copying the
+// data. It is only possible if the data are stored in the local byte order
+// (Bool data are stored as bits, so never) and if the requested section
+// is contained in a single tile. A section can be strided.
+// The view gives read-only access, because the file is mapped read-only
+// for a table opened for read. It is only valid as long as the table is
+// not closed or changed (e.g. by adding rows).
 // </synopsis> 
 
 // <motivation>
@@ -151,6 +167,46 @@ class Record;
 //# </todo>
 
 
+// <summary>
+// Read-only view of memory-mapped data in a tiled storage manager
+// </summary>
+
+// <use visibility=export>
+
+// <synopsis>
+// A TiledColumnView is filled by <src>ROTiledStManAccessor::getColumnView</src>.
+// It references data of a tile in a memory-mapped file, which can be
+// mapped read-only. Therefore the data can only be accessed as a const
+// Array; they must be changed using the normal ArrayColumn functions.
+// </synopsis>
+
+template<typename T>
+class TiledColumnView
+{
+public:
+    // Create an empty view.
+    TiledColumnView()
+      {}
+
+    // Get the data as a const Array.
+    const Array<T>& array() const
+      { return itsArray; }
+
+    // Get the shape of the view.
+    const IPosition& shape() const
+      { return itsArray.shape(); }
+
+    // Get the element at the given position.
+    const T& operator() (const IPosition& index) const
+      { return itsArray(index); }
+
+private:
+    friend class ROTiledStManAccessor;
+
+    Array<T> itsArray;
+};
+
+
 class ROTiledStManAccessor : public RODataManAccessor
 {
 public:
@@ -279,6 +335,33 @@ public:
     // resulting in a possibly large drop in memory used.
     void clearCaches();
 
+    // Get a read-only view of the data in rows <src>startRow</src> till
+    // <src>startRow+nrow-1</src> of the given column. The view references
+    // the memory-mapped tile, so no data are copied. The view's shape is
+    // the (section of) the cell shape with the rows as the last axis,
+    // thus as returned by <src>ArrayColumn::getColumnRange</src>.
+    // False is returned if such a view cannot be made, in which case the
+    // data have to be read the usual way. It can only be done
+    // <ul>
+    //  <li> if the storage manager is opened with TSMOption::MMap.
+    //  <li> if the data are stored in the local byte order.
+    //  <li> if the section and rows are contained in a single tile.
+    //  <li> if the rows are consecutive in the last axis of the hypercube.
+    // </ul>
+    // An exception is thrown if the column is not a data column of this
+    // storage manager or if its data type does not match T.
+    // <group>
+    template<typename T>
+    Bool getColumnView (const String& columnName, rownr_t startRow,
+                        rownr_t nrow, TiledColumnView<T>& view) const
+      { return makeColumnView (columnName, 0, startRow, nrow, view); }
+    template<typename T>
+    Bool getColumnView (const String& columnName, const Slicer& cellSection,
+                        rownr_t startRow, rownr_t nrow,
+                        TiledColumnView<T>& view) const
+      { return makeColumnView (columnName, &cellSection, startRow, nrow, view); }
+    // </group>
+
 
 protected:
     // Get the data manager.
@@ -286,11 +369,48 @@ protected:
 
 
 private:
+    // Make a view of the data (see <src>getColumnView</src>).
+    template<typename T>
+    Bool makeColumnView (const String& columnName, const Slicer* cellSection,
+                         rownr_t startRow, rownr_t nrow,
+                         TiledColumnView<T>& view) const;
+
+    // Get a pointer to the mapped data of the given column, the shape
+    // of its array in the tile, and the section of the rows in that array.
+    // A null pointer is returned if not possible.
+    const void* mappedColumnSlice (const String& columnName, DataType dtype,
+                                   const Slicer* cellSection,
+                                   rownr_t startRow, rownr_t nrow,
+                                   IPosition& tileShape,
+                                   Slicer& tileSection) const;
+
     //# Declare the data members.
     TiledStMan* dataManPtr_p;
 };
 
 
+template<typename T>
+Bool ROTiledStManAccessor::makeColumnView (const String& columnName,
+                                           const Slicer* cellSection,
+                                           rownr_t startRow, rownr_t nrow,
+                                           TiledColumnView<T>& view) const
+{
+    IPosition tileShape;
+    Slicer tileSection;
+    const void* data = mappedColumnSlice (columnName, whatType<T>(),
+                                          cellSection, startRow, nrow,
+                                          tileShape, tileSection);
+    if (data == 0
+    ||  reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0) {
+        return False;
+    }
+    Array<T> tile (tileShape, static_cast<T*>(const_cast<void*>(data)),
+                   SHARE);
+    view.itsArray.reference (tile(tileSection));
+    return True;
+}
+
+
 
 
 } //# NAMESPACE CASACORE - END
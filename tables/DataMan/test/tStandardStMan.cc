@@ -46,6 +46,8 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/sstream.h>
+#include <thread>
+#include <vector>
 
 #include <casacore/casa/namespace.h>
 // <summary>
@@ -93,6 +95,9 @@ void info(const Table aTable);
 // put/putColumn cache test
 void putColumnTest();
 
+// Test concurrent reading
+void testConcurrent();
+
 // Test writing and updating an indirect array.
 void testInd()
 {
@@ -166,6 +171,97 @@ void testInd2()
   }
 }
 
+// Read a table from multiple threads using a concurrent cache.
+void testConcurrent()
+{
+  cout << endl << "testConcurrent ..." << endl;
+  String tabName = "tStandardStMan_tmp.tabconc";
+  const uInt nrow = 10000;
+  {
+    TableDesc td;
+    td.addColumn (ScalarColumnDesc<Int>("colInt"));
+    td.addColumn (ScalarColumnDesc<Bool>("colBool"));
+    td.addColumn (ScalarColumnDesc<Double>("colDouble"));
+    SetupNewTable newtab(tabName, td, Table::New);
+    StandardStMan ssm("SSM", 512);
+    newtab.bindAll (ssm);
+    Table tab(newtab, nrow);
+    ScalarColumn<Int> colInt(tab, "colInt");
+    ScalarColumn<Bool> colBool(tab, "colBool");
+    ScalarColumn<Double> colDouble(tab, "colDouble");
+    for (uInt i=0; i<nrow; ++i) {
+      colInt.put (i, i);
+      colBool.put (i, i%3 == 0);
+      colDouble.put (i, i+0.5);
+    }
+  }
+  // Use a lock mode that does not need locking while reading.
+  Table tab(tabName, TableLock::PermanentLocking);
+  ROStandardStManAccessor acc(tab, "SSM");
+  acc.setConcurrentRead (4);
+  const uInt nthread = 4;
+  // Each thread uses its own column objects.
+  std::vector<ScalarColumn<Int>> colInts;
+  std::vector<ScalarColumn<Bool>> colBools;
+  std::vector<ScalarColumn<Double>> colDoubles;
+  for (uInt t=0; t<nthread; ++t) {
+    colInts.emplace_back (tab, "colInt");
+    colBools.emplace_back (tab, "colBool");
+    colDoubles.emplace_back (tab, "colDouble");
+  }
+  // Not vector<Bool>, whose elements share words.
+  std::vector<char> ok(nthread, False);
+  std::vector<std::thread> threads;
+  for (uInt t=0; t<nthread; ++t) {
+    threads.emplace_back ([&, t]() {
+      const ScalarColumn<Int>& colInt = colInts[t];
+      const ScalarColumn<Bool>& colBool = colBools[t];
+      const ScalarColumn<Double>& colDouble = colDoubles[t];
+      Bool fine = True;
+      for (uInt iter=0; iter<10; ++iter) {
+        // Read the part of this thread in chunks and strided.
+        for (uInt st=t*nrow/nthread; st<(t+1)*nrow/nthread; st+=250) {
+          Slicer rows(IPosition(1,st), IPosition(1,250));
+          Vector<Int> vi = colInt.getColumnRange (rows);
+          Vector<Bool> vb = colBool.getColumnRange (rows);
+          Vector<Double> vd = colDouble.getColumnRange (rows);
+          for (uInt i=0; i<250; ++i) {
+            fine = fine && vi[i] == Int(st+i) && vb[i] == ((st+i)%3 == 0)
+                        && vd[i] == st+i+0.5;
+          }
+        }
+        uInt nr = (nrow-1-t) / (nthread+1) + 1;
+        Slicer rows(IPosition(1,t), IPosition(1,nr),
+                    IPosition(1,nthread+1), Slicer::endIsLength);
+        Vector<Int> vi = colInt.getColumnRange (rows);
+        fine = fine && vi.size() == nr;
+        for (uInt i=0; i<vi.size(); ++i) {
+          fine = fine && vi[i] == Int(t + i*(nthread+1));
+        }
+      }
+      ok[t] = fine;
+    });
+  }
+  for (std::thread& thr : threads) {
+    thr.join();
+  }
+  for (uInt t=0; t<nthread; ++t) {
+    AlwaysAssertExit (ok[t]);
+  }
+  acc.setConcurrentRead (0);
+  cout << "read " << nrow << " rows in " << nthread << " threads" << endl;
+  // Concurrent reading is not possible for a writable table.
+  tab.reopenRW();
+  Bool caught = False;
+  try {
+    ROStandardStManAccessor acc2(tab, "SSM");
+    acc2.setConcurrentRead (4);
+  } catch (const std::exception&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+}
+
 int main (int argc, const char* argv[])
 {
   ///DataManager::MAXROWNR32 = 0;
@@ -214,6 +310,7 @@ int main (int argc, const char* argv[])
         // increase the file size.
         testInd();
         testInd2();
+        testConcurrent();
 
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
@@ -42,6 +42,7 @@
 #include <casacore/casa/Arrays/ArrayIter.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
@@ -59,6 +60,7 @@ void writeFixed(const TSMOption&);
 void readTable(const TSMOption&, Bool readKeys);
 void writeNoHyper(const TSMOption&);
 void extendOnly(const TSMOption&);
+void readSmallCache();
 
 int main () {
     try {
@@ -68,6 +70,7 @@ int main () {
 	readTable(TSMOption::Buffer, False);
         writeFixed(TSMOption::Buffer);
 	readTable(TSMOption::Cache, False);
+        readSmallCache();
         extendOnly(TSMOption::Cache);
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
@@ -441,6 +444,34 @@ void writeNoHyper(const TSMOption& tsmOpt)
     AlwaysAssertExit (accessor.getCacheSize(0) == accessor.cacheSize(2));
 }
 
+// Read the entire Data column using a cache of only a few tiles,
+// serially and in parallel. The tiles are read in batches then.
+void readSmallCache()
+{
+    Table table("tTiledColumnStMan_tmp.data", Table::Old,
+                TSMOption(TSMOption::Cache));
+    ArrayColumn<float> data (table, "Data");
+    ROTiledStManAccessor accessor (table, "TSMExample");
+    Cube<float> expected(16, 20, table.nrow());
+    Matrix<float> array(IPosition(2,16,20));
+    indgen (array);
+    for (uInt i=0; i<table.nrow(); i++) {
+        expected.xyPlane(i) = array;
+        array += float(200);
+    }
+    uInt nthreadOld = OMP::maxThreads();
+    for (uInt nthread=1; nthread<=4; nthread+=3) {
+        OMP::setNumThreads (nthread);
+        accessor.clearCaches();
+        accessor.setCacheSize (0, 3);
+        AlwaysAssertExit (allEQ (data.getColumn(), expected));
+        // Again, now some tiles are in the cache.
+        AlwaysAssertExit (allEQ (data.getColumn(), expected));
+        AlwaysAssertExit (accessor.cacheSize(0) == 3);
+    }
+    OMP::setNumThreads (nthreadOld);
+}
+
 // First build a description.
 void extendOnly(const TSMOption& tsmOpt)
 {
@@ -0,0 +1,372 @@
+//# tTiledCompressStMan.cc: Test program for the TiledCompressStMan
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/DataMan/TiledCompressStMan.h>
+#include <casacore/tables/DataMan/TSMCubeCompress.h>
+#include <casacore/tables/DataMan/TSMOption.h>
+#include <casacore/tables/DataMan/TSMFile.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+#include <cstring>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the TiledCompressStMan.
+// It writes FLAG, WEIGHT_SPECTRUM and DATA like columns and checks if they
+// are read back correctly (also in slices) and that the highly redundant
+// columns are stored in a compressed way.
+// </summary>
+
+const String theTableName ("tTiledCompressStMan_tmp.data");
+const uInt nchan = 64;
+const uInt ncorr = 4;
+const uInt nrow  = 200;
+
+Matrix<Bool> flagValue (uInt row)
+{
+  // Some rows are fully flagged, others have a few flagged channels.
+  Matrix<Bool> flags (ncorr, nchan, row%50 == 0);
+  if (row%7 == 0) {
+    flags (Slicer(IPosition(2,0,10), IPosition(2,ncorr,5))) = True;
+  }
+  flags (row%ncorr, row%nchan) = True;
+  return flags;
+}
+
+Matrix<Float> weightValue (uInt row)
+{
+  // The weights are constant along frequency.
+  Matrix<Float> weights (ncorr, nchan);
+  for (uInt i=0; i<ncorr; ++i) {
+    weights.row(i) = 1.5f + (row%13) * 0.25f + i;
+  }
+  return weights;
+}
+
+Matrix<Complex> dataValue (uInt row)
+{
+  Matrix<Complex> data (ncorr, nchan);
+  uInt seed = row + 1;
+  for (uInt i=0; i<data.nelements(); ++i) {
+    seed = seed * 1103515245 + 12345;
+    data.data()[i] = Complex (Float(seed % 10007) / 77.f,
+                              -Float((seed / 7) % 9973) / 33.f);
+  }
+  return data;
+}
+
+void createTable()
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Bool>    ("FLAG", 2));
+  td.addColumn (ArrayColumnDesc<Float>   ("WEIGHT_SPECTRUM", 2));
+  td.addColumn (ArrayColumnDesc<Complex> ("DATA", 2));
+  td.defineHypercolumn ("TiledFlag", 3, Vector<String>(1, "FLAG"));
+  td.defineHypercolumn ("TiledWeight", 3,
+                        Vector<String>(1, "WEIGHT_SPECTRUM"));
+  td.defineHypercolumn ("TiledData", 3, Vector<String>(1, "DATA"));
+  SetupNewTable newtab (theTableName, td, Table::New);
+  IPosition tileShape (3, ncorr, 16, 8);
+  TiledCompressStMan sm1 ("TiledFlag", tileShape);
+  TiledCompressStMan sm2 ("TiledWeight", tileShape);
+  TiledCompressStMan sm3 ("TiledData", tileShape);
+  newtab.bindColumn ("FLAG", sm1);
+  newtab.bindColumn ("WEIGHT_SPECTRUM", sm2);
+  newtab.bindColumn ("DATA", sm3);
+  Table tab (newtab);
+  ArrayColumn<Bool>    flag   (tab, "FLAG");
+  ArrayColumn<Float>   weight (tab, "WEIGHT_SPECTRUM");
+  ArrayColumn<Complex> data   (tab, "DATA");
+  for (uInt i=0; i<nrow; ++i) {
+    tab.addRow();
+    flag.put   (i, flagValue(i));
+    weight.put (i, weightValue(i));
+    data.put   (i, dataValue(i));
+  }
+  // Add a few rows with another shape, giving another hypercube.
+  for (uInt i=nrow; i<nrow+10; ++i) {
+    tab.addRow();
+    flag.put (i, Matrix<Bool>(2, 8, i%2==0));
+    weight.put (i, Matrix<Float>(2, 8, Float(i)));
+    data.put (i, Matrix<Complex>(2, 8, Complex(i, -1)));
+  }
+}
+
+void checkTable (const TSMOption& tsmOpt)
+{
+  Table tab (theTableName, TableLock(), Table::Old, tsmOpt);
+  AlwaysAssertExit (tab.nrow() == nrow + 10);
+  ArrayColumn<Bool>    flag   (tab, "FLAG");
+  ArrayColumn<Float>   weight (tab, "WEIGHT_SPECTRUM");
+  ArrayColumn<Complex> data   (tab, "DATA");
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (allEQ (flag.get(i), flagValue(i)));
+    AlwaysAssertExit (allEQ (weight.get(i), weightValue(i)));
+    AlwaysAssertExit (allEQ (data.get(i), dataValue(i)));
+  }
+  for (uInt i=nrow; i<nrow+10; ++i) {
+    AlwaysAssertExit (flag.shape(i) == IPosition(2,2,8));
+    AlwaysAssertExit (allEQ (flag.get(i), i%2==0));
+    AlwaysAssertExit (allEQ (weight.get(i), Float(i)));
+  }
+  // Get slices spanning multiple tiles, also strided.
+  Slicer slicer (IPosition(2,1,5), IPosition(2,2,15), IPosition(2,2,3));
+  Cube<Bool>  flags   = flag.getColumnRange (Slicer(IPosition(1,3),
+                                                    IPosition(1,50)),
+                                             slicer);
+  Cube<Float> weights = weight.getColumnRange (Slicer(IPosition(1,3),
+                                                      IPosition(1,50)),
+                                               slicer);
+  for (uInt i=0; i<50; ++i) {
+    AlwaysAssertExit (allEQ (flags.xyPlane(i),
+                             flagValue(i+3)(slicer)));
+    AlwaysAssertExit (allEQ (weights.xyPlane(i),
+                             weightValue(i+3)(slicer)));
+  }
+}
+
+Int64 fileSizes (const Table& tab, const String& dmName)
+{
+  Record dminfo = tab.dataManagerInfo();
+  for (uInt i=0; i<dminfo.nfields(); ++i) {
+    const Record& dm = dminfo.subRecord(i);
+    if (dm.asString("NAME") == dmName) {
+      Int64 size = 0;
+      for (uInt j=0; j<10; ++j) {
+        File file (theTableName + "/table.f" +
+                   String::toString(dm.asInt("SEQNR")) +
+                   "_TSM" + String::toString(j));
+        if (file.exists()) {
+          size += file.size();
+        }
+      }
+      return size;
+    }
+  }
+  return 0;
+}
+
+void checkSize (Bool updated)
+{
+  Table tab (theTableName);
+  Int64 flagSize   = fileSizes (tab, "TiledFlag");
+  Int64 weightSize = fileSizes (tab, "TiledWeight");
+  Int64 dataSize   = fileSizes (tab, "TiledData");
+  cout << "stored FLAG: " << flagSize << " WEIGHT_SPECTRUM: " << weightSize
+       << " DATA: " << dataSize << " bytes" << endl;
+  // Uncompressed a Bool takes 1 bit, a float 4 bytes and a complex 8 bytes.
+  Int64 nval = Int64(nrow) * ncorr * nchan;
+  if (updated) {
+    // The rewritten data are less redundant and rewritten tiles might
+    // have been moved, but compression should still pay off.
+    AlwaysAssertExit (flagSize > 0  &&  flagSize < nval / 8);
+    AlwaysAssertExit (weightSize > 0  &&  weightSize < nval * 4 / 2);
+  } else {
+    AlwaysAssertExit (flagSize > 0  &&  flagSize < nval / 8 / 3);
+    AlwaysAssertExit (weightSize > 0  &&  weightSize < nval * 4 / 20);
+  }
+  // The noise-like data cannot be compressed (much).
+  AlwaysAssertExit (dataSize > nval * 8 / 2);
+}
+
+void updateTable()
+{
+  // Rewrite data with less redundant data, so tiles get larger.
+  Table tab (theTableName, Table::Update);
+  ArrayColumn<Bool>  flag   (tab, "FLAG");
+  ArrayColumn<Float> weight (tab, "WEIGHT_SPECTRUM");
+  for (uInt i=0; i<nrow; i+=3) {
+    Matrix<Bool> flags (flagValue(i));
+    Matrix<Float> weights (weightValue(i));
+    for (uInt j=0; j<flags.nelements(); j+=3) {
+      flags.data()[j] = !flags.data()[j];
+      weights.data()[j] = j;
+    }
+    flag.put (i, flags);
+    weight.put (i, weights);
+  }
+  // Change part of the cells.
+  Slicer slicer (IPosition(2,0,20), IPosition(2,ncorr,4));
+  flag.putColumnRange (Slicer(IPosition(1,1), IPosition(1,10)), slicer,
+                       Cube<Bool>(ncorr, 4, 10, True));
+}
+
+void checkUpdate (const TSMOption& tsmOpt)
+{
+  Table tab (theTableName, TableLock(), Table::Old, tsmOpt);
+  ArrayColumn<Bool>  flag   (tab, "FLAG");
+  ArrayColumn<Float> weight (tab, "WEIGHT_SPECTRUM");
+  ArrayColumn<Complex> data (tab, "DATA");
+  Slicer slicer (IPosition(2,0,20), IPosition(2,ncorr,4));
+  for (uInt i=0; i<nrow; ++i) {
+    Matrix<Bool> flags (flagValue(i));
+    Matrix<Float> weights (weightValue(i));
+    if (i%3 == 0) {
+      for (uInt j=0; j<flags.nelements(); j+=3) {
+        flags.data()[j] = !flags.data()[j];
+        weights.data()[j] = j;
+      }
+    }
+    if (i >= 1  &&  i < 11) {
+      flags(slicer) = True;
+    }
+    AlwaysAssertExit (allEQ (flag.get(i), flags));
+    AlwaysAssertExit (allEQ (weight.get(i), weights));
+    AlwaysAssertExit (allEQ (data.get(i), dataValue(i)));
+  }
+}
+
+void appendRows()
+{
+  // The tiles moved by the update left free space in the file, which
+  // is reused for the (well compressible) tiles of the rows added.
+  Int64 flagSize, weightSize;
+  {
+    Table tab (theTableName);
+    flagSize   = fileSizes (tab, "TiledFlag");
+    weightSize = fileSizes (tab, "TiledWeight");
+  }
+  Matrix<Bool> flags (ncorr, nchan, True);
+  Matrix<Float> weights (ncorr, nchan, 1.);
+  {
+    Table tab (theTableName, Table::Update);
+    ArrayColumn<Bool>  flag   (tab, "FLAG");
+    ArrayColumn<Float> weight (tab, "WEIGHT_SPECTRUM");
+    for (uInt i=0; i<8; ++i) {
+      rownr_t row = tab.nrow();
+      tab.addRow();
+      flag.put   (row, flags);
+      weight.put (row, weights);
+    }
+  }
+  Table tab (theTableName);
+  AlwaysAssertExit (fileSizes (tab, "TiledFlag") == flagSize);
+  AlwaysAssertExit (fileSizes (tab, "TiledWeight") == weightSize);
+  ArrayColumn<Bool>  flag   (tab, "FLAG");
+  ArrayColumn<Float> weight (tab, "WEIGHT_SPECTRUM");
+  for (uInt i=0; i<8; ++i) {
+    AlwaysAssertExit (allEQ (flag.get(nrow+10+i), flags));
+    AlwaysAssertExit (allEQ (weight.get(nrow+10+i), weights));
+  }
+}
+
+void testFreeSpace()
+{
+  // Test the free space administration of TSMFile.
+  TSMFile file ("tTiledCompressStMan_tmp.file", True,
+                TSMOption(TSMOption::Cache));
+  AlwaysAssertExit (file.allocate (100) == 0);
+  AlwaysAssertExit (file.allocate (50) == 100);
+  AlwaysAssertExit (file.allocate (70) == 150);
+  AlwaysAssertExit (file.allocate (30) == 220);
+  AlwaysAssertExit (file.length() == 250);
+  // Released extents are merged and reused.
+  file.release (100, 50);
+  file.release (0, 100);
+  AlwaysAssertExit (file.freeLength() == 150);
+  AlwaysAssertExit (file.allocate (120) == 0);
+  AlwaysAssertExit (file.allocate (40) == 250);
+  AlwaysAssertExit (file.allocate (30) == 120);
+  AlwaysAssertExit (file.freeLength() == 0);
+  // Space released at the end is given back to the file.
+  file.release (250, 40);
+  file.release (150, 70);
+  AlwaysAssertExit (file.length() == 250  &&  file.freeLength() == 70);
+  file.release (220, 30);
+  AlwaysAssertExit (file.length() == 150  &&  file.freeLength() == 0);
+}
+
+void testCodec()
+{
+  // Test the codec on its own for all value sizes and some special cases.
+  std::vector<char> data(1000);
+  for (uInt i=0; i<data.size(); ++i) {
+    data[i] = (i < 300  ?  char(i%8) : (i < 700 ? 0 : char(i*i)));
+  }
+  for (uInt valueSize : {1, 2, 4, 8, 3, 7}) {
+    for (uInt length : {0, 1, 5, 16, 1000}) {
+      for (uInt distance : {1, 3, 1000}) {
+        std::vector<uChar> out(3, 1);
+        TSMCubeCompress::compress (data.data(), length, valueSize, distance,
+                                   out);
+        AlwaysAssertExit (out.size() <= 3 + length + 1);
+        std::vector<char> result(length + 1, 7);
+        const uChar* end = TSMCubeCompress::decompress
+          (out.data() + 3, out.data() + out.size(), result.data(), length,
+           valueSize);
+        AlwaysAssertExit (end == out.data() + out.size());
+        AlwaysAssertExit (memcmp (result.data(), data.data(), length) == 0);
+        AlwaysAssertExit (result[length] == 7);
+      }
+    }
+  }
+  // Truncated compressed data has to be detected.
+  std::vector<uChar> out;
+  TSMCubeCompress::compress (data.data(), 1000, 4, 1, out);
+  AlwaysAssertExit (out[0] == 1  &&  out.size() < 1000);
+  Bool caught = False;
+  try {
+    TSMCubeCompress::decompress (out.data(), out.data() + out.size() - 2,
+                                 data.data(), 1000, 4);
+  } catch (const DataManError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+}
+
+int main()
+{
+  try {
+    testCodec();
+    createTable();
+    checkTable (TSMOption(TSMOption::Cache));
+    checkTable (TSMOption(TSMOption::Buffer));
+    checkTable (TSMOption(TSMOption::MMap));
+    checkSize (False);
+    updateTable();
+    checkUpdate (TSMOption(TSMOption::Cache));
+    checkUpdate (TSMOption(TSMOption::MMap));
+    checkSize (True);
+    appendRows();
+    testFreeSpace();
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
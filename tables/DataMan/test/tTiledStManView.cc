@@ -0,0 +1,157 @@
+//# tTiledStManView.cc: Test program for views on memory-mapped tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for ROTiledStManAccessor::getColumnView.
+// It checks that views on memory-mapped tiles give the same data as
+// getColumnRange and that no view is made if not possible.
+// </summary>
+
+void makeTable (const String& name, Table::EndianFormat endian)
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Float>("Data", IPosition(2,4,6),
+                                       ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Complex>("Cplx", IPosition(2,4,6),
+                                         ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Bool>("Flag", IPosition(2,4,6),
+                                      ColumnDesc::FixedShape));
+  SetupNewTable newtab (name, td, Table::New);
+  TiledColumnStMan stman ("TSMView", IPosition(3,4,6,8));
+  newtab.bindAll (stman);
+  Table tab (newtab, 40, False, endian);
+  ArrayColumn<Float> data (tab, "Data");
+  ArrayColumn<Complex> cplx (tab, "Cplx");
+  ArrayColumn<Bool> flag (tab, "Flag");
+  Matrix<Float> arr (4, 6);
+  indgen (arr);
+  for (uInt i=0; i<tab.nrow(); ++i) {
+    data.put (i, arr);
+    cplx.put (i, makeComplex (arr, -arr));
+    flag.put (i, arr > Float(i));
+    arr += Float(24);
+  }
+}
+
+template<typename T>
+void checkView (const Table& tab, const String& colName,
+                const Slicer* cellSection, rownr_t startRow, rownr_t nrow)
+{
+  ROTiledStManAccessor acc (tab, "TSMView");
+  ArrayColumn<T> col (tab, colName);
+  Slicer rows (IPosition(1,startRow), IPosition(1,nrow));
+  TiledColumnView<T> view;
+  Array<T> expected;
+  if (cellSection) {
+    AlwaysAssertExit (acc.getColumnView (colName, *cellSection,
+                                         startRow, nrow, view));
+    expected = col.getColumnRange (rows, *cellSection);
+  } else {
+    AlwaysAssertExit (acc.getColumnView (colName, startRow, nrow, view));
+    expected = col.getColumnRange (rows);
+  }
+  AlwaysAssertExit (view.shape().isEqual (expected.shape()));
+  AlwaysAssertExit (allEQ (view.array(), expected));
+}
+
+void testView (const String& name)
+{
+  Table tab (name, Table::Update, TSMOption::MMap);
+  ROTiledStManAccessor acc (tab, "TSMView");
+  // Full cells in a tile (the last one is partially filled).
+  checkView<Float> (tab, "Data", 0, 8, 8);
+  checkView<Float> (tab, "Data", 0, 19, 3);
+  checkView<Float> (tab, "Data", 0, 32, 8);
+  checkView<Complex> (tab, "Cplx", 0, 16, 8);
+  // Strided sections.
+  Slicer section (IPosition(2,1,0), IPosition(2,3,5), IPosition(2,2,2),
+                  Slicer::endIsLast);
+  checkView<Float> (tab, "Data", &section, 17, 5);
+  checkView<Complex> (tab, "Cplx", &section, 0, 8);
+  // The view references the data, so it sees changes.
+  TiledColumnView<Float> view;
+  AlwaysAssertExit (acc.getColumnView ("Data", 8, 8, view));
+  ArrayColumn<Float> data (tab, "Data");
+  data.put (10, Matrix<Float>(4, 6, -1));
+  AlwaysAssertExit (allEQ (view.array()[2], Float(-1)));
+  AlwaysAssertExit (view(IPosition(3,1,2,2)) == Float(-1));
+  // No views for rows spanning tiles or for bit-packed Bools.
+  AlwaysAssertExit (! acc.getColumnView ("Data", 6, 4, view));
+  TiledColumnView<Bool> flags;
+  AlwaysAssertExit (! acc.getColumnView ("Flag", 8, 8, flags));
+  // The data type must match.
+  Bool caught = False;
+  try {
+    TiledColumnView<Double> dview;
+    acc.getColumnView ("Data", 8, 8, dview);
+  } catch (const DataManError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+}
+
+void testNoView (const String& name, TSMOption::Option option)
+{
+  Table tab (name, Table::Old, option);
+  ROTiledStManAccessor acc (tab, "TSMView");
+  TiledColumnView<Float> view;
+  AlwaysAssertExit (! acc.getColumnView ("Data", 8, 8, view));
+}
+
+int main()
+{
+  try {
+    makeTable ("tTiledStManView_tmp.local", Table::LocalEndian);
+    makeTable ("tTiledStManView_tmp.other",
+               HostInfo::bigEndian() ? Table::LittleEndian :
+                                       Table::BigEndian);
+    testView ("tTiledStManView_tmp.local");
+    // No view if not mapped or if the byte order differs.
+    testNoView ("tTiledStManView_tmp.local", TSMOption::Cache);
+    testNoView ("tTiledStManView_tmp.other", TSMOption::MMap);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -311,22 +311,8 @@ void AFTimeBlockEncoder::encode(
     fitToMaximum(data, metaBuffer, gausEncoder, antennaCount);
   }
 
-  symbol_t *symbolBufferPtr = symbolBuffer;
-  for (const DBufferRow &row : data) {
-    for (size_t i = 0; i != visPerRow; ++i) {
-      if (UseDithering) {
-        symbolBufferPtr[i * 2] = gausEncoder.EncodeWithDithering(
-            row.visibilities[i].real(), _ditherDist(*rnd));
-        symbolBufferPtr[i * 2 + 1] = gausEncoder.EncodeWithDithering(
-            row.visibilities[i].imag(), _ditherDist(*rnd));
-      } else {
-        symbolBufferPtr[i * 2] = gausEncoder.Encode(row.visibilities[i].real());
-        symbolBufferPtr[i * 2 + 1] =
-            gausEncoder.Encode(row.visibilities[i].imag());
-      }
-    }
-    symbolBufferPtr += visPerRow * 2;
-  }
+  encodeRows<UseDithering>(gausEncoder, data, visPerRow, symbolBuffer,
+                           _ditherDist, rnd);
 }
 
 template void AFTimeBlockEncoder::encode<true>(
@@ -424,17 +410,14 @@ void AFTimeBlockEncoder::Decode(
   row.antenna1 = antenna1;
   row.antenna2 = antenna2;
   row.visibilities.resize(_nChannels * _nPol);
-  std::complex<float> *destination = row.visibilities.data();
-  const symbol_t *srcRowPtr = symbolBuffer + blockRow * SymbolsPerRow();
+  _decodeFactors.resize(_nChannels * _nPol);
   for (size_t ch = 0; ch != _nChannels; ++ch) {
     for (size_t p = 0; p != _nPol; ++p) {
       double chRMS = _rmsPerChannel[ch * _nPol + p];
-      double factor = chRMS * antFactors[p];
-      destination->real(double(gausEncoder.Decode(*srcRowPtr)) * factor);
-      ++srcRowPtr;
-      destination->imag(double(gausEncoder.Decode(*srcRowPtr)) * factor);
-      ++srcRowPtr;
-      ++destination;
+      _decodeFactors[ch * _nPol + p] = chRMS * antFactors[p];
     }
   }
+  gausEncoder.Decode(symbolBuffer + blockRow * SymbolsPerRow(),
+                     _decodeFactors.data(), row.visibilities.data(),
+                     _nChannels * _nPol);
 }
@@ -29,7 +29,8 @@ DyscoStMan::DyscoStMan(unsigned dataBitCount, unsigned weightBitCount,
       _normalization(Normalization::kAF),
       _studentTNu(0.0),
       _distributionTruncation(2.5),
-      _staticSeed(false) {}
+      _staticSeed(false),
+      _pipelined(true) {}
 
 DyscoStMan::DyscoStMan(const casacore::String &name,
                        const casacore::Record &spec)
@@ -47,7 +48,8 @@ DyscoStMan::DyscoStMan(const casacore::String &name,
       _normalization(Normalization::kAF),
       _studentTNu(0.0),
       _distributionTruncation(0.0),
-      _staticSeed(false) {
+      _staticSeed(false),
+      _pipelined(true) {
   setFromSpec(spec);
 }
 
@@ -66,7 +68,8 @@ DyscoStMan::DyscoStMan(const DyscoStMan &source)
       _normalization(source._normalization),
       _studentTNu(source._studentTNu),
       _distributionTruncation(source._distributionTruncation),
-      _staticSeed(source._staticSeed) {}
+      _staticSeed(source._staticSeed),
+      _pipelined(source.IsPipelined()) {}
 
 void DyscoStMan::setFromSpec(const casacore::Record &spec) {
   // Here we need to load from _spec
@@ -106,6 +109,8 @@ void DyscoStMan::setFromSpec(const casacore::Record &spec) {
       _studentTNu = 0.0;
     _distributionTruncation = spec.asDouble("distributionTruncation");
   }
+  if (spec.description().fieldNumber("pipelined") >= 0)
+    _pipelined = spec.asBool("pipelined");
 }
 
 void DyscoStMan::makeEmpty() {
@@ -152,6 +157,7 @@ casacore::Record DyscoStMan::dataManagerSpec() const {
   spec.define("normalization", normStr);
   spec.define("studentTNu", _studentTNu);
   spec.define("distributionTruncation", _distributionTruncation);
+  spec.define("pipelined", IsPipelined());
   return spec;
 }
 
@@ -5,6 +5,7 @@
 
 #include <casacore/casa/Containers/Record.h>
 
+#include <atomic>
 #include <cstdint>
 #include <fstream>
 #include <memory>
@@ -124,6 +125,19 @@ class DyscoStMan : public casacore::DataManager {
 
   void SetStaticSeed(bool staticSeed) { _staticSeed = staticSeed; }
 
+  /**
+   * Enable or disable the pipelined mode, which is enabled by default.
+   * In this mode, the encoding threads hand the encoded time blocks to a
+   * separate writing thread instead of waiting for the disk themselves, and
+   * the next time block is decoded in the background while the current one is
+   * being read. The mode can be changed at any time; it does not change the
+   * stored data. It can also be set with the "pipelined" field in the spec.
+   */
+  void SetPipelined(bool pipelined) { _pipelined = pipelined; }
+
+  /** Whether the pipelined mode is enabled. */
+  bool IsPipelined() const { return _pipelined; }
+
   /**
    * This constructor is called by Casa when it needs to create a DyscoStMan.
    * Casa will call makeObject() that will call this constructor.
@@ -400,6 +414,7 @@ class DyscoStMan : public casacore::DataManager {
   Normalization _normalization;
   double _studentTNu, _distributionTruncation;
   bool _staticSeed;
+  std::atomic<bool> _pipelined;
 
   std::vector<std::unique_ptr<DyscoStManColumn>> _columns;
 };
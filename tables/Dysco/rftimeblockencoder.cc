@@ -87,22 +87,8 @@ void RFTimeBlockEncoder::encode(
 
   maximizeChannels(data, metaBuffer, gausEncoder);
 
-  symbol_t *symbolBufferPtr = symbolBuffer;
-  for (const DBufferRow &row : data) {
-    for (size_t i = 0; i != visPerRow; ++i) {
-      if (UseDithering) {
-        symbolBufferPtr[i * 2] = gausEncoder.EncodeWithDithering(
-            row.visibilities[i].real(), _ditherDist(*rnd));
-        symbolBufferPtr[i * 2 + 1] = gausEncoder.EncodeWithDithering(
-            row.visibilities[i].imag(), _ditherDist(*rnd));
-      } else {
-        symbolBufferPtr[i * 2] = gausEncoder.Encode(row.visibilities[i].real());
-        symbolBufferPtr[i * 2 + 1] =
-            gausEncoder.Encode(row.visibilities[i].imag());
-      }
-    }
-    symbolBufferPtr += visPerRow * 2;
-  }
+  encodeRows<UseDithering>(gausEncoder, data, visPerRow, symbolBuffer,
+                           _ditherDist, rnd);
 }
 
 void RFTimeBlockEncoder::InitializeDecode(const float *metaBuffer, size_t nRow,
@@ -121,16 +107,13 @@ void RFTimeBlockEncoder::Decode(
   row.antenna1 = antenna1;
   row.antenna2 = antenna2;
   row.visibilities.resize(_nChannels * _nPol);
-  std::complex<float> *destination = row.visibilities.data();
-  const symbol_t *srcRowPtr = symbolBuffer + blockRow * SymbolsPerRow();
   const size_t visPerRow = _nPol * _nChannels;
+  _decodeFactors.resize(visPerRow);
   for (size_t i = 0; i != visPerRow; ++i) {
     double chFactor = _channelFactors[i];
-    double factor = chFactor * _rowFactors[blockRow * _nPol + i % _nPol];
-    destination->real(double(gausEncoder.Decode(*srcRowPtr)) * factor);
-    ++srcRowPtr;
-    destination->imag(double(gausEncoder.Decode(*srcRowPtr)) * factor);
-    ++srcRowPtr;
-    ++destination;
+    _decodeFactors[i] = chFactor * _rowFactors[blockRow * _nPol + i % _nPol];
   }
+  gausEncoder.Decode(symbolBuffer + blockRow * SymbolsPerRow(),
+                     _decodeFactors.data(), row.visibilities.data(),
+                     visPerRow);
 }
@@ -22,17 +22,11 @@ void RowTimeBlockEncoder::Decode(const StochasticEncoder<float> &gausEncoder,
   row.antenna1 = antenna1;
   row.antenna2 = antenna2;
   row.visibilities.resize(_nChannels * _nPol);
-  std::complex<float> *destination = row.visibilities.data();
-  const symbol_t *srcRowPtr = symbolBuffer + blockRow * SymbolsPerRow();
   const size_t visPerRow = _nPol * _nChannels;
-  for (size_t i = 0; i != visPerRow; ++i) {
-    double factor = _rowFactors[blockRow];
-    destination->real(double(gausEncoder.Decode(*srcRowPtr)) * factor);
-    ++srcRowPtr;
-    destination->imag(double(gausEncoder.Decode(*srcRowPtr)) * factor);
-    ++srcRowPtr;
-    ++destination;
-  }
+  _decodeFactors.assign(visPerRow, _rowFactors[blockRow]);
+  gausEncoder.Decode(symbolBuffer + blockRow * SymbolsPerRow(),
+                     _decodeFactors.data(), row.visibilities.data(),
+                     visPerRow);
 }
 
 template <bool UseDithering>
@@ -60,20 +54,6 @@ void RowTimeBlockEncoder::encode(const StochasticEncoder<float> &gausEncoder,
     metaBuffer[rowIndex] = maxVal / maxLevel;
   }
 
-  symbol_t *symbolBufferPtr = symbolBuffer;
-  for (const DBufferRow &row : data) {
-    for (size_t i = 0; i != visPerRow; ++i) {
-      if (UseDithering) {
-        symbolBufferPtr[i * 2] = gausEncoder.EncodeWithDithering(
-            row.visibilities[i].real(), _ditherDist(*rnd));
-        symbolBufferPtr[i * 2 + 1] = gausEncoder.EncodeWithDithering(
-            row.visibilities[i].imag(), _ditherDist(*rnd));
-      } else {
-        symbolBufferPtr[i * 2] = gausEncoder.Encode(row.visibilities[i].real());
-        symbolBufferPtr[i * 2 + 1] =
-            gausEncoder.Encode(row.visibilities[i].imag());
-      }
-    }
-    symbolBufferPtr += visPerRow * 2;
-  }
+  encodeRows<UseDithering>(gausEncoder, data, visPerRow, symbolBuffer,
+                           _ditherDist, rnd);
 }
@@ -0,0 +1,488 @@
+#include "simdkernels.h"
+
+#include "bytepacker.h"
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DYSCO_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace dyscostman {
+
+namespace {
+
+std::atomic<int> selectedInstructionSet(-1);
+
+/**
+ * Branchless version of StochasticEncoder::Dictionary::lower_bound(). All
+ * vector kernels perform exactly these steps in each lane.
+ */
+inline size_t lowerBound(const float *dictionary, size_t size, float value) {
+  size_t base = 0;
+  for (size_t length = size; length > 1;) {
+    const size_t half = length / 2;
+    if (dictionary[base + half] <= value) base += half;
+    length -= half;
+  }
+  return (dictionary[base] < value) ? base + 1 : base;
+}
+
+void quantizeScalar(const float *dictionary, size_t size, const float *values,
+                    unsigned *symbols, size_t count) {
+  for (size_t i = 0; i != count; ++i) {
+    if (std::isfinite(values[i]))
+      symbols[i] = lowerBound(dictionary, size, values[i]);
+    else
+      symbols[i] = size;
+  }
+}
+
+void quantizeWithDitheringScalar(const float *dictionary, size_t size,
+                                 const float *values,
+                                 const unsigned *ditherValues,
+                                 unsigned *symbols, size_t count) {
+  for (size_t i = 0; i != count; ++i) {
+    const float value = values[i];
+    if (std::isfinite(value)) {
+      const size_t lb = lowerBound(dictionary, size, value);
+      if (lb == 0) {
+        symbols[i] = 0;
+      } else if (lb == size) {
+        symbols[i] = size - 1;
+      } else {
+        const float rightValue = dictionary[lb];
+        const float leftValue = dictionary[lb - 1];
+        const float ditherMark =
+            float(1u << 31) * (value - leftValue) / (rightValue - leftValue);
+        symbols[i] = (ditherMark > ditherValues[i]) ? lb : lb - 1;
+      }
+    } else {
+      symbols[i] = size;
+    }
+  }
+}
+
+void dequantizeScalar(const float *dictionary, const unsigned *symbols,
+                      const double *factors, std::complex<float> *values,
+                      size_t count) {
+  for (size_t i = 0; i != count; ++i) {
+    values[i].real(double(dictionary[symbols[i * 2]]) * factors[i]);
+    values[i].imag(double(dictionary[symbols[i * 2 + 1]]) * factors[i]);
+  }
+}
+
+#ifdef DYSCO_X86_KERNELS
+
+/**
+ * Gathers are slow on many CPUs, so the vector kernels search the dictionary
+ * in two steps. The values are first compared with every stride'th
+ * dictionary value (the pivots). These are broadcast, which needs no
+ * gathers. The stride values after the last pivot that is not larger than
+ * the value are then searched with gathers. Because the result of the
+ * search is the last index with a dictionary value not larger than the
+ * value, it is the same as for the one step search of lowerBound().
+ */
+struct Pivots {
+  enum { kMaxCount = 32 };
+
+  Pivots(const float *dictionary, size_t size) : stride(1), strideShift(0) {
+    while ((size + stride - 1) / stride > kMaxCount) {
+      stride *= 2;
+      ++strideShift;
+    }
+    count = (size + stride - 1) / stride;
+    for (size_t j = 0; j != count; ++j) values[j] = dictionary[j * stride];
+  }
+
+  size_t stride, strideShift, count;
+  float values[kMaxCount];
+};
+
+template <bool UseDithering>
+__attribute__((target("avx2"))) void quantizeAVX2(
+    const float *dictionary, size_t size, const float *values,
+    const unsigned *ditherValues, unsigned *symbols, size_t count) {
+  const Pivots pivots(dictionary, size);
+  const __m128i strideShift = _mm_cvtsi32_si128(pivots.strideShift);
+  const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256 infinity =
+      _mm256_set1_ps(std::numeric_limits<float>::infinity());
+  const __m256 ditherScale = _mm256_set1_ps(float(1u << 31));
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i sizeV = _mm256_set1_epi32(size);
+  const __m256i lastV = _mm256_set1_epi32(size - 1);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 value = _mm256_loadu_ps(values + i);
+    const __m256 isFinite =
+        _mm256_cmp_ps(_mm256_and_ps(value, absMask), infinity, _CMP_LT_OQ);
+    // Search with zero for non-finite values, these are replaced below
+    value = _mm256_and_ps(value, isFinite);
+    // Comparisons give -1 for true, so subtracting them counts
+    __m256i base = zero;
+    for (size_t j = 1; j < pivots.count; ++j) {
+      base = _mm256_sub_epi32(
+          base, _mm256_castps_si256(_mm256_cmp_ps(
+                    _mm256_broadcast_ss(&pivots.values[j]), value, _CMP_LE_OQ)));
+    }
+    base = _mm256_sll_epi32(base, strideShift);
+    for (size_t length = pivots.stride; length > 1;) {
+      const size_t half = length / 2;
+      const __m256i mid = _mm256_add_epi32(base, _mm256_set1_epi32(half));
+      // The last block can be shorter than the stride
+      const __m256 midValue =
+          _mm256_i32gather_ps(dictionary, _mm256_min_epi32(mid, lastV), 4);
+      const __m256i isLower = _mm256_and_si256(
+          _mm256_castps_si256(_mm256_cmp_ps(midValue, value, _CMP_LE_OQ)),
+          _mm256_cmpgt_epi32(sizeV, mid));
+      base = _mm256_blendv_epi8(base, mid, isLower);
+      length -= half;
+    }
+    const __m256 baseValue = _mm256_i32gather_ps(dictionary, base, 4);
+    const __m256i lb = _mm256_sub_epi32(
+        base,
+        _mm256_castps_si256(_mm256_cmp_ps(baseValue, value, _CMP_LT_OQ)));
+    __m256i symbol;
+    if (UseDithering) {
+      const __m256 rightValue =
+          _mm256_i32gather_ps(dictionary, _mm256_min_epi32(lb, lastV), 4);
+      const __m256 leftValue = _mm256_i32gather_ps(
+          dictionary, _mm256_max_epi32(_mm256_sub_epi32(lb, one), zero), 4);
+      const __m256 ditherMark = _mm256_div_ps(
+          _mm256_mul_ps(ditherScale, _mm256_sub_ps(value, leftValue)),
+          _mm256_sub_ps(rightValue, leftValue));
+      const __m256 ditherValue = _mm256_cvtepi32_ps(_mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(ditherValues + i)));
+      const __m256i isRight = _mm256_castps_si256(
+          _mm256_cmp_ps(ditherMark, ditherValue, _CMP_GT_OQ));
+      symbol = _mm256_sub_epi32(_mm256_sub_epi32(lb, one), isRight);
+      symbol = _mm256_blendv_epi8(symbol, zero, _mm256_cmpeq_epi32(lb, zero));
+      symbol = _mm256_blendv_epi8(symbol, lastV, _mm256_cmpeq_epi32(lb, sizeV));
+    } else {
+      symbol = lb;
+    }
+    symbol = _mm256_blendv_epi8(sizeV, symbol, _mm256_castps_si256(isFinite));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(symbols + i), symbol);
+  }
+  // Avoid the penalty of mixing AVX and SSE code in the scalar kernel
+  _mm256_zeroupper();
+  if (UseDithering)
+    quantizeWithDitheringScalar(dictionary, size, values + i, ditherValues + i,
+                                symbols + i, count - i);
+  else
+    quantizeScalar(dictionary, size, values + i, symbols + i, count - i);
+}
+
+template <bool UseDithering>
+__attribute__((target("avx512f"))) void quantizeAVX512(
+    const float *dictionary, size_t size, const float *values,
+    const unsigned *ditherValues, unsigned *symbols, size_t count) {
+  const Pivots pivots(dictionary, size);
+  const __m128i strideShift = _mm_cvtsi32_si128(pivots.strideShift);
+  const __m512 infinity =
+      _mm512_set1_ps(std::numeric_limits<float>::infinity());
+  const __m512 ditherScale = _mm512_set1_ps(float(1u << 31));
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i sizeV = _mm512_set1_epi32(size);
+  const __m512i lastV = _mm512_set1_epi32(size - 1);
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512 value = _mm512_loadu_ps(values + i);
+    const __mmask16 isFinite =
+        _mm512_cmp_ps_mask(_mm512_abs_ps(value), infinity, _CMP_LT_OQ);
+    value = _mm512_maskz_mov_ps(isFinite, value);
+    __m512i base = zero;
+    for (size_t j = 1; j < pivots.count; ++j) {
+      base = _mm512_mask_add_epi32(
+          base,
+          _mm512_cmp_ps_mask(_mm512_set1_ps(pivots.values[j]), value,
+                             _CMP_LE_OQ),
+          base, one);
+    }
+    base = _mm512_sll_epi32(base, strideShift);
+    for (size_t length = pivots.stride; length > 1;) {
+      const size_t half = length / 2;
+      const __m512i mid = _mm512_add_epi32(base, _mm512_set1_epi32(half));
+      const __mmask16 isInside = _mm512_cmplt_epi32_mask(mid, sizeV);
+      const __m512 midValue =
+          _mm512_mask_i32gather_ps(value, isInside, mid, dictionary, 4);
+      base = _mm512_mask_mov_epi32(
+          base, _mm512_mask_cmp_ps_mask(isInside, midValue, value, _CMP_LE_OQ),
+          mid);
+      length -= half;
+    }
+    const __m512 baseValue = _mm512_i32gather_ps(base, dictionary, 4);
+    const __m512i lb = _mm512_mask_add_epi32(
+        base, _mm512_cmp_ps_mask(baseValue, value, _CMP_LT_OQ), base, one);
+    __m512i symbol;
+    if (UseDithering) {
+      const __m512 rightValue =
+          _mm512_i32gather_ps(_mm512_min_epi32(lb, lastV), dictionary, 4);
+      const __m512 leftValue = _mm512_i32gather_ps(
+          _mm512_max_epi32(_mm512_sub_epi32(lb, one), zero), dictionary, 4);
+      const __m512 ditherMark = _mm512_div_ps(
+          _mm512_mul_ps(ditherScale, _mm512_sub_ps(value, leftValue)),
+          _mm512_sub_ps(rightValue, leftValue));
+      const __m512 ditherValue =
+          _mm512_cvtepi32_ps(_mm512_loadu_si512(ditherValues + i));
+      symbol = _mm512_mask_mov_epi32(
+          _mm512_sub_epi32(lb, one),
+          _mm512_cmp_ps_mask(ditherMark, ditherValue, _CMP_GT_OQ), lb);
+      symbol =
+          _mm512_mask_mov_epi32(symbol, _mm512_cmpeq_epi32_mask(lb, zero), zero);
+      symbol = _mm512_mask_mov_epi32(symbol, _mm512_cmpeq_epi32_mask(lb, sizeV),
+                                     lastV);
+    } else {
+      symbol = lb;
+    }
+    symbol = _mm512_mask_mov_epi32(sizeV, isFinite, symbol);
+    _mm512_storeu_si512(symbols + i, symbol);
+  }
+  _mm256_zeroupper();
+  if (UseDithering)
+    quantizeWithDitheringScalar(dictionary, size, values + i, ditherValues + i,
+                                symbols + i, count - i);
+  else
+    quantizeScalar(dictionary, size, values + i, symbols + i, count - i);
+}
+
+/**
+ * Dequantizes with a dictionary of at most 16 values (including the value
+ * for non-finite values at the end), which is kept in two registers. A
+ * lookup is then a permute, which is much faster than a gather.
+ */
+__attribute__((target("avx2"))) void dequantizeAVX2(
+    const float *dictionary, size_t size, const unsigned *symbols,
+    const double *factors, std::complex<float> *values, size_t count) {
+  alignas(32) float table[16] = {0};
+  for (size_t i = 0; i <= size; ++i) table[i] = dictionary[i];
+  const __m256 tableLow = _mm256_load_ps(table);
+  const __m256 tableHigh = _mm256_load_ps(table + 8);
+  const __m256i seven = _mm256_set1_epi32(7);
+  float *destination = reinterpret_cast<float *>(values);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256i symbol =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(symbols + i * 2));
+    const __m256 value = _mm256_blendv_ps(
+        _mm256_permutevar8x32_ps(tableLow, symbol),
+        _mm256_permutevar8x32_ps(tableHigh, symbol),
+        _mm256_castsi256_ps(_mm256_cmpgt_epi32(symbol, seven)));
+    const __m256d factor = _mm256_loadu_pd(factors + i);
+    // Factors 0 0 1 1 and 2 2 3 3 for the real and imaginary values
+    const __m256d factorLow = _mm256_permute4x64_pd(factor, 0x50);
+    const __m256d factorHigh = _mm256_permute4x64_pd(factor, 0xFA);
+    _mm_storeu_ps(destination + i * 2,
+                  _mm256_cvtpd_ps(_mm256_mul_pd(
+                      _mm256_cvtps_pd(_mm256_castps256_ps128(value)),
+                      factorLow)));
+    _mm_storeu_ps(destination + i * 2 + 4,
+                  _mm256_cvtpd_ps(_mm256_mul_pd(
+                      _mm256_cvtps_pd(_mm256_extractf128_ps(value, 1)),
+                      factorHigh)));
+  }
+  _mm256_zeroupper();
+  dequantizeScalar(dictionary, symbols + i * 2, factors + i, values + i,
+                   count - i);
+}
+
+/** As dequantizeAVX2(), with the dictionary in one register. */
+__attribute__((target("avx512f"))) void dequantizeAVX512(
+    const float *dictionary, size_t size, const unsigned *symbols,
+    const double *factors, std::complex<float> *values, size_t count) {
+  const __m512 table =
+      _mm512_maskz_loadu_ps(__mmask16((1u << (size + 1)) - 1), dictionary);
+  const __m512i lowIndices = _mm512_set_epi64(3, 3, 2, 2, 1, 1, 0, 0);
+  const __m512i highIndices = _mm512_set_epi64(7, 7, 6, 6, 5, 5, 4, 4);
+  float *destination = reinterpret_cast<float *>(values);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m512 value =
+        _mm512_permutexvar_ps(_mm512_loadu_si512(symbols + i * 2), table);
+    const __m512d factor = _mm512_loadu_pd(factors + i);
+    const __m256 valueHigh = _mm256_castsi256_ps(
+        _mm512_extracti64x4_epi64(_mm512_castps_si512(value), 1));
+    _mm256_storeu_ps(destination + i * 2,
+                     _mm512_cvtpd_ps(_mm512_mul_pd(
+                         _mm512_cvtps_pd(_mm512_castps512_ps256(value)),
+                         _mm512_permutexvar_pd(lowIndices, factor))));
+    _mm256_storeu_ps(destination + i * 2 + 8,
+                     _mm512_cvtpd_ps(_mm512_mul_pd(
+                         _mm512_cvtps_pd(valueHigh),
+                         _mm512_permutexvar_pd(highIndices, factor))));
+  }
+  _mm256_zeroupper();
+  dequantizeScalar(dictionary, symbols + i * 2, factors + i, values + i,
+                   count - i);
+}
+
+/**
+ * Unpacks groups of 8 symbols, which occupy bitCount bytes. The group is
+ * broadcast into both 128-bit lanes, after which a byte shuffle places the
+ * four bytes that contain symbol k in 32-bit element k. A variable shift and
+ * a mask then give the symbols. This requires that the last symbol of a
+ * group starts within the first 13 bytes, which holds up to 12 bits.
+ */
+__attribute__((target("avx2"))) void unpackAVX2(unsigned bitCount,
+                                                unsigned *symbolBuffer,
+                                                unsigned char *packedBuffer,
+                                                size_t symbolCount) {
+  alignas(32) char shuffle[32];
+  alignas(32) unsigned shifts[8];
+  for (unsigned k = 0; k != 8; ++k) {
+    const unsigned offset = (k * bitCount) / 8;
+    for (unsigned b = 0; b != 4; ++b) shuffle[k * 4 + b] = offset + b;
+    shifts[k] = (k * bitCount) % 8;
+  }
+  const __m256i shuffleV =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(shuffle));
+  const __m256i shiftV =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(shifts));
+  const __m256i mask = _mm256_set1_epi32((1u << bitCount) - 1);
+  const size_t packedSize = BytePacker::bufferSize(symbolCount, bitCount);
+  size_t group = 0;
+  // Each group reads 16 bytes, which should not go past the buffer
+  while ((group + 1) * 8 <= symbolCount &&
+         group * bitCount + 16 <= packedSize) {
+    const __m256i bytes = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(packedBuffer + group * bitCount)));
+    const __m256i result = _mm256_and_si256(
+        _mm256_srlv_epi32(_mm256_shuffle_epi8(bytes, shuffleV), shiftV), mask);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(symbolBuffer + group * 8),
+                        result);
+    ++group;
+  }
+  BytePacker::unpack(bitCount, symbolBuffer + group * 8,
+                     packedBuffer + group * bitCount,
+                     symbolCount - group * 8);
+}
+
+#endif
+
+SimdKernels::InstructionSet detectInstructionSet() {
+#ifdef DYSCO_X86_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return SimdKernels::kAVX512;
+  if (__builtin_cpu_supports("avx2")) return SimdKernels::kAVX2;
+#endif
+  return SimdKernels::kScalar;
+}
+
+}  // namespace
+
+SimdKernels::InstructionSet SimdKernels::Supported() {
+  static const InstructionSet supported = detectInstructionSet();
+  return supported;
+}
+
+SimdKernels::InstructionSet SimdKernels::Selected() {
+  const int selected = selectedInstructionSet.load(std::memory_order_relaxed);
+  return selected < 0 ? Supported() : InstructionSet(selected);
+}
+
+void SimdKernels::Select(InstructionSet instructionSet) {
+  if (instructionSet > Supported()) instructionSet = Supported();
+  selectedInstructionSet.store(instructionSet, std::memory_order_relaxed);
+}
+
+const char *SimdKernels::Name(InstructionSet instructionSet) {
+  switch (instructionSet) {
+    case kAVX2:
+      return "AVX2";
+    case kAVX512:
+      return "AVX-512";
+    default:
+      return "scalar";
+  }
+}
+
+void SimdKernels::Quantize(const float *dictionary, size_t dictionarySize,
+                           const float *values, unsigned *symbols,
+                           size_t count) {
+  switch (Selected()) {
+#ifdef DYSCO_X86_KERNELS
+    case kAVX512:
+      quantizeAVX512<false>(dictionary, dictionarySize, values, nullptr,
+                            symbols, count);
+      break;
+    case kAVX2:
+      quantizeAVX2<false>(dictionary, dictionarySize, values, nullptr, symbols,
+                          count);
+      break;
+#endif
+    default:
+      quantizeScalar(dictionary, dictionarySize, values, symbols, count);
+      break;
+  }
+}
+
+void SimdKernels::QuantizeWithDithering(const float *dictionary,
+                                        size_t dictionarySize,
+                                        const float *values,
+                                        const unsigned *ditherValues,
+                                        unsigned *symbols, size_t count) {
+  switch (Selected()) {
+#ifdef DYSCO_X86_KERNELS
+    case kAVX512:
+      quantizeAVX512<true>(dictionary, dictionarySize, values, ditherValues,
+                           symbols, count);
+      break;
+    case kAVX2:
+      quantizeAVX2<true>(dictionary, dictionarySize, values, ditherValues,
+                         symbols, count);
+      break;
+#endif
+    default:
+      quantizeWithDitheringScalar(dictionary, dictionarySize, values,
+                                  ditherValues, symbols, count);
+      break;
+  }
+}
+
+void SimdKernels::Dequantize(const float *dictionary, size_t dictionarySize,
+                             const unsigned *symbols, const double *factors,
+                             std::complex<float> *values, size_t count) {
+#ifdef DYSCO_X86_KERNELS
+  // Larger dictionaries would need gathers, which are not faster than the
+  // scalar lookups.
+  if (dictionarySize < 16) {
+    switch (Selected()) {
+      case kAVX512:
+        dequantizeAVX512(dictionary, dictionarySize, symbols, factors, values,
+                         count);
+        return;
+      case kAVX2:
+        dequantizeAVX2(dictionary, dictionarySize, symbols, factors, values,
+                       count);
+        return;
+      default:
+        break;
+    }
+  }
+#endif
+  dequantizeScalar(dictionary, symbols, factors, values, count);
+}
+
+void SimdKernels::Unpack(unsigned bitCount, unsigned *symbolBuffer,
+                         unsigned char *packedBuffer, size_t symbolCount) {
+#ifdef DYSCO_X86_KERNELS
+  // The 8 and 16 bit unpackers are plain conversions that the compiler
+  // vectorizes itself. AVX-512 has no byte shuffle without the BW extension,
+  // so it uses the AVX2 kernel as well.
+  const bool isShuffled = bitCount == 2 || bitCount == 3 || bitCount == 4 ||
+                          bitCount == 6 || bitCount == 10 || bitCount == 12;
+  if (isShuffled && Selected() != kScalar) {
+    unpackAVX2(bitCount, symbolBuffer, packedBuffer, symbolCount);
+    return;
+  }
+#endif
+  BytePacker::unpack(bitCount, symbolBuffer, packedBuffer, symbolCount);
+}
+
+}  // namespace dyscostman
@@ -0,0 +1,90 @@
+#ifndef DYSCO_SIMD_KERNELS_H
+#define DYSCO_SIMD_KERNELS_H
+
+#include <complex>
+#include <cstddef>
+
+namespace dyscostman {
+
+/**
+ * Vectorized implementations of the inner loops of the encoder and decoder.
+ *
+ * The kernels quantize arrays of values (with or without dithering),
+ * dequantize arrays of symbols into scaled complex values and unpack
+ * bit-packed symbols. Each kernel has a scalar implementation and, when
+ * compiled with GCC or Clang for x86, an AVX2 and an AVX-512
+ * implementation. The implementation is chosen at runtime from the
+ * instruction sets supported by the CPU, so that also a portable build
+ * (see the PORTABLE CMake option) uses the vector units.
+ *
+ * All implementations give results that are bit-identical to the
+ * value-by-value methods of StochasticEncoder and BytePacker. This is
+ * required, because a measurement set written on one machine has to
+ * decode to the same values on every other machine.
+ */
+class SimdKernels {
+ public:
+  enum InstructionSet { kScalar, kAVX2, kAVX512 };
+
+  /**
+   * The best instruction set that is supported by both the CPU and the
+   * compiler.
+   */
+  static InstructionSet Supported();
+
+  /**
+   * The instruction set that the kernels currently use. This is
+   * Supported(), unless changed with Select().
+   */
+  static InstructionSet Selected();
+
+  /**
+   * Select the instruction set used by the kernels. A set that is not
+   * supported falls back to the best supported one below it. This is
+   * mainly useful for testing and benchmarking.
+   */
+  static void Select(InstructionSet instructionSet);
+
+  /** Name of the instruction set, e.g. "AVX2". */
+  static const char *Name(InstructionSet instructionSet);
+
+  /**
+   * Quantize @p count values without dithering. The resulting symbol is
+   * the index of the first dictionary value that is not less than the
+   * value, or @p dictionarySize for non-finite values.
+   * @param dictionary sorted array of @p dictionarySize values
+   */
+  static void Quantize(const float *dictionary, size_t dictionarySize,
+                       const float *values, unsigned *symbols, size_t count);
+
+  /**
+   * Quantize @p count values with dithering, using one dither value in the
+   * range [0, 2^31) per value. See StochasticEncoder::EncodeWithDithering().
+   */
+  static void QuantizeWithDithering(const float *dictionary,
+                                    size_t dictionarySize, const float *values,
+                                    const unsigned *ditherValues,
+                                    unsigned *symbols, size_t count);
+
+  /**
+   * Dequantize @p count complex values from 2 * @p count symbols. The real
+   * and imaginary value of complex value i are looked up in the dictionary
+   * and multiplied with @p factors[i] in double precision.
+   * @param dictionary array of @p dictionarySize + 1 values, of which the
+   * last one is used for the symbol of non-finite values.
+   */
+  static void Dequantize(const float *dictionary, size_t dictionarySize,
+                         const unsigned *symbols, const double *factors,
+                         std::complex<float> *values, size_t count);
+
+  /**
+   * Unpack @p symbolCount symbols. This gives the same result as
+   * BytePacker::unpack().
+   */
+  static void Unpack(unsigned bitCount, unsigned *symbolBuffer,
+                     unsigned char *packedBuffer, size_t symbolCount);
+};
+
+}  // namespace dyscostman
+
+#endif
@@ -1,10 +1,12 @@
 #ifndef DYSCO_STOCHASTIC_ENCODER_H
 #define DYSCO_STOCHASTIC_ENCODER_H
 
+#include "simdkernels.h"
 #include "uvector.h"
 
 #include <algorithm>
 #include <cmath>
+#include <complex>
 #include <cstring>
 
 namespace dyscostman {
@@ -122,6 +124,36 @@ class StochasticEncoder {
     }
   }
 
+  /**
+   * Encode an array of values. The result is the same as calling
+   * Encode(ValueType) for each value, but uses the vectorized kernels
+   * of SimdKernels.
+   * @param values Floating point values to be encoded.
+   * @param symbols Output array of @p count symbols.
+   * @param count Number of values.
+   */
+  void Encode(const ValueType *values, symbol_t *symbols, size_t count) const {
+    SimdKernels::Quantize(_encDictionary.begin(), _encDictionary.size(),
+                          values, symbols, count);
+  }
+
+  /**
+   * Encode an array of values with dithering. The result is the same as
+   * calling EncodeWithDithering(ValueType, unsigned) for each value, but
+   * uses the vectorized kernels of SimdKernels.
+   * @param values Floating point values to be encoded.
+   * @param ditherValues One dithering value for each value.
+   * @param symbols Output array of @p count symbols.
+   * @param count Number of values.
+   */
+  void EncodeWithDithering(const ValueType *values,
+                           const unsigned *ditherValues, symbol_t *symbols,
+                           size_t count) const {
+    SimdKernels::QuantizeWithDithering(_decDictionary.begin(),
+                                       _decDictionary.size(), values,
+                                       ditherValues, symbols, count);
+  }
+
   /**
    * Will return the right boundary of the given symbol.
    * The right boundary is the smallest value that would not be
@@ -144,6 +176,21 @@ class StochasticEncoder {
     return _decDictionary.value(symbol);
   }
 
+  /**
+   * Decode an array of complex values. The real and imaginary value of
+   * complex value i are decoded from symbols 2i and 2i+1 and multiplied
+   * with @p factors[i] in double precision.
+   * @param symbols Array of 2 * @p count symbols.
+   * @param factors Array of @p count scale factors.
+   * @param values Output array of @p count complex values.
+   * @param count Number of complex values.
+   */
+  void Decode(const symbol_t *symbols, const double *factors,
+              std::complex<ValueType> *values, size_t count) const {
+    SimdKernels::Dequantize(_decDictionary.begin(), _decDictionary.size(),
+                            symbols, factors, values, count);
+  }
+
   size_t QuantizationCount() const { return _decDictionary.size() + 1; }
 
   ValueType MaxQuantity() const { return _decDictionary.largest_value(); }
@@ -0,0 +1,105 @@
+#include "../bytepacker.h"
+#include "../simdkernels.h"
+#include "../stochasticencoder.h"
+#include "../uvector.h"
+
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+/**
+ * Micro-benchmark of the encoder and decoder kernels. For each kernel the
+ * throughput of the value-by-value methods of StochasticEncoder and
+ * BytePacker is reported, followed by the throughput of the SimdKernels for
+ * each supported instruction set. Throughputs are given in GB/s of unpacked
+ * data, i.e. 4 bytes per value or symbol.
+ *
+ * Usage: benchmarksimdkernels [bits per symbol] [megavalues]
+ */
+
+using namespace dyscostman;
+
+namespace {
+
+template <typename Function>
+void report(const std::string &name, const std::string &method, size_t count,
+            Function function) {
+  // Run once to warm up the caches
+  function();
+  const size_t repeats = 5;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i != repeats; ++i) function();
+  const std::chrono::duration<double> seconds =
+      std::chrono::steady_clock::now() - start;
+  const double gbPerSecond =
+      double(count) * sizeof(float) * repeats / seconds.count() * 1e-9;
+  std::cout << std::left << std::setw(24) << name << std::setw(12) << method
+            << std::right << std::fixed << std::setprecision(3)
+            << std::setw(10) << gbPerSecond << " GB/s\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const unsigned bits = argc > 1 ? std::atoi(argv[1]) : 8;
+  const size_t count = (argc > 2 ? std::atoi(argv[2]) : 16) * 1000000;
+  std::cout << "Benchmarking " << count << " values with " << bits
+            << " bits per symbol\n";
+
+  StochasticEncoder<float> encoder(1u << bits, 1.0);
+  std::mt19937 rnd;
+  std::normal_distribution<float> gaus(0.0, 1.0);
+  std::uniform_int_distribution<unsigned> ditherDist =
+      StochasticEncoder<float>::GetDitherDistribution();
+  ao::uvector<float> values(count);
+  ao::uvector<unsigned> ditherValues(count), symbols(count);
+  for (float &v : values) v = gaus(rnd);
+  for (unsigned &d : ditherValues) d = ditherDist(rnd);
+  ao::uvector<double> factors(count / 2, 1.5);
+  ao::uvector<std::complex<float>> decoded(count / 2);
+  ao::uvector<unsigned char> packed(BytePacker::bufferSize(count, bits));
+  encoder.Encode(values.data(), symbols.data(), count);
+  BytePacker::pack(bits, packed.data(), symbols.data(), count);
+
+  report("encode", "per value", count, [&]() {
+    for (size_t i = 0; i != count; ++i) symbols[i] = encoder.Encode(values[i]);
+  });
+  report("encode dithered", "per value", count, [&]() {
+    for (size_t i = 0; i != count; ++i)
+      symbols[i] = encoder.EncodeWithDithering(values[i], ditherValues[i]);
+  });
+  report("decode", "per value", count, [&]() {
+    for (size_t i = 0; i != count / 2; ++i) {
+      decoded[i].real(double(encoder.Decode(symbols[i * 2])) * factors[i]);
+      decoded[i].imag(double(encoder.Decode(symbols[i * 2 + 1])) * factors[i]);
+    }
+  });
+  report("unpack", "BytePacker", count, [&]() {
+    BytePacker::unpack(bits, symbols.data(), packed.data(), count);
+  });
+
+  for (int set = SimdKernels::kScalar; set <= SimdKernels::Supported();
+       ++set) {
+    SimdKernels::Select(SimdKernels::InstructionSet(set));
+    const std::string method = SimdKernels::Name(SimdKernels::Selected());
+    report("encode", method, count, [&]() {
+      encoder.Encode(values.data(), symbols.data(), count);
+    });
+    report("encode dithered", method, count, [&]() {
+      encoder.EncodeWithDithering(values.data(), ditherValues.data(),
+                                  symbols.data(), count);
+    });
+    report("decode", method, count, [&]() {
+      encoder.Decode(symbols.data(), factors.data(), decoded.data(),
+                     count / 2);
+    });
+    report("unpack", method, count, [&]() {
+      SimdKernels::Unpack(bits, symbols.data(), packed.data(), count);
+    });
+  }
+  return 0;
+}
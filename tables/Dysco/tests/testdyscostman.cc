@@ -27,7 +27,8 @@ casacore::Record GetDyscoSpec() {
 }
 
 struct TestTableFixture {
-  explicit TestTableFixture(size_t nAnt) {
+  explicit TestTableFixture(size_t nAnt, size_t nTimes = 2,
+                            bool pipelined = true) {
     casacore::TableDesc tableDesc;
     IPosition shape(2, 1, 1);
     casacore::ArrayColumnDesc<casacore::Complex> columnDesc(
@@ -48,14 +49,16 @@ struct TestTableFixture {
 
     register_dyscostman();
     DataManagerCtor dyscoConstructor = DataManager::getCtor("DyscoStMan");
+    casacore::Record dyscoSpec = GetDyscoSpec();
+    dyscoSpec.define("pipelined", pipelined);
     std::unique_ptr<DataManager> dysco(
-        dyscoConstructor("DATA_dm", GetDyscoSpec()));
+        dyscoConstructor("DATA_dm", dyscoSpec));
     setupNewTable.bindColumn("DATA", *dysco);
     casacore::Table newTable(setupNewTable);
 
     size_t a1 = 0, a2 = 1;
     double time = 10.0;
-    const size_t nRow = 2 * nAnt * (nAnt - 1) / 2;
+    const size_t nRow = nTimes * nAnt * (nAnt - 1) / 2;
     newTable.addRow(nRow);
     casacore::ScalarColumn<int> a1Col(newTable, "ANTENNA1"),
         a2Col(newTable, "ANTENNA2"), fieldCol(newTable, "FIELD_ID"),
@@ -94,6 +97,9 @@ BOOST_AUTO_TEST_CASE(spec) {
   Record spec = dysco.dataManagerSpec();
   BOOST_CHECK_EQUAL(spec.asInt("dataBitCount"), 8);
   BOOST_CHECK_EQUAL(spec.asInt("weightBitCount"), 12);
+  BOOST_CHECK(spec.asBool("pipelined"));
+  dysco.SetPipelined(false);
+  BOOST_CHECK(!dysco.dataManagerSpec().asBool("pipelined"));
 }
 
 BOOST_AUTO_TEST_CASE(name) {
@@ -142,6 +148,30 @@ BOOST_AUTO_TEST_CASE(maketable) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(pipelined) {
+  for (bool writePipelined : {false, true}) {
+    TestTableFixture fixture(5, 20, writePipelined);
+    casacore::Table table("TestTable");
+    casacore::ArrayColumn<casacore::Complex> dataCol(table, "DATA");
+    DyscoStMan &dysco =
+        dynamic_cast<DyscoStMan &>(*table.findDataManager("DATA", true));
+    dysco.SetPipelined(false);
+    std::vector<casacore::Complex> reference(table.nrow());
+    for (size_t i = 0; i != table.nrow(); ++i) {
+      reference[i] = *dataCol(i).cbegin();
+      BOOST_CHECK_SMALL(reference[i].real() - float(i), 0.01f * (i + 1));
+    }
+    // Reading backwards does not use the decoded next block.
+    dysco.SetPipelined(true);
+    for (size_t i = 0; i != table.nrow(); ++i) {
+      BOOST_CHECK_EQUAL(*dataCol(i).cbegin(), reference[i]);
+    }
+    for (size_t i = table.nrow(); i != 0; --i) {
+      BOOST_CHECK_EQUAL(*dataCol(i - 1).cbegin(), reference[i - 1]);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(read_past_end) {
   /**
    * While reading past the end of a file might seem wrong in any case, it can
@@ -0,0 +1,156 @@
+#include "../bytepacker.h"
+#include "../simdkernels.h"
+#include "../stochasticencoder.h"
+#include "../uvector.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <limits>
+#include <random>
+
+using namespace dyscostman;
+
+BOOST_AUTO_TEST_SUITE(simd_kernels)
+
+namespace {
+
+std::vector<SimdKernels::InstructionSet> instructionSets() {
+  std::vector<SimdKernels::InstructionSet> sets;
+  for (int set = SimdKernels::kScalar; set <= SimdKernels::Supported(); ++set)
+    sets.push_back(SimdKernels::InstructionSet(set));
+  return sets;
+}
+
+ao::uvector<float> testValues(const StochasticEncoder<float>& encoder,
+                              std::mt19937& rnd) {
+  std::normal_distribution<float> gaus(0.0, 2.0);
+  ao::uvector<float> values;
+  for (size_t i = 0; i != 1003; ++i) values.push_back(gaus(rnd));
+  // Values on and around the dictionary values and boundaries
+  for (size_t s = 0; s < encoder.QuantizationCount() - 1; s += 3) {
+    values.push_back(encoder.Decode(s));
+    values.push_back(std::nextafter(encoder.Decode(s), 0.0f));
+    values.push_back(encoder.RightBoundary(s));
+  }
+  values.push_back(std::numeric_limits<float>::quiet_NaN());
+  values.push_back(std::numeric_limits<float>::infinity());
+  values.push_back(-std::numeric_limits<float>::infinity());
+  values.push_back(std::numeric_limits<float>::max());
+  values.push_back(-std::numeric_limits<float>::max());
+  values.push_back(0.0);
+  values.push_back(-0.0);
+  return values;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(quantize) {
+  std::mt19937 rnd;
+  std::uniform_int_distribution<unsigned> ditherDist =
+      StochasticEncoder<float>::GetDitherDistribution();
+  for (unsigned bits : {2, 3, 4, 8, 12}) {
+    StochasticEncoder<float> encoder(1u << bits, 1.0);
+    const ao::uvector<float> values = testValues(encoder, rnd);
+    ao::uvector<unsigned> ditherValues(values.size());
+    for (unsigned& d : ditherValues) d = ditherDist(rnd);
+    for (SimdKernels::InstructionSet set : instructionSets()) {
+      SimdKernels::Select(set);
+      BOOST_CHECK_EQUAL(SimdKernels::Selected(), set);
+      // Also test the tails that are handled by the scalar kernel
+      for (size_t count : {values.size(), size_t(7), size_t(21)}) {
+        ao::uvector<unsigned> symbols(count), ditheredSymbols(count);
+        encoder.Encode(values.data(), symbols.data(), count);
+        encoder.EncodeWithDithering(values.data(), ditherValues.data(),
+                                    ditheredSymbols.data(), count);
+        for (size_t i = 0; i != count; ++i) {
+          BOOST_REQUIRE_MESSAGE(
+              symbols[i] == encoder.Encode(values[i]),
+              SimdKernels::Name(set) << " encoding of " << values[i]
+                                     << " with " << bits << " bits");
+          BOOST_REQUIRE_MESSAGE(
+              ditheredSymbols[i] ==
+                  encoder.EncodeWithDithering(values[i], ditherValues[i]),
+              SimdKernels::Name(set) << " dithered encoding of " << values[i]
+                                     << " with " << bits << " bits");
+        }
+      }
+    }
+  }
+  SimdKernels::Select(SimdKernels::Supported());
+}
+
+BOOST_AUTO_TEST_CASE(dequantize) {
+  std::mt19937 rnd;
+  std::uniform_real_distribution<double> factorDist(0.0, 1000.0);
+  // Small dictionaries are kept in registers, large ones are not
+  for (unsigned bits : {2, 4, 8}) {
+    StochasticEncoder<float> encoder(1u << bits, 1.0);
+    // Includes the symbol for non-finite values
+    std::uniform_int_distribution<unsigned> symbolDist(
+        0, encoder.QuantizationCount() - 1);
+    const size_t count = 515;
+    ao::uvector<unsigned> symbols(count * 2);
+    for (unsigned& s : symbols) s = symbolDist(rnd);
+    ao::uvector<double> factors(count);
+    for (double& f : factors) f = factorDist(rnd);
+    factors[3] = 0.0;
+    for (SimdKernels::InstructionSet set : instructionSets()) {
+      SimdKernels::Select(set);
+      for (size_t n : {count, size_t(3), size_t(13)}) {
+        ao::uvector<std::complex<float>> values(n);
+        encoder.Decode(symbols.data(), factors.data(), values.data(), n);
+        for (size_t i = 0; i != n; ++i) {
+          const std::complex<float> expected(
+              double(encoder.Decode(symbols[i * 2])) * factors[i],
+              double(encoder.Decode(symbols[i * 2 + 1])) * factors[i]);
+          // Compare the bits, because NaNs are not equal
+          BOOST_REQUIRE_MESSAGE(
+              std::memcmp(&values[i], &expected, sizeof(expected)) == 0,
+              SimdKernels::Name(set) << " decoding of " << i << " with "
+                                     << bits << " bits");
+        }
+      }
+    }
+  }
+  SimdKernels::Select(SimdKernels::Supported());
+}
+
+BOOST_AUTO_TEST_CASE(unpack) {
+  std::mt19937 rnd;
+  for (unsigned bits : {2, 3, 4, 6, 8, 10, 12, 16}) {
+    std::uniform_int_distribution<unsigned> symbolDist(0, (1u << bits) - 1);
+    for (size_t count = 0; count < 300; count += (count < 50 ? 1 : 37)) {
+      ao::uvector<unsigned> symbols(count);
+      for (unsigned& s : symbols) s = symbolDist(rnd);
+      ao::uvector<unsigned char> packed(BytePacker::bufferSize(count, bits));
+      BytePacker::pack(bits, packed.data(), symbols.data(), count);
+      for (SimdKernels::InstructionSet set : instructionSets()) {
+        SimdKernels::Select(set);
+        // The last value checks that nothing is written past the end
+        ao::uvector<unsigned> unpacked(count + 1, 37);
+        SimdKernels::Unpack(bits, unpacked.data(), packed.data(), count);
+        for (size_t i = 0; i != count; ++i) {
+          BOOST_REQUIRE_MESSAGE(unpacked[i] == symbols[i],
+                                SimdKernels::Name(set)
+                                    << " unpacking of symbol " << i << " of "
+                                    << count << " with " << bits << " bits");
+        }
+        BOOST_CHECK_EQUAL(unpacked[count], 37u);
+      }
+    }
+  }
+  SimdKernels::Select(SimdKernels::Supported());
+}
+
+BOOST_AUTO_TEST_CASE(select) {
+  SimdKernels::Select(SimdKernels::kAVX512);
+  BOOST_CHECK_EQUAL(SimdKernels::Selected(), SimdKernels::Supported());
+  SimdKernels::Select(SimdKernels::kScalar);
+  BOOST_CHECK_EQUAL(SimdKernels::Selected(), SimdKernels::kScalar);
+  BOOST_CHECK_EQUAL(std::string(SimdKernels::Name(SimdKernels::kScalar)),
+                    "scalar");
+  SimdKernels::Select(SimdKernels::Supported());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
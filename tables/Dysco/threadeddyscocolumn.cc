@@ -4,6 +4,7 @@
 #include "dyscostmanerror.h"
 
 #include "bytepacker.h"
+#include "simdkernels.h"
 #include "threadgroup.h"
 
 #include <casacore/ms/MeasurementSets/MeasurementSet.h>
@@ -29,7 +30,10 @@ ThreadedDyscoColumn<DataType>::ThreadedDyscoColumn(DyscoStMan *parent,
       _isCurrentBlockChanged(false),
       _blockSize(0),
       _antennaCount(0),
-      _timeBlockBuffer() {}
+      _timeBlockBuffer(),
+      _readAheadState(ReadAheadState::kIdle),
+      _readAheadBlock(0),
+      _readAheadBuffer() {}
 
 // prepare the class for destruction when the derived class is destructed.
 // this is necessary because the virtual function of the derived class might get
@@ -66,6 +70,8 @@ void ThreadedDyscoColumn<DataType>::stopThreads() {
     // Wait for threads to end
     lock.unlock();
     _threadGroup.join_all();
+    _readAheadState = ReadAheadState::kIdle;
+    _freeWriteBuffers.clear();
   }
 }
 
@@ -77,32 +83,86 @@ void ThreadedDyscoColumn<DataType>::setShapeColumn(
 
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::loadBlock(size_t blockIndex) {
-  if (blockIndex < nBlocksInFile()) {
-    readCompressedData(blockIndex, _packedBlockReadBuffer.data(), _blockSize);
-    const size_t nPolarizations = _shape[0], nChannels = _shape[1],
-                 nRows = nRowsInBlock(),
-                 nMetaFloats = metaDataFloatCount(nRows, nPolarizations,
-                                                  nChannels, _antennaCount);
-    unsigned char *symbolStart =
-        _packedBlockReadBuffer.data() + nMetaFloats * sizeof(float);
-    BytePacker::unpack(_bitsPerSymbol, _unpackedSymbolReadBuffer.data(),
-                       symbolStart,
-                       symbolCount(nRows, nPolarizations, nChannels));
-    float *metaData = reinterpret_cast<float *>(_packedBlockReadBuffer.data());
-    initializeDecode(_timeBlockBuffer.get(), metaData, nRows, _antennaCount);
-    uint64_t startRow = getRowIndex(blockIndex);
-    _timeBlockBuffer->resize(nRows);
-    for (size_t blockRow = 0; blockRow != nRows; ++blockRow) {
-      int a1 = (*_ant1Col)(startRow + blockRow),
-          a2 = (*_ant2Col)(startRow + blockRow);
-      decode(_timeBlockBuffer.get(), _unpackedSymbolReadBuffer.data(), blockRow,
-             a1, a2);
-    }
+  // Also when the block is not decoded here, the read-ahead thread should not
+  // be decoding anymore, because the decoder state is shared.
+  if (!takeReadAhead(blockIndex) && blockIndex < nBlocksInFile()) {
+    std::vector<int> ant1, ant2;
+    readAntennas(blockIndex, ant1, ant2);
+    decodeBlock(blockIndex, _timeBlockBuffer.get(), ant1, ant2);
   }
   _currentBlock = blockIndex;
   _isCurrentBlockChanged = false;
 }
 
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::decodeBlock(
+    size_t blockIndex, TimeBlockBuffer<data_t> *buffer,
+    const std::vector<int> &ant1, const std::vector<int> &ant2) {
+  readCompressedData(blockIndex, _packedBlockReadBuffer.data(), _blockSize);
+  const size_t nPolarizations = _shape[0], nChannels = _shape[1],
+               nRows = nRowsInBlock(),
+               nMetaFloats = metaDataFloatCount(nRows, nPolarizations,
+                                                nChannels, _antennaCount);
+  unsigned char *symbolStart =
+      _packedBlockReadBuffer.data() + nMetaFloats * sizeof(float);
+  SimdKernels::Unpack(_bitsPerSymbol, _unpackedSymbolReadBuffer.data(),
+                      symbolStart,
+                      symbolCount(nRows, nPolarizations, nChannels));
+  float *metaData = reinterpret_cast<float *>(_packedBlockReadBuffer.data());
+  initializeDecode(buffer, metaData, nRows, _antennaCount);
+  buffer->resize(nRows);
+  for (size_t blockRow = 0; blockRow != nRows; ++blockRow) {
+    decode(buffer, _unpackedSymbolReadBuffer.data(), blockRow, ant1[blockRow],
+           ant2[blockRow]);
+  }
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::readAntennas(
+    size_t blockIndex, std::vector<int> &ant1, std::vector<int> &ant2) const {
+  const size_t nRows = nRowsInBlock();
+  const uint64_t startRow = getRowIndex(blockIndex);
+  ant1.resize(nRows);
+  ant2.resize(nRows);
+  for (size_t blockRow = 0; blockRow != nRows; ++blockRow) {
+    ant1[blockRow] = (*_ant1Col)(startRow + blockRow);
+    ant2[blockRow] = (*_ant2Col)(startRow + blockRow);
+  }
+}
+
+template <typename DataType>
+bool ThreadedDyscoColumn<DataType>::takeReadAhead(size_t blockIndex) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_readAheadState == ReadAheadState::kRequested) {
+    // Not started yet, so it is as fast to decode it directly.
+    _readAheadState = ReadAheadState::kIdle;
+    return false;
+  }
+  while (_readAheadState == ReadAheadState::kBusy)
+    _cacheChangedCondition.wait(lock);
+  const bool isDecoded = _readAheadState == ReadAheadState::kDone &&
+                         _readAheadBlock == blockIndex;
+  _readAheadState = ReadAheadState::kIdle;
+  if (isDecoded) std::swap(_timeBlockBuffer, _readAheadBuffer);
+  return isDecoded;
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::requestReadAhead(size_t blockIndex) {
+  if (!storageManager().IsPipelined() || _threadGroup.empty() ||
+      blockIndex >= nBlocksInFile())
+    return;
+  // The read-ahead thread is idle, because loadBlock() was just called.
+  readAntennas(blockIndex, _readAheadAnt1, _readAheadAnt2);
+  std::lock_guard<std::mutex> lock(_mutex);
+  // A block in the write cache is not fully written yet.
+  if (_cache.find(blockIndex) == _cache.end()) {
+    _readAheadBlock = blockIndex;
+    _readAheadState = ReadAheadState::kRequested;
+    _cacheChangedCondition.notify_all();
+  }
+}
+
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::getValues(
     casacore::rownr_t rowNr, casacore::Array<DataType> *dataArr) {
@@ -132,6 +192,7 @@ void ThreadedDyscoColumn<DataType>::getValues(
       if (_currentBlock != blockIndex) {
         if (_isCurrentBlockChanged) storeBlock();
         loadBlock(blockIndex);
+        requestReadAhead(blockIndex + 1);
       }
 
       // The time block encoder is now initialized and contains the unpacked
@@ -233,6 +294,8 @@ void ThreadedDyscoColumn<DataType>::Prepare(DyscoDistribution, Normalization,
   size_t nPolarizations = _shape[0], nChannels = _shape[1];
   _timeBlockBuffer.reset(
       new TimeBlockBuffer<data_t>(nPolarizations, nChannels));
+  _readAheadBuffer.reset(
+      new TimeBlockBuffer<data_t>(nPolarizations, nChannels));
   if (_antennaCount != 0) {
     // TODO _timeBlockEncoder->SetNAntennae(_antennaCount);
   }
@@ -266,11 +329,18 @@ void ThreadedDyscoColumn<DataType>::InitializeAfterNRowsPerBlockIsKnown() {
   functor.parent = this;
   _stopThreads = false;
   for (size_t i = 0; i != threadCount; ++i) _threadGroup.create_thread(functor);
+  // The threads for the pipelined mode wait idle if it is not used.
+  WritingThreadFunctor writingFunctor;
+  writingFunctor.parent = this;
+  _threadGroup.create_thread(writingFunctor);
+  ReadAheadThreadFunctor readAheadFunctor;
+  readAheadFunctor.parent = this;
+  _threadGroup.create_thread(readAheadFunctor);
 }
 
 template <typename DataType>
-void ThreadedDyscoColumn<DataType>::encodeAndWrite(
-    size_t blockIndex, const CacheItem &item, unsigned char *packedSymbolBuffer,
+size_t ThreadedDyscoColumn<DataType>::encodeBlock(
+    const CacheItem &item, unsigned char *packedSymbolBuffer,
     unsigned int *unpackedSymbolBuffer, ThreadDataBase *threadUserData) {
   const size_t nPolarizations = _shape[0], nChannels = _shape[1];
   const size_t metaDataSize =
@@ -289,8 +359,7 @@ void ThreadedDyscoColumn<DataType>::encodeAndWrite(
                    nSymbols);
 
   const size_t binarySize = BytePacker::bufferSize(nSymbols, _bitsPerSymbol);
-  writeCompressedData(blockIndex, packedSymbolBuffer,
-                      metaDataSize + binarySize);
+  return metaDataSize + binarySize;
 }
 
 // Continuously write items from the cache into the measurement
@@ -324,17 +393,90 @@ void ThreadedDyscoColumn<DataType>::EncodingThreadFunctor::operator()() {
       item.isBeingWritten = true;
 
       lock.unlock();
-      parent->encodeAndWrite(blockIndex, item, &packedSymbolBuffer[0],
-                             &unpackedSymbolBuffer[0], threadUserData.get());
-
-      lock.lock();
-      delete &item;
-      cache.erase(i);
+      const size_t size =
+          parent->encodeBlock(item, &packedSymbolBuffer[0],
+                              &unpackedSymbolBuffer[0], threadUserData.get());
+
+      if (parent->storageManager().IsPipelined()) {
+        // Leave the writing to the writing thread, which also removes the
+        // item from the cache.
+        lock.lock();
+        while (parent->_writeQueue.size() >= parent->maxWriteQueueSize())
+          parent->_cacheChangedCondition.wait(lock);
+        parent->_writeQueue.push_back(
+            WriteItem{blockIndex, size, std::move(packedSymbolBuffer)});
+        if (parent->_freeWriteBuffers.empty()) {
+          packedSymbolBuffer = ao::uvector<unsigned char>(parent->_blockSize);
+        } else {
+          packedSymbolBuffer = std::move(parent->_freeWriteBuffers.back());
+          parent->_freeWriteBuffers.pop_back();
+        }
+      } else {
+        parent->writeCompressedData(blockIndex, &packedSymbolBuffer[0], size);
+        lock.lock();
+        delete &item;
+        cache.erase(i);
+      }
       parent->_cacheChangedCondition.notify_all();
     }
   }
 }
 
+// Write the encoded blocks in the queue until asked to quit.
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::WritingThreadFunctor::operator()() {
+  std::unique_lock<std::mutex> lock(parent->_mutex);
+  while (true) {
+    while (parent->_writeQueue.empty() && !parent->_stopThreads)
+      parent->_cacheChangedCondition.wait(lock);
+    // The queue is empty when stopping, because the cache is empty.
+    if (parent->_writeQueue.empty()) break;
+    WriteItem item = std::move(parent->_writeQueue.front());
+    parent->_writeQueue.pop_front();
+    parent->_cacheChangedCondition.notify_all();
+
+    lock.unlock();
+    parent->writeCompressedData(item.blockIndex, item.buffer.data(),
+                                item.size);
+
+    lock.lock();
+    typename cache_t::iterator i = parent->_cache.find(item.blockIndex);
+    delete i->second;
+    parent->_cache.erase(i);
+    parent->_freeWriteBuffers.push_back(std::move(item.buffer));
+    parent->_cacheChangedCondition.notify_all();
+  }
+}
+
+// Decode the requested block until asked to quit.
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::ReadAheadThreadFunctor::operator()() {
+  std::unique_lock<std::mutex> lock(parent->_mutex);
+  while (true) {
+    while (parent->_readAheadState != ReadAheadState::kRequested &&
+           !parent->_stopThreads)
+      parent->_cacheChangedCondition.wait(lock);
+    if (parent->_stopThreads) break;
+    parent->_readAheadState = ReadAheadState::kBusy;
+
+    lock.unlock();
+    bool isDecoded = true;
+    try {
+      parent->decodeBlock(parent->_readAheadBlock,
+                          parent->_readAheadBuffer.get(),
+                          parent->_readAheadAnt1, parent->_readAheadAnt2);
+    } catch (std::exception &) {
+      // Let loadBlock() decode it again, which reports the error.
+      isDecoded = false;
+    }
+
+    lock.lock();
+    parent->_readAheadState =
+        isDecoded ? ReadAheadState::kDone : ReadAheadState::kIdle;
+    parent->_cacheChangedCondition.notify_all();
+  }
+}
+
 // This function should only be called with a locked mutex
 template <typename DataType>
 bool ThreadedDyscoColumn<DataType>::isWriteItemAvailable(
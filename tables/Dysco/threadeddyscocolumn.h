@@ -8,10 +8,12 @@
 
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <random>
+#include <vector>
 
 #include "dyscostmancol.h"
 #include "serializable.h"
@@ -26,6 +28,13 @@ class DyscoStMan;
 /**
  * A column for storing compressed values in a threaded way, tailored for the
  * data and weight columns that use a threaded approach for encoding.
+ *
+ * When the storage manager is in pipelined mode (see
+ * DyscoStMan::SetPipelined()), the encoding threads do not write the encoded
+ * time blocks themselves, but put them in a bounded queue that is written by
+ * a separate writing thread. Furthermore, after a time block is read, the next
+ * time block is decoded by a read-ahead thread while the caller consumes the
+ * current one.
  * @author André Offringa
  */
 template <typename DataType>
@@ -155,6 +164,23 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
     void operator()();
     ThreadedDyscoColumn *parent;
   };
+  struct WritingThreadFunctor {
+    void operator()();
+    ThreadedDyscoColumn *parent;
+  };
+  struct ReadAheadThreadFunctor {
+    void operator()();
+    ThreadedDyscoColumn *parent;
+  };
+
+  /** An encoded time block waiting to be written in pipelined mode. */
+  struct WriteItem {
+    size_t blockIndex;
+    size_t size;
+    ao::uvector<unsigned char> buffer;
+  };
+
+  enum class ReadAheadState { kIdle, kRequested, kBusy, kDone };
   struct Header : public Serializable {
     uint32_t blockSize;
     uint32_t antennaCount;
@@ -178,16 +204,27 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
   void putValues(casacore::rownr_t rowNr, const casacore::Array<data_t> *dataPtr);
 
   void stopThreads();
-  void encodeAndWrite(size_t blockIndex, const CacheItem &item,
-                      unsigned char *packedSymbolBuffer,
-                      unsigned int *unpackedSymbolBuffer,
-                      ThreadDataBase *threadUserData);
+  size_t encodeBlock(const CacheItem &item, unsigned char *packedSymbolBuffer,
+                     unsigned int *unpackedSymbolBuffer,
+                     ThreadDataBase *threadUserData);
   bool isWriteItemAvailable(typename cache_t::iterator &i);
   void loadBlock(size_t blockIndex);
+  void decodeBlock(size_t blockIndex, TimeBlockBuffer<data_t> *buffer,
+                   const std::vector<int> &ant1, const std::vector<int> &ant2);
+  void readAntennas(size_t blockIndex, std::vector<int> &ant1,
+                    std::vector<int> &ant2) const;
+  /**
+   * Wait until the read-ahead thread is not decoding. Returns true if it
+   * decoded the given block, in which case it is made the current block.
+   */
+  bool takeReadAhead(size_t blockIndex);
+  void requestReadAhead(size_t blockIndex);
   void storeBlock();
   size_t maxCacheSize() const {
-    return ThreadedDyscoColumn::defaultThreadCount() * 12 / 10 + 1;
+    return ThreadedDyscoColumn::defaultThreadCount() * 12 / 10 + 1 +
+           maxWriteQueueSize();
   }
+  size_t maxWriteQueueSize() const { return 2; }
 
   unsigned _bitsPerSymbol;
   casacore::IPosition _shape;
@@ -209,6 +246,16 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
   size_t _antennaCount;
 
   std::unique_ptr<TimeBlockBuffer<data_t>> _timeBlockBuffer;
+
+  // Encoded blocks to be written and buffers for reuse (pipelined mode).
+  std::deque<WriteItem> _writeQueue;
+  std::vector<ao::uvector<unsigned char>> _freeWriteBuffers;
+
+  // The block decoded by the read-ahead thread (pipelined mode).
+  ReadAheadState _readAheadState;
+  size_t _readAheadBlock;
+  std::vector<int> _readAheadAnt1, _readAheadAnt2;
+  std::unique_ptr<TimeBlockBuffer<data_t>> _readAheadBuffer;
 };
 
 template <>
@@ -70,6 +70,40 @@ class TimeBlockEncoder {
 
  protected:
   TimeBlockEncoder() {}
+
+  /**
+   * Encode the visibilities of the rows into the symbol buffer. The values
+   * of a row are quantized in one go with the vectorized kernels. The
+   * dither values are drawn in the same order as when encoding value by
+   * value, so the symbols do not depend on the kernels used.
+   */
+  template <bool UseDithering>
+  static void encodeRows(
+      const dyscostman::StochasticEncoder<float> &gausEncoder,
+      const std::vector<DBufferRow> &data, size_t visPerRow,
+      symbol_t *symbolBuffer,
+      std::uniform_int_distribution<unsigned> &ditherDist, std::mt19937 *rnd) {
+    ao::uvector<float> values(visPerRow * 2);
+    ao::uvector<unsigned> ditherValues(UseDithering ? visPerRow * 2 : 0);
+    for (const DBufferRow &row : data) {
+      for (size_t i = 0; i != visPerRow; ++i) {
+        values[i * 2] = row.visibilities[i].real();
+        values[i * 2 + 1] = row.visibilities[i].imag();
+      }
+      if (UseDithering) {
+        for (unsigned &ditherValue : ditherValues)
+          ditherValue = ditherDist(*rnd);
+        gausEncoder.EncodeWithDithering(values.data(), ditherValues.data(),
+                                        symbolBuffer, visPerRow * 2);
+      } else {
+        gausEncoder.Encode(values.data(), symbolBuffer, visPerRow * 2);
+      }
+      symbolBuffer += visPerRow * 2;
+    }
+  }
+
+  /** Scale factors of a row that is being decoded. */
+  ao::uvector<double> _decodeFactors;
 };
 
 #endif
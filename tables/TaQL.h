@@ -32,6 +32,7 @@
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/TaQLPreparedStatement.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
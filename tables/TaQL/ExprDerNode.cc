@@ -28,9 +28,11 @@
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Quanta/MVTime.h>
@@ -113,7 +115,8 @@ TableExprNodeColumn::TableExprNodeColumn (const TableExprInfo& tableInfo,
   : TableExprNodeBinary (NTNumeric, VTScalar, OtColumn, Variable),
     tableInfo_p      (tableInfo),
     tabCol_p         (tableInfo.table(), name),
-    applySelection_p (True)
+    applySelection_p (True),
+    readMutex_p      (0)
 {
     //# Check if the column is a scalar.
     if (! tabCol_p.columnDesc().isScalar()) {
@@ -189,34 +192,136 @@ const TableColumn& TableExprNodeColumn::getColumn() const
 Bool TableExprNodeColumn::getBool (const TableExprId& id)
 {
     Bool val;
+    std::unique_lock<std::mutex> lock(lockRead());
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 Int64 TableExprNodeColumn::getInt (const TableExprId& id)
 {
     Int64 val;
+    std::unique_lock<std::mutex> lock(lockRead());
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 Double TableExprNodeColumn::getDouble (const TableExprId& id)
 {
     Double val;
+    std::unique_lock<std::mutex> lock(lockRead());
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 DComplex TableExprNodeColumn::getDComplex (const TableExprId& id)
 {
     DComplex val;
+    std::unique_lock<std::mutex> lock(lockRead());
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 String TableExprNodeColumn::getString (const TableExprId& id)
 {
     String val;
+    std::unique_lock<std::mutex> lock(lockRead());
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 
+// Read the values of a scalar column with type T for the given rows
+// and convert them to type U.
+template<typename T, typename U>
+void getColumnBlockAs (const TableColumn& tabCol, const RefRows& rows,
+                       Vector<U>& values)
+{
+    Vector<T> vals (ScalarColumn<T>(tabCol).getColumnCells (rows));
+    values.resize (vals.size());
+    convertArray (values, vals);
+}
+
+void TableExprNodeColumn::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                        Vector<Bool>& values)
+{
+    if (tabCol_p.columnDesc().dataType() == TpBool) {
+        std::unique_lock<std::mutex> lock(lockRead());
+        values.resize (rownrs.size());
+        ScalarColumn<Bool>(tabCol_p).getColumnCells (RefRows(rownrs, False,
+                                                             True),
+                                                     values);
+    } else {
+        TableExprNodeBinary::getBoolBlock (rownrs, values);
+    }
+}
+
+void TableExprNodeColumn::getIntBlock (const Vector<rownr_t>& rownrs,
+                                       Vector<Int64>& values)
+{
+    RefRows rows(rownrs, False, True);
+    std::unique_lock<std::mutex> lock(lockRead());
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpUChar:
+        getColumnBlockAs<uChar> (tabCol_p, rows, values);
+        break;
+    case TpShort:
+        getColumnBlockAs<Short> (tabCol_p, rows, values);
+        break;
+    case TpUShort:
+        getColumnBlockAs<uShort> (tabCol_p, rows, values);
+        break;
+    case TpInt:
+        getColumnBlockAs<Int> (tabCol_p, rows, values);
+        break;
+    case TpUInt:
+        getColumnBlockAs<uInt> (tabCol_p, rows, values);
+        break;
+    case TpInt64:
+        values.resize (rownrs.size());
+        ScalarColumn<Int64>(tabCol_p).getColumnCells (rows, values);
+        break;
+    default:
+        if (lock.owns_lock()) {
+            lock.unlock();
+        }
+        TableExprNodeBinary::getIntBlock (rownrs, values);
+    }
+}
+
+void TableExprNodeColumn::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                          Vector<Double>& values)
+{
+    RefRows rows(rownrs, False, True);
+    std::unique_lock<std::mutex> lock(lockRead());
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpUChar:
+        getColumnBlockAs<uChar> (tabCol_p, rows, values);
+        break;
+    case TpShort:
+        getColumnBlockAs<Short> (tabCol_p, rows, values);
+        break;
+    case TpUShort:
+        getColumnBlockAs<uShort> (tabCol_p, rows, values);
+        break;
+    case TpInt:
+        getColumnBlockAs<Int> (tabCol_p, rows, values);
+        break;
+    case TpUInt:
+        getColumnBlockAs<uInt> (tabCol_p, rows, values);
+        break;
+    case TpInt64:
+        getColumnBlockAs<Int64> (tabCol_p, rows, values);
+        break;
+    case TpFloat:
+        getColumnBlockAs<Float> (tabCol_p, rows, values);
+        break;
+    case TpDouble:
+        values.resize (rownrs.size());
+        ScalarColumn<Double>(tabCol_p).getColumnCells (rows, values);
+        break;
+    default:
+        if (lock.owns_lock()) {
+            lock.unlock();
+        }
+        TableExprNodeBinary::getDoubleBlock (rownrs, values);
+    }
+}
+
 Bool TableExprNodeColumn::getColumnDataType (DataType& dt) const
 {
     dt = tabCol_p.columnDesc().dataType();
@@ -32,6 +32,7 @@
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/BasicMath/Random.h>
+#include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -291,6 +292,8 @@ private:
 // This class represents a scalar column in a table select expression tree.
 // When the select expression gets evaluated, the value of the
 // given row in the column is used.
+// <br>Reading a column is not thread-safe. If the expression is evaluated
+// by multiple threads, a mutex can be set to serialize the reads.
 // </synopsis> 
 
 
@@ -320,6 +323,22 @@ public:
     String   getString   (const TableExprId& id) override;
     const TableColumn& getColumn() const;
 
+    // Set the mutex to be locked while reading the column.
+    // It should be set if the expression is evaluated by multiple threads
+    // simultaneously. A null pointer means no locking (the default).
+    void setReadMutex (std::mutex* mutex)
+      { readMutex_p = mutex; }
+
+    // Get the data for a block of rows by reading the column in bulk.
+    // <group>
+    void getBoolBlock   (const Vector<rownr_t>& rownrs,
+                         Vector<Bool>& values) override;
+    void getIntBlock    (const Vector<rownr_t>& rownrs,
+                         Vector<Int64>& values) override;
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
+    // </group>
+
     // Get the data for the given rows.
     Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs) override;
     Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs) override;
@@ -338,9 +357,15 @@ public:
     static Unit getColumnUnit (const TableColumn&);
 
 protected:
+    // Lock the read mutex (if set).
+    std::unique_lock<std::mutex> lockRead()
+      { return readMutex_p ? std::unique_lock<std::mutex>(*readMutex_p)
+                           : std::unique_lock<std::mutex>(); }
+
     TableExprInfo tableInfo_p;
     TableColumn   tabCol_p;
     Bool          applySelection_p;
+    std::mutex*   readMutex_p;
 };
 
 
@@ -163,6 +163,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     { return False; }
   void TableExprGroupFuncBase::finish()
   {}
+  Bool TableExprGroupFuncBase::isMergeable() const
+  {
+    return False;
+  }
+  void TableExprGroupFuncBase::merge (const TableExprGroupFuncBase&)
+  { throw TableInvExpr ("TableExprGroupFuncBase::merge not implemented"); }
   std::shared_ptr<vector<TableExprId>> TableExprGroupFuncBase::getIds() const
   { throw TableInvExpr ("TableExprGroupFuncBase::getIds not implemented"); }
   Bool TableExprGroupFuncBase::getBool (const vector<TableExprId>&)
@@ -489,5 +495,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
+  void TableExprGroupFuncSet::merge (const TableExprGroupFuncSet& other)
+  {
+    AlwaysAssert (other.itsFuncs.size() == itsFuncs.size(), AipsError);
+    itsId = other.itsId;
+    for (uInt i=0; i<itsFuncs.size(); ++i) {
+      itsFuncs[i]->merge (*other.itsFuncs[i]);
+    }
+  }
+
 
 } //# NAMESPACE CASACORE - END
@@ -221,6 +221,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // If needed, finish the aggregation.
     // By default nothing is done.
     virtual void finish();
+
+    // Can the partial aggregation of another function object of the same
+    // type be merged into this one? If so, the rows of a group can be
+    // aggregated in parts (e.g., by multiple threads).
+    // The default implementation returns False.
+    virtual Bool isMergeable() const;
+
+    // Merge the partial aggregation of another (not finished) function
+    // object of the same type into this one. The other object must have
+    // aggregated rows following the rows of this object.
+    // The default implementation throws an exception.
+    virtual void merge (const TableExprGroupFuncBase& other);
     // Get the assembled TableExprIds of a group. It is specifically meant
     // for TableExprGroupExprId used for lazy aggregation.
     virtual std::shared_ptr<vector<TableExprId>> getIds() const;
@@ -815,6 +827,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Apply the functions to the given row.
     void apply (const TableExprId& id);
 
+    // Merge the partial aggregations of another set of functions for the
+    // same aggregate nodes. The other set must have aggregated rows
+    // following the rows of this set, so its TableExprId is used.
+    void merge (const TableExprGroupFuncSet& other);
+
     // Get the vector of functions.
     const vector<std::shared_ptr<TableExprGroupFuncBase>>& getFuncs() const
       { return itsFuncs; }
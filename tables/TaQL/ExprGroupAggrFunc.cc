@@ -47,6 +47,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue++;
   }
+  Bool TableExprGroupCountAll::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupCountAll::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupCountAll&>(other).itsValue;
+  }
 
   TableExprGroupCount::TableExprGroupCount (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node),
@@ -71,6 +79,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue++;
     }
   }
+  Bool TableExprGroupCount::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupCount::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupCount&>(other).itsValue;
+  }
 
   TableExprGroupAny::TableExprGroupAny (TableExprNodeRep* node)
     : TableExprGroupFuncBool (node, False)
@@ -82,6 +98,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (v) itsValue = True;
   }
+  Bool TableExprGroupAny::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupAny::merge (const TableExprGroupFuncBase& other)
+  {
+    if (static_cast<const TableExprGroupAny&>(other).itsValue) itsValue = True;
+  }
 
   TableExprGroupAll::TableExprGroupAll (TableExprNodeRep* node)
     : TableExprGroupFuncBool (node, True)
@@ -93,6 +117,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (!v) itsValue = False;
   }
+  Bool TableExprGroupAll::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupAll::merge (const TableExprGroupFuncBase& other)
+  {
+    if (!static_cast<const TableExprGroupAll&>(other).itsValue) itsValue = False;
+  }
 
   TableExprGroupNTrue::TableExprGroupNTrue (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -104,6 +136,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (v) itsValue++;
   }
+  Bool TableExprGroupNTrue::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupNTrue::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupNTrue&>(other).itsValue;
+  }
 
   TableExprGroupNFalse::TableExprGroupNFalse (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -115,6 +155,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (!v) itsValue++;
   }
+  Bool TableExprGroupNFalse::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupNFalse::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupNFalse&>(other).itsValue;
+  }
 
   TableExprGroupMinInt::TableExprGroupMinInt (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, std::numeric_limits<Int64>::max())
@@ -126,6 +174,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     if (v<itsValue) itsValue = v;
   }
+  Bool TableExprGroupMinInt::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupMinInt::merge (const TableExprGroupFuncBase& other)
+  {
+    Int64 v = static_cast<const TableExprGroupMinInt&>(other).itsValue;
+    if (v<itsValue) itsValue = v;
+  }
 
   TableExprGroupMaxInt::TableExprGroupMaxInt (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, std::numeric_limits<Int64>::min())
@@ -137,6 +194,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     if (v>itsValue) itsValue = v;
   }
+  Bool TableExprGroupMaxInt::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupMaxInt::merge (const TableExprGroupFuncBase& other)
+  {
+    Int64 v = static_cast<const TableExprGroupMaxInt&>(other).itsValue;
+    if (v>itsValue) itsValue = v;
+  }
 
   TableExprGroupSumInt::TableExprGroupSumInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -147,6 +213,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getInt(id);
   }
+  Bool TableExprGroupSumInt::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupSumInt::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupSumInt&>(other).itsValue;
+  }
 
   TableExprGroupProductInt::TableExprGroupProductInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, 1)
@@ -157,6 +231,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getInt(id);
   }
+  Bool TableExprGroupProductInt::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupProductInt::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue *= static_cast<const TableExprGroupProductInt&>(other).itsValue;
+  }
 
   TableExprGroupSumSqrInt::TableExprGroupSumSqrInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -168,6 +250,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrInt::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupSumSqrInt::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupSumSqrInt&>(other).itsValue;
+  }
 
 
   TableExprGroupMinDouble::TableExprGroupMinDouble(TableExprNodeRep* node)
@@ -180,6 +270,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     if (v<itsValue) itsValue = v;
   }
+  Bool TableExprGroupMinDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupMinDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    Double v = static_cast<const TableExprGroupMinDouble&>(other).itsValue;
+    if (v<itsValue) itsValue = v;
+  }
 
   TableExprGroupMaxDouble::TableExprGroupMaxDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node, std::numeric_limits<Double>::min())
@@ -191,6 +290,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     if (v>itsValue) itsValue = v;
   }
+  Bool TableExprGroupMaxDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupMaxDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    Double v = static_cast<const TableExprGroupMaxDouble&>(other).itsValue;
+    if (v>itsValue) itsValue = v;
+  }
 
   TableExprGroupSumDouble::TableExprGroupSumDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node)
@@ -201,6 +309,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getDouble(id);
   }
+  Bool TableExprGroupSumDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupSumDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupSumDouble&>(other).itsValue;
+  }
 
   TableExprGroupProductDouble::TableExprGroupProductDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node, 1)
@@ -211,6 +327,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getDouble(id);
   }
+  Bool TableExprGroupProductDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupProductDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue *= static_cast<const TableExprGroupProductDouble&>(other).itsValue;
+  }
 
   TableExprGroupSumSqrDouble::TableExprGroupSumSqrDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node)
@@ -222,6 +346,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupSumSqrDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupSumSqrDouble&>(other).itsValue;
+  }
 
   TableExprGroupMeanDouble::TableExprGroupMeanDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node),
@@ -240,6 +372,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue /= itsNr;
     }
   }
+  Bool TableExprGroupMeanDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupMeanDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMeanDouble& that =
+      static_cast<const TableExprGroupMeanDouble&>(other);
+    itsValue += that.itsValue;
+    itsNr    += that.itsNr;
+  }
 
   TableExprGroupVarianceDouble::TableExprGroupVarianceDouble(TableExprNodeRep* node, uInt ddof)
     : TableExprGroupFuncDouble (node),
@@ -268,6 +411,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue = 0;
     }
   }
+  Bool TableExprGroupVarianceDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupVarianceDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    // Combine the partial means and M2 values in a numerically stable way
+    // (see the parallel algorithm in the reference given above).
+    const TableExprGroupVarianceDouble& that =
+      static_cast<const TableExprGroupVarianceDouble&>(other);
+    if (that.itsNr > 0) {
+      Double nr = itsNr + that.itsNr;
+      Double delta = that.itsCurMean - itsCurMean;
+      itsValue   += that.itsValue + delta*delta * (itsNr / nr * that.itsNr);
+      itsCurMean += delta * (that.itsNr / nr);
+      itsNr      += that.itsNr;
+    }
+  }
 
   TableExprGroupStdDevDouble::TableExprGroupStdDevDouble(TableExprNodeRep* node, uInt ddof)
     : TableExprGroupVarianceDouble (node, ddof)
@@ -298,6 +459,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue = sqrt(itsValue / itsNr);
     }
   }
+  Bool TableExprGroupRmsDouble::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupRmsDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupRmsDouble& that =
+      static_cast<const TableExprGroupRmsDouble&>(other);
+    itsValue += that.itsValue;
+    itsNr    += that.itsNr;
+  }
 
   TableExprGroupFractileDouble::TableExprGroupFractileDouble(TableExprNodeRep* node,
                                                              Double fraction)
@@ -337,6 +509,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getDComplex(id);
   }
+  Bool TableExprGroupSumDComplex::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupSumDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupSumDComplex&>(other).itsValue;
+  }
 
   TableExprGroupProductDComplex::TableExprGroupProductDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node, DComplex(1,0))
@@ -347,6 +527,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getDComplex(id);
   }
+  Bool TableExprGroupProductDComplex::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupProductDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue *= static_cast<const TableExprGroupProductDComplex&>(other).itsValue;
+  }
 
   TableExprGroupSumSqrDComplex::TableExprGroupSumSqrDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node)
@@ -358,6 +546,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     DComplex v = itsOperand->getDComplex(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrDComplex::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupSumSqrDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    itsValue += static_cast<const TableExprGroupSumSqrDComplex&>(other).itsValue;
+  }
 
   TableExprGroupMeanDComplex::TableExprGroupMeanDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node),
@@ -376,6 +572,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue /= double(itsNr);
     }
   }
+  Bool TableExprGroupMeanDComplex::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupMeanDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMeanDComplex& that =
+      static_cast<const TableExprGroupMeanDComplex&>(other);
+    itsValue += that.itsValue;
+    itsNr    += that.itsNr;
+  }
 
   TableExprGroupVarianceDComplex::TableExprGroupVarianceDComplex(TableExprNodeRep* node, uInt ddof)
     : TableExprGroupFuncDouble (node),
@@ -404,6 +611,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue = 0;
     }
   }
+  Bool TableExprGroupVarianceDComplex::isMergeable() const
+  {
+    return True;
+  }
+  void TableExprGroupVarianceDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    // Combine the partial means and M2 values in a numerically stable way
+    // (see the parallel algorithm in the reference given above).
+    const TableExprGroupVarianceDComplex& that =
+      static_cast<const TableExprGroupVarianceDComplex&>(other);
+    if (that.itsNr > 0) {
+      Double nr = itsNr + that.itsNr;
+      DComplex delta = that.itsCurMean - itsCurMean;
+      itsValue   += that.itsValue + norm(delta) * (itsNr / nr * that.itsNr);
+      itsCurMean += delta * (that.itsNr / nr);
+      itsNr      += that.itsNr;
+    }
+  }
 
   TableExprGroupStdDevDComplex::TableExprGroupStdDevDComplex(TableExprNodeRep* node, uInt ddof)
     : TableExprGroupVarianceDComplex (node, ddof)
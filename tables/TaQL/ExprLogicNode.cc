@@ -27,6 +27,7 @@
 #include <casacore/tables/TaQL/ExprNodeSetOpt.h>
 #include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
+#include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/casa/Quanta/MVTime.h>
@@ -53,6 +54,12 @@ Bool TableExprNodeEQInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) == rnode_p->getInt(id);
 }
+void TableExprNodeEQInt::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                       Vector<Bool>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return l == r; });
+}
 
 TableExprNodeEQDouble::TableExprNodeEQDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -61,6 +68,12 @@ Bool TableExprNodeEQDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) == rnode_p->getDouble(id);
 }
+void TableExprNodeEQDouble::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                          Vector<Bool>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l == r; });
+}
 
 TableExprNodeEQDComplex::TableExprNodeEQDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -110,6 +123,12 @@ Bool TableExprNodeNEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) != rnode_p->getInt(id);
 }
+void TableExprNodeNEInt::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                       Vector<Bool>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return l != r; });
+}
 
 TableExprNodeNEDouble::TableExprNodeNEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -118,6 +137,12 @@ Bool TableExprNodeNEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) != rnode_p->getDouble(id);
 }
+void TableExprNodeNEDouble::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                          Vector<Bool>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l != r; });
+}
 
 TableExprNodeNEDComplex::TableExprNodeNEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -159,6 +184,12 @@ Bool TableExprNodeGTInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) > rnode_p->getInt(id);
 }
+void TableExprNodeGTInt::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                       Vector<Bool>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return l > r; });
+}
 
 TableExprNodeGTDouble::TableExprNodeGTDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -167,6 +198,12 @@ Bool TableExprNodeGTDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) > rnode_p->getDouble(id);
 }
+void TableExprNodeGTDouble::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                          Vector<Bool>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l > r; });
+}
 
 TableExprNodeGTDComplex::TableExprNodeGTDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -200,6 +237,12 @@ Bool TableExprNodeGEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) >= rnode_p->getInt(id);
 }
+void TableExprNodeGEInt::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                       Vector<Bool>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return l >= r; });
+}
 
 TableExprNodeGEDouble::TableExprNodeGEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -208,6 +251,12 @@ Bool TableExprNodeGEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) >= rnode_p->getDouble(id);
 }
+void TableExprNodeGEDouble::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                          Vector<Bool>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l >= r; });
+}
 
 TableExprNodeGEDComplex::TableExprNodeGEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -346,6 +395,41 @@ Bool TableExprNodeINDate::getBool (const TableExprId& id)
 }
 
 
+// Evaluate the right operand of a logical AND or OR only for the rows
+// where the left operand does not determine the result yet (i.e. where it
+// has the given value), as done by the short-circuit evaluation per row.
+static void getLogicalBlock (const TENShPtr& lnode, const TENShPtr& rnode,
+                             Bool evalRight,
+                             const Vector<rownr_t>& rownrs,
+                             Vector<Bool>& values)
+{
+    lnode->getBoolBlock (rownrs, values);
+    size_t n = values.size();
+    size_t nr = 0;
+    for (size_t i=0; i<n; ++i) {
+        if (values[i] == evalRight) {
+            nr++;
+        }
+    }
+    if (nr > 0) {
+        Vector<rownr_t> subRows(nr);
+        nr = 0;
+        for (size_t i=0; i<n; ++i) {
+            if (values[i] == evalRight) {
+                subRows[nr++] = rownrs[i];
+            }
+        }
+        Vector<Bool> subValues;
+        rnode->getBoolBlock (subRows, subValues);
+        nr = 0;
+        for (size_t i=0; i<n; ++i) {
+            if (values[i] == evalRight) {
+                values[i] = subValues[nr++];
+            }
+        }
+    }
+}
+
 TableExprNodeOR::TableExprNodeOR (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtOR)
 {}
@@ -353,6 +437,11 @@ Bool TableExprNodeOR::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) || rnode_p->getBool(id);
 }
+void TableExprNodeOR::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                    Vector<Bool>& values)
+{
+    getLogicalBlock (lnode_p, rnode_p, False, rownrs, values);
+}
 
 
 TableExprNodeAND::TableExprNodeAND (const TableExprNodeRep& node)
@@ -362,6 +451,11 @@ Bool TableExprNodeAND::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) && rnode_p->getBool(id);
 }
+void TableExprNodeAND::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                     Vector<Bool>& values)
+{
+    getLogicalBlock (lnode_p, rnode_p, True, rownrs, values);
+}
 
 
 TableExprNodeNOT::TableExprNodeNOT (const TableExprNodeRep& node)
@@ -371,94 +465,119 @@ Bool TableExprNodeNOT::getBool (const TableExprId& id)
 {
   return ! lnode_p->getBool(id);
 }
+void TableExprNodeNOT::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                     Vector<Bool>& values)
+{
+  lnode_p->getBoolBlock (rownrs, values);
+  for (Bool& v : values) {
+    v = !v;
+  }
+}
 
 
 
-void TableExprNodeEQDouble::ranges (Block<TableExprRange>& blrange)
+//# Create the range for a comparison of a scalar column with a constant.
+//# The range is the hull of the values, so the end values of < and >
+//# are included. For == the range is a single value.
+//# Nothing is created if it is not such a comparison.
+static void compareRange (Block<TableExprRange>& blrange,
+                          const TENShPtr& lnode, const TENShPtr& rnode,
+                          Bool isEqual)
 {
-    Double dval = 0;
+    Double st = 0;
+    Double end = 0;
     TENShPtr tsncol = 0;
     //# We can store a range if there is a scalar column and constant
     //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-        tsncol = lnode_p;
-        dval = rnode_p->getDouble (0);
+    if (lnode->operType()  == TableExprNodeRep::OtColumn
+    &&  lnode->valueType() == TableExprNodeRep::VTScalar
+    &&  rnode->operType()  == TableExprNodeRep::OtLiteral) {
+        tsncol = lnode;
+        st = rnode->getDouble (0);
+        end = (isEqual  ?  st : DBL_MAX);
     }else{
-        if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  rnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-            tsncol = rnode_p;
-            dval = lnode_p->getDouble (0);
+        if (rnode->operType()  == TableExprNodeRep::OtColumn
+        &&  rnode->valueType() == TableExprNodeRep::VTScalar
+        &&  lnode->operType()  == TableExprNodeRep::OtLiteral) {
+            tsncol = rnode;
+            end = lnode->getDouble (0);
+            st = (isEqual  ?  end : -DBL_MAX);
         }
     }
     //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
+    //# The cast gives a null pointer if it is not a table column.
     TableExprNodeRep::createRange (blrange,
                                    dynamic_cast<TableExprNodeColumn*>(tsncol.get()),
-                                   dval, dval);
+                                   st, end);
+}
+
+void TableExprNodeEQInt::ranges (Block<TableExprRange>& blrange)
+{
+    compareRange (blrange, lnode_p, rnode_p, True);
+}
+
+void TableExprNodeEQDouble::ranges (Block<TableExprRange>& blrange)
+{
+    compareRange (blrange, lnode_p, rnode_p, True);
+}
+
+void TableExprNodeGEInt::ranges (Block<TableExprRange>& blrange)
+{
+    compareRange (blrange, lnode_p, rnode_p, False);
 }
 
 void TableExprNodeGEDouble::ranges (Block<TableExprRange>& blrange)
 {
-    Double st = 0;
-    Double end = 0;
-    TENShPtr tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-        tsncol = lnode_p;
-        st = rnode_p->getDouble (0);
-        end = DBL_MAX;
-    }else{
-        if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  rnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-            tsncol = rnode_p;
-            end = lnode_p->getDouble (0);
-            st = -DBL_MAX;
-        }
-    }
-    //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
-    TableExprNodeRep::createRange (blrange,
-                                   dynamic_cast<TableExprNodeColumn*>(tsncol.get()),
-                                   st, end);
+    compareRange (blrange, lnode_p, rnode_p, False);
+}
+
+void TableExprNodeGTInt::ranges (Block<TableExprRange>& blrange)
+{
+    compareRange (blrange, lnode_p, rnode_p, False);
 }
 
 void TableExprNodeGTDouble::ranges (Block<TableExprRange>& blrange)
 {
-    Double st = 0;
-    Double end = 0;
-    TENShPtr tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
+    compareRange (blrange, lnode_p, rnode_p, False);
+}
+
+//# A range can be made for a scalar column IN an optimized constant set
+//# of intervals (as created for BETWEEN).
+void TableExprNodeINDouble::ranges (Block<TableExprRange>& blrange)
+{
+    TableExprNodeColumn* tsncol = 0;
+    const TableExprNodeSetOptContSetBase<Double>* set = 0;
     if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-        tsncol = lnode_p;
-        st = rnode_p->getDouble (0);
-        end = DBL_MAX;
-    }else{
-        if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-            tsncol = rnode_p;
-            end = lnode_p->getDouble (0);
-            st = -DBL_MAX;
-        }
+    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar) {
+        tsncol = dynamic_cast<TableExprNodeColumn*>(lnode_p.get());
+        set = dynamic_cast<const TableExprNodeSetOptContSetBase<Double>*>
+                                                          (rnode_p.get());
+    }
+    if (tsncol == 0  ||  set == 0  ||  set->size() == 0) {
+        TableExprNodeRep::createRange (blrange);
+        return;
+    }
+    //# The intervals are ordered, so they can be combined one by one.
+    TableExprNodeRep::createRange (blrange, tsncol,
+                                   set->starts()[0], set->ends()[0]);
+    for (size_t i=1; i<set->size(); ++i) {
+        blrange[0].mixOr (TableExprRange (tsncol->getColumn(),
+                                          set->starts()[i], set->ends()[i]));
     }
-    //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
-    TableExprNodeRep::createRange (blrange,
-                                   dynamic_cast<TableExprNodeColumn*>(tsncol.get()),
-                                   st, end);
 }
 
 
+//# Test if two ranges are for the same column.
+//# Columns with the same name can be in different tables (e.g. t1.TIME and
+//# t2.TIME), so the tables have to be compared as well.
+static Bool isSameRangeColumn (const TableExprRange& left,
+                               const TableExprRange& right)
+{
+    return left.getColumn().columnDesc().name() ==
+                               right.getColumn().columnDesc().name()  &&
+           left.getColumn().table().isSameTable (right.getColumn().table());
+}
+
 //# Or two blocks of ranges.
 void TableExprNodeOR::ranges (Block<TableExprRange>& blrange)
 {
@@ -468,14 +587,13 @@ void TableExprNodeOR::ranges (Block<TableExprRange>& blrange)
     rnode_p->ranges (right);
     //# Now or the ranges.
     //# If a column appears in one, but not in the other it needs
-    //# to be removed. Only equal columns can be combined and what
-    //# gets created is a superset of the original blocks.
+    //# to be removed. Only equal columns (same name and table) can be
+    //# combined and what gets created is a superset of the original blocks.
     blrange.resize(0,True);
     size_t nr=0;
     for (size_t i=0; i<left.nelements(); i++) {
         for (size_t j=0; j<right.nelements(); j++) {
-            if (right[j].getColumn().columnDesc().name() ==
-                                left[i].getColumn().columnDesc().name()) {
+            if (isSameRangeColumn (left[i], right[j])) {
                 blrange.resize(nr+1, True);
                 blrange[nr] = left[i];
                 blrange[nr].mixOr (right[j]);
@@ -503,14 +621,13 @@ void TableExprNodeAND::ranges (Block<TableExprRange>& blrange)
     }
     //# Now and the ranges.
     //# First handle one and intersect its ranges with matching
-    //# column names in the other one.
+    //# columns in the other one.
     //# Keep a vector with flags for non-processed other ones.
     Vector<Int> vec(other.nelements());
     vec = 0;
     for (size_t i=0; i<blrange.nelements(); i++) {
         for (size_t j=0; j<other.nelements(); j++) {
-            if (other[j].getColumn().columnDesc().name() ==
-                                blrange[i].getColumn().columnDesc().name()) {
+            if (isSameRangeColumn (blrange[i], other[j])) {
                 blrange[i].mixAnd (other[j]);
                 vec(j) = 1;
             }
@@ -102,6 +102,9 @@ public:
     TableExprNodeEQInt (const TableExprNodeRep&);
     ~TableExprNodeEQInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
+    void ranges (Block<TableExprRange>&) override;
 };
 
 
@@ -132,6 +135,8 @@ public:
     TableExprNodeEQDouble (const TableExprNodeRep&);
     ~TableExprNodeEQDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -314,6 +319,8 @@ public:
     TableExprNodeNEInt (const TableExprNodeRep&);
     ~TableExprNodeNEInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
 };
 
 
@@ -344,6 +351,8 @@ public:
     TableExprNodeNEDouble (const TableExprNodeRep&);
     ~TableExprNodeNEDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
 };
 
 
@@ -495,6 +504,9 @@ public:
     TableExprNodeGTInt (const TableExprNodeRep&);
     ~TableExprNodeGTInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
+    void ranges (Block<TableExprRange>&) override;
 };
 
 
@@ -525,6 +537,8 @@ public:
     TableExprNodeGTDouble (const TableExprNodeRep&);
     ~TableExprNodeGTDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -647,6 +661,9 @@ public:
     TableExprNodeGEInt (const TableExprNodeRep&);
     ~TableExprNodeGEInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
+    void ranges (Block<TableExprRange>&) override;
 };
 
 
@@ -677,6 +694,8 @@ public:
     TableExprNodeGEDouble (const TableExprNodeRep&);
     ~TableExprNodeGEDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -839,6 +858,7 @@ public:
     void optimize() override;
     static void doOptimize (TENShPtr& rnode);
     Bool getBool (const TableExprId& id) override;
+    void ranges (Block<TableExprRange>&) override;
 };
 
 
@@ -964,6 +984,8 @@ public:
     TableExprNodeOR (const TableExprNodeRep&);
     ~TableExprNodeOR() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -993,6 +1015,8 @@ public:
     TableExprNodeAND (const TableExprNodeRep&);
     ~TableExprNodeAND() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -1022,6 +1046,8 @@ public:
     TableExprNodeNOT (const TableExprNodeRep&);
     ~TableExprNodeNOT() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBlock (const Vector<rownr_t>& rownrs,
+                       Vector<Bool>& values) override;
 };
 
 
@@ -51,6 +51,18 @@ Double TableExprNodePlusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) + rnode_p->getInt(id); }
 DComplex TableExprNodePlusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) + rnode_p->getInt(id)); }
+void TableExprNodePlusInt::getIntBlock (const Vector<rownr_t>& rownrs,
+                                        Vector<Int64>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return l + r; });
+}
+void TableExprNodePlusInt::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                           Vector<Double>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return Double(l + r); });
+}
 
 TableExprNodePlusDouble::TableExprNodePlusDouble (const TableExprNodeRep& node)
 : TableExprNodePlus (NTDouble, node)
@@ -61,6 +73,12 @@ Double TableExprNodePlusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
 DComplex TableExprNodePlusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
+void TableExprNodePlusDouble::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                              Vector<Double>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l + r; });
+}
 
 TableExprNodePlusDComplex::TableExprNodePlusDComplex (const TableExprNodeRep& node)
 : TableExprNodePlus (NTComplex, node)
@@ -123,6 +141,18 @@ Double TableExprNodeMinusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) - rnode_p->getInt(id); }
 DComplex TableExprNodeMinusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) - rnode_p->getInt(id)); }
+void TableExprNodeMinusInt::getIntBlock (const Vector<rownr_t>& rownrs,
+                                         Vector<Int64>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return l - r; });
+}
+void TableExprNodeMinusInt::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                            Vector<Double>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return Double(l - r); });
+}
 
 TableExprNodeMinusDouble::TableExprNodeMinusDouble (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTDouble, node)
@@ -141,6 +171,12 @@ Double TableExprNodeMinusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
 DComplex TableExprNodeMinusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
+void TableExprNodeMinusDouble::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                               Vector<Double>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l - r; });
+}
 
 TableExprNodeMinusDComplex::TableExprNodeMinusDComplex (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTComplex, node)
@@ -196,6 +232,18 @@ Double TableExprNodeTimesInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) * rnode_p->getInt(id); }
 DComplex TableExprNodeTimesInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) * rnode_p->getInt(id)); }
+void TableExprNodeTimesInt::getIntBlock (const Vector<rownr_t>& rownrs,
+                                         Vector<Int64>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return l * r; });
+}
+void TableExprNodeTimesInt::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                            Vector<Double>& values)
+{
+    getBinaryBlock<Int64> (rownrs, values,
+                           [](Int64 l, Int64 r) { return Double(l * r); });
+}
 
 TableExprNodeTimesDouble::TableExprNodeTimesDouble (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTDouble, node)
@@ -206,6 +254,12 @@ Double TableExprNodeTimesDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
 DComplex TableExprNodeTimesDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
+void TableExprNodeTimesDouble::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                               Vector<Double>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l * r; });
+}
 
 TableExprNodeTimesDComplex::TableExprNodeTimesDComplex (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTComplex, node)
@@ -262,6 +316,12 @@ Double TableExprNodeDivideDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
 DComplex TableExprNodeDivideDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
+void TableExprNodeDivideDouble::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                                Vector<Double>& values)
+{
+    getBinaryBlock<Double> (rownrs, values,
+                            [](Double l, Double r) { return l / r; });
+}
 
 TableExprNodeDivideDComplex::TableExprNodeDivideDComplex (const TableExprNodeRep& node)
 : TableExprNodeDivide (NTComplex, node)
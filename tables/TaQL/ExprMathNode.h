@@ -101,6 +101,10 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBlock    (const Vector<rownr_t>& rownrs,
+                         Vector<Int64>& values) override;
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
 };
 
 
@@ -133,6 +137,8 @@ public:
     ~TableExprNodePlusDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
 };
 
 
@@ -289,6 +295,10 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBlock    (const Vector<rownr_t>& rownrs,
+                         Vector<Int64>& values) override;
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
 };
 
 
@@ -321,6 +331,8 @@ public:
     virtual void handleUnits();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
 };
 
 
@@ -444,6 +456,10 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBlock    (const Vector<rownr_t>& rownrs,
+                         Vector<Int64>& values) override;
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
 };
 
 
@@ -475,6 +491,8 @@ public:
     ~TableExprNodeTimesDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
 };
 
 
@@ -565,6 +583,8 @@ public:
     ~TableExprNodeDivideDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                         Vector<Double>& values) override;
 };
 
 
@@ -230,6 +230,49 @@ MVTime TableExprNodeRep::getDate (const TableExprId&)
     TableExprNode::throwInvDT ("(getDate not implemented)");
     return MVTime(0.);
 }
+void TableExprNodeRep::getBoolBlock (const Vector<rownr_t>& rownrs,
+                                     Vector<Bool>& values)
+{
+    values.resize (rownrs.size());
+    if (isConstant()) {
+        values = getBool (TableExprId(0));
+    } else {
+        TableExprId id;
+        for (size_t i=0; i<rownrs.size(); ++i) {
+            id.setRownr (rownrs[i]);
+            values[i] = getBool (id);
+        }
+    }
+}
+void TableExprNodeRep::getIntBlock (const Vector<rownr_t>& rownrs,
+                                    Vector<Int64>& values)
+{
+    values.resize (rownrs.size());
+    if (isConstant()) {
+        values = getInt (TableExprId(0));
+    } else {
+        TableExprId id;
+        for (size_t i=0; i<rownrs.size(); ++i) {
+            id.setRownr (rownrs[i]);
+            values[i] = getInt (id);
+        }
+    }
+}
+void TableExprNodeRep::getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                       Vector<Double>& values)
+{
+    values.resize (rownrs.size());
+    if (isConstant()) {
+        values = getDouble (TableExprId(0));
+    } else {
+        TableExprId id;
+        for (size_t i=0; i<rownrs.size(); ++i) {
+            id.setRownr (rownrs[i]);
+            values[i] = getDouble (id);
+        }
+    }
+}
+
 MArray<Bool> TableExprNodeRep::getArrayBool (const TableExprId&)
 {
     TableExprNode::throwInvDT ("(getArrayBool not implemented)");
@@ -360,6 +360,36 @@ public:
       { value = getArrayString (id); }
     // </group>
 
+    // Get the scalar values of this node for a block of rows.
+    // The row numbers are used as the TableExprId of each row.
+    // The vector of values is resized to the number of rows.
+    // <br>Evaluating an expression a block at a time needs far fewer
+    // virtual function calls than doing it row by row, columns can be
+    // read in bulk, and the operators can use simple loops that the
+    // compiler can vectorize.
+    // The default implementations get a constant value only once and
+    // evaluate other expressions row by row. The nodes for columns and
+    // the most common arithmetic, comparison and logical operators
+    // process the entire block at once.
+    // <group>
+    virtual void getBoolBlock   (const Vector<rownr_t>& rownrs,
+                                 Vector<Bool>& values);
+    virtual void getIntBlock    (const Vector<rownr_t>& rownrs,
+                                 Vector<Int64>& values);
+    virtual void getDoubleBlock (const Vector<rownr_t>& rownrs,
+                                 Vector<Double>& values);
+    // </group>
+
+    // General block get functions for template purposes.
+    // <group>
+    void getBlock (const Vector<rownr_t>& rownrs, Vector<Bool>& values)
+      { getBoolBlock (rownrs, values); }
+    void getBlock (const Vector<rownr_t>& rownrs, Vector<Int64>& values)
+      { getIntBlock (rownrs, values); }
+    void getBlock (const Vector<rownr_t>& rownrs, Vector<Double>& values)
+      { getDoubleBlock (rownrs, values); }
+    // </group>
+
     // Get a value as an array, even it it is a scalar.
     // This is useful if one could give an argument as scalar or array.
     // <group>
@@ -633,6 +663,27 @@ protected:
     static const Unit& makeEqualUnits (const TENShPtr& left,
                                        TENShPtr& right);
 
+    // Evaluate a binary operator for a block of rows.
+    // Both operands are evaluated for the entire block as type T, whereafter
+    // the operator <src>op</src> is applied to each pair of values.
+    template<typename T, typename R, typename Op>
+    void getBinaryBlock (const Vector<rownr_t>& rownrs, Vector<R>& values,
+                         Op op)
+    {
+        Vector<T> left;
+        Vector<T> right;
+        lnode_p->getBlock (rownrs, left);
+        rnode_p->getBlock (rownrs, right);
+        values.resize (rownrs.size());
+        const T* l = left.data();
+        const T* r = right.data();
+        R* res = values.data();
+        size_t n = rownrs.size();
+        for (size_t i=0; i<n; ++i) {
+            res[i] = op (l[i], r[i]);
+        }
+    }
+
     TENShPtr lnode_p;     //# left operand
     TENShPtr rnode_p;     //# right operand
 };
@@ -167,6 +167,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the size (nr of intervals).
     size_t size() const
       { return itsStarts.size(); }
+    // Get the (ordered) start and end values of the intervals.
+    // <group>
+    const std::vector<T>& starts() const
+      { return itsStarts; }
+    const std::vector<T>& ends() const
+      { return itsEnds; }
+    // </group>
     // Show the node.
     void show (ostream& os, uInt indent) const override;
     // Transform a set into an optimized one by ordering the intervals
@@ -25,6 +25,9 @@
 
 //# Includes
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/tables/TaQL/ExprDerNode.h>
+#include <casacore/tables/TaQL/ExprUDFNode.h>
+#include <casacore/tables/TaQL/ExprUDFNodeArray.h>
 #include <casacore/tables/Tables/TableError.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -65,6 +68,27 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       return colNodes;
     }
 
+    Bool getParallelColumnNodes (TableExprNodeRep* node,
+                                 std::vector<TableExprNodeColumn*>& colNodes)
+    {
+      std::vector<TableExprNodeRep*> allNodes;
+      node->flattenTree (allNodes);
+      for (auto nodeP : allNodes) {
+        TableExprNodeColumn* colNode = dynamic_cast<TableExprNodeColumn*>(nodeP);
+        if (colNode) {
+          colNodes.push_back (colNode);
+        } else if (nodeP->operType() == TableExprNodeRep::OtColumn  ||
+                   nodeP->operType() == TableExprNodeRep::OtRandom  ||
+                   nodeP->dataType() == TableExprNodeRep::NTRegex  ||
+                   nodeP->getTableInfo().isJoinTable()  ||
+                   dynamic_cast<TableExprUDFNode*>(nodeP)  ||
+                   dynamic_cast<TableExprUDFNodeArray*>(nodeP)) {
+          return False;
+        }
+      }
+      return True;
+    }
+
     std::vector<Table> getNodeTables (TableExprNodeRep* node,
                                       Bool properMain)
     {
@@ -33,6 +33,9 @@
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# Forward Declarations
+class TableExprNodeColumn;
+
 // <summary>
 // Class to handle a Regex or StringDistance.
 // </summary>
@@ -66,6 +69,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the column nodes used in the node and its children.
     std::vector<TableExprNodeRep*> getColumnNodes (TableExprNodeRep* node);
 
+    // Get the scalar column nodes used in the node and its children.
+    // They can be given a read mutex, so the expression can be evaluated
+    // by multiple threads.
+    // False is returned if that is not possible, because another node
+    // reads data or has state (e.g., an array column or random numbers).
+    Bool getParallelColumnNodes (TableExprNodeRep* node,
+                                 std::vector<TableExprNodeColumn*>& colNodes);
+
     // Get the (unique) tables used in the node and its children.
     // If <src>properMain</src> only proper main tables (i.e., tables
     // specified in the FROM clause) are returned.
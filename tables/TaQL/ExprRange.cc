@@ -137,6 +137,10 @@ void TableExprRange::mixOr (const TableExprRange& that)
         nrres++;
         j++;
     }
+    //# Nothing to combine if both are empty (e.g. contradictory ranges).
+    if (nrres == 0) {
+        return;
+    }
     //# Now combine overlapping intervals and store result in temporary.
     Vector<double> stmp(nrres);
     Vector<double> etmp(nrres);
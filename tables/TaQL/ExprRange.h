@@ -59,9 +59,11 @@ class TableColumn;
 // TableExprRange holds the ranges of values for a column as specified
 // in a table select expression.
 // It traverses the expression tree and composes the hull of the values.
-// Only double values are taken into account.
+// Only integer and double values are taken into account.
 // It can handle operators &&, ||, ==, >, >=, <, <=, !.
 // It can handle a comparison operator only for a column with a constant.
+// It can also handle IN (and BETWEEN) if the set is a constant set of
+// intervals.
 // Other operators and expressions are non-convertable.
 //
 // The ranges function in class TableExprNode returns a Block
@@ -157,6 +157,9 @@ void TaQLConstNodeRep::show (std::ostream& os) const
     // 10 digits precision in the time
     os << MVTime::Format(MVTime::YMD, 10) << itsTValue;
     break;
+  case CTParam:
+    os << '?' << itsIValue;
+    break;
   }
   if (! itsUnit.empty()) {
     os << ")'" << itsUnit << "'";
@@ -187,6 +190,9 @@ void TaQLConstNodeRep::save (AipsIO& aio) const
   case CTTime:
     aio << (double)itsTValue;
     break;
+  case CTParam:
+    aio << itsIValue;
+    break;
   }
 }
 TaQLNode TaQLConstNodeRep::restore (AipsIO& aio)
@@ -238,6 +244,14 @@ TaQLNode TaQLConstNodeRep::restore (AipsIO& aio)
       aio >> v;
       return new TaQLConstNodeRep (MVTime(v));
     }
+  case CTParam:
+    {
+      Int64 value;
+      aio >> value;
+      TaQLConstNodeRep* rep = new TaQLConstNodeRep (value);
+      rep->setIsParam();
+      return rep;
+    }
   }
   return 0;
 }
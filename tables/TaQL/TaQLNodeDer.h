@@ -65,7 +65,8 @@ public:
              CTReal   =2,
              CTComplex=3,
              CTString =4,
-             CTTime   =5};
+             CTTime   =5,
+             CTParam  =6};
   explicit TaQLConstNodeRep (Bool value);
   explicit TaQLConstNodeRep (Int64 value);
   explicit TaQLConstNodeRep (Double value);
@@ -76,6 +77,10 @@ public:
   explicit TaQLConstNodeRep (Int64 value, const String& subTableName);
   void setIsTableName()
     { itsIsTableName = True; }
+  // Turn the integer constant into placeholder ?n for a value to be bound
+  // when executing a prepared statement. The integer is the parameter number.
+  void setIsParam()
+    { itsType = CTParam; }
   const String& getString() const;
   const String& getUnit() const
     { return itsUnit; }
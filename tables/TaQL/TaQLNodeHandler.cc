@@ -45,10 +45,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   TaQLNodeResult TaQLNodeHandler::handleTree (const TaQLNode& node,
-                                  const std::vector<const Table*>& tempTables)
+                                  const std::vector<const Table*>& tempTables,
+                                  const std::vector<TableExprNode>& params)
   {
     clearStack();
     itsTempTables = tempTables;
+    itsParams     = params;
     return node.visit (*this);
   }
     
@@ -58,6 +60,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     TableParseQuery* sel = new TableParseQuery(type);
     itsStack.push_back (sel);
+    if (itsAnalyze) {
+      sel->setAnalyze (itsAnalyze, itsStack.size() - 1);
+    }
     return sel;
   }
   TableParseQuery* TaQLNodeHandler::topStack() const
@@ -101,6 +106,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     case TaQLConstNodeRep::CTTime:
       expr = TableExprNode(node.itsTValue);
       break;
+    case TaQLConstNodeRep::CTParam:
+      if (node.itsIValue < 1  ||  node.itsIValue > Int64(itsParams.size())  ||
+          itsParams[node.itsIValue - 1].isNull()) {
+        throw TableInvExpr ("No value bound to placeholder ?" +
+                            String::toString(node.itsIValue));
+      }
+      expr = itsParams[node.itsIValue - 1];
+      break;
     }
     if (! node.getUnit().empty()) {
       expr = expr.useUnit (node.getUnit());
@@ -458,6 +471,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     topStack()->handleGroupby (outnodes,
                                node.itsType==TaQLGroupNodeRep::Rollup);
+    topStack()->setNThreads (node.style().nthreads());
     return TaQLNodeResult();
   }
 
@@ -1156,6 +1170,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       TaQLNodeResult result = visitNode (node);
       const TaQLNodeHRValue& res = getHR(result);
       topStack()->handleWhere (res.getExpr());
+      topStack()->setNThreads (node.style().nthreads());
     }
   }
 
@@ -97,8 +97,17 @@ public:
 
   // Handle and process the raw parse tree.
   // The result contains a Table or TableExprNode object.
+  // The values in <src>params</src> are used for the placeholders ?n
+  // in the tree (?1 is the first element).
   TaQLNodeResult handleTree (const TaQLNode& tree,
-                             const std::vector<const Table*>&);
+                             const std::vector<const Table*>&,
+                             const std::vector<TableExprNode>& params =
+                               std::vector<TableExprNode>());
+
+  // Set the object collecting the timings of the query steps, which is
+  // used by EXPLAIN ANALYZE.
+  void setAnalyze (const std::shared_ptr<TableParseAnalyze>& analyze)
+    { itsAnalyze = analyze; }
 
   // Define the functions to visit each node type.
   // <group>
@@ -207,6 +216,10 @@ private:
   std::vector<TableParseQuery*> itsStack;
   //# The temporary tables referred to by $i in the TaQL string.
   std::vector<const Table*> itsTempTables;
+  //# The values bound to the placeholders ?i in the TaQL string.
+  std::vector<TableExprNode> itsParams;
+  //# The collector of timings for EXPLAIN ANALYZE (null if not used).
+  std::shared_ptr<TableParseAnalyze> itsAnalyze;
 };
 
 
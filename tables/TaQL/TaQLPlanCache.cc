@@ -0,0 +1,115 @@
+//# TaQLPlanCache.cc: LRU cache of parsed TaQL commands
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/TaQL/TaQLPlanCache.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TaQLPlanCache::TaQLPlanCache (size_t maxSize)
+  : itsMaxSize (maxSize),
+    nhit_p     (0),
+    nmiss_p    (0)
+{}
+
+TaQLPlanCache& TaQLPlanCache::global()
+{
+  static TaQLPlanCache cache;
+  return cache;
+}
+
+TaQLNode TaQLPlanCache::get (const String& command)
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    std::map<String, LRUList::iterator>::iterator iter = itsMap.find (command);
+    if (iter != itsMap.end()) {
+      // Make it the most recently used one.
+      itsList.splice (itsList.begin(), itsList, iter->second);
+      nhit_p++;
+      return iter->second->second;
+    }
+    nmiss_p++;
+  }
+  // Parse without holding the lock (parsing is serialized by TaQLNode).
+  TaQLNode tree = TaQLNode::parse (command);
+  std::lock_guard<std::mutex> lock(itsMutex);
+  // Another thread might have added it in the meantime.
+  if (itsMaxSize > 0  &&  itsMap.find (command) == itsMap.end()) {
+    shrink (itsMaxSize - 1);
+    itsList.push_front (std::make_pair (command, tree));
+    itsMap[command] = itsList.begin();
+  }
+  return tree;
+}
+
+void TaQLPlanCache::setMaxSize (size_t maxSize)
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  itsMaxSize = maxSize;
+  shrink (maxSize);
+}
+
+size_t TaQLPlanCache::maxSize() const
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  return itsMaxSize;
+}
+
+size_t TaQLPlanCache::size() const
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  return itsList.size();
+}
+
+void TaQLPlanCache::clear()
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  shrink (0);
+}
+
+uInt64 TaQLPlanCache::nhit() const
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  return nhit_p;
+}
+
+uInt64 TaQLPlanCache::nmiss() const
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  return nmiss_p;
+}
+
+void TaQLPlanCache::shrink (size_t size)
+{
+  while (itsList.size() > size) {
+    itsMap.erase (itsList.back().first);
+    itsList.pop_back();
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,139 @@
+//# TaQLPlanCache.h: LRU cache of parsed TaQL commands
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TAQLPLANCACHE_H
+#define TABLES_TAQLPLANCACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/TaQLNode.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// LRU cache of parsed TaQL commands
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTaQLPreparedStatement">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TaQLNode>TaQLNode</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TaQLPlanCache keeps the raw parse trees of TaQL commands, keyed on the
+// command string. A parse tree does not depend on the tables used, so it
+// can be executed any number of times. In this way the lexing and parsing
+// of a command is done only once.
+// <br>If the cache is full, the least recently used tree is removed.
+// A command that cannot be parsed is not cached; the parse error is thrown
+// each time.
+// <p>
+// The cache can be used by multiple threads simultaneously.
+// A global cache is used by the <src>tableCommand</src> functions and by
+// class <linkto class=TaQLPreparedStatement>TaQLPreparedStatement</linkto>.
+// </synopsis>
+
+// <motivation>
+// Applications executing many (nearly) identical TaQL commands spend
+// much of the time in parsing the commands if the result sets are small.
+// </motivation>
+
+// <example>
+// <srcblock>
+//   // Allow up to 256 commands in the global cache.
+//   TaQLPlanCache::global().setMaxSize (256);
+//   TaQLNode tree = TaQLPlanCache::global().get ("select from my.ms");
+// </srcblock>
+// </example>
+
+class TaQLPlanCache
+{
+public:
+  // Create a cache holding at most <src>maxSize</src> parse trees.
+  explicit TaQLPlanCache (size_t maxSize = 64);
+
+  // Copying is not possible.
+  // <group>
+  TaQLPlanCache (const TaQLPlanCache&) = delete;
+  TaQLPlanCache& operator= (const TaQLPlanCache&) = delete;
+  // </group>
+
+  // Get the global cache.
+  static TaQLPlanCache& global();
+
+  // Get the parse tree of the command.
+  // The command is parsed and added to the cache if not found.
+  TaQLNode get (const String& command);
+
+  // Set the maximum number of parse trees in the cache.
+  // 0 means that no parse trees are cached.
+  // Least recently used trees are removed if the cache is too large.
+  void setMaxSize (size_t maxSize);
+
+  // Get the maximum number of parse trees in the cache.
+  size_t maxSize() const;
+
+  // Get the number of parse trees in the cache.
+  size_t size() const;
+
+  // Remove all parse trees from the cache.
+  void clear();
+
+  // Get the number of commands found and not found in the cache.
+  // <group>
+  uInt64 nhit() const;
+  uInt64 nmiss() const;
+  // </group>
+
+private:
+  typedef std::list<std::pair<String,TaQLNode>> LRUList;
+
+  // Remove least recently used trees until the given size is reached.
+  // The mutex must be locked by the caller.
+  void shrink (size_t size);
+
+  //# Data members.
+  mutable std::mutex itsMutex;
+  size_t  itsMaxSize;
+  // The trees with the most recently used first.
+  LRUList itsList;
+  std::map<String, LRUList::iterator> itsMap;
+  uInt64  nhit_p;
+  uInt64  nmiss_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
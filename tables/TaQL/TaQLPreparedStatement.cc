@@ -0,0 +1,114 @@
+//# TaQLPreparedStatement.cc: TaQL command parsed once and executed repeatedly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/TaQL/TaQLPreparedStatement.h>
+#include <casacore/tables/TaQL/TaQLPlanCache.h>
+#include <casacore/tables/TaQL/TaQLNodeHandler.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/iostream.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TaQLPreparedStatement::TaQLPreparedStatement (const String& command)
+  : itsCommand (command)
+{
+  Timer timer;
+  itsTree = TaQLPlanCache::global().get (command);
+  itsParseTime = timer.real();
+}
+
+void TaQLPreparedStatement::bind (uInt index, const TableExprNode& value)
+{
+  if (index == 0) {
+    throw TableInvExpr ("Placeholder numbers start at 1 (?1)");
+  }
+  if (value.isNull()  ||  ! value.getRep()->isConstant()) {
+    throw TableInvExpr ("Value bound to placeholder ?" +
+                        String::toString(index) + " must be a constant");
+  }
+  if (index > itsParams.size()) {
+    itsParams.resize (index);
+  }
+  itsParams[index-1] = value;
+}
+
+TaQLResult TaQLPreparedStatement::execute() const
+{
+  std::vector<const Table*> tmp;
+  return execute (tmp);
+}
+
+TaQLResult TaQLPreparedStatement::execute
+(const std::vector<const Table*>& tempTables) const
+{
+  Vector<String> cols;
+  String commandType;
+  return execute (tempTables, cols, commandType);
+}
+
+TaQLResult TaQLPreparedStatement::execute
+(const std::vector<const Table*>& tempTables,
+ Vector<String>& cols,
+ String& commandType) const
+{
+  commandType = "error";
+  // Process the raw tree and get the final ParseSelect object.
+  Timer timer;
+  try {
+    TaQLNodeHandler treeHandler;
+    std::shared_ptr<TableParseAnalyze> analyze;
+    if (itsTree.style().doAnalyze()) {
+      analyze.reset (new TableParseAnalyze());
+      analyze->addPhase ("Parse", 0, itsParseTime, 0, 0);
+      treeHandler.setAnalyze (analyze);
+    }
+    TaQLNodeResult res = treeHandler.handleTree (itsTree, tempTables,
+                                                 itsParams);
+    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
+    commandType = hrval.getString();
+    TableExprNode expr = hrval.getExpr();
+    if (itsTree.style().doTiming()) {
+      timer.show (" Total time   ");
+    }
+    if (analyze) {
+      analyze->show (cout);
+    }
+    if (! expr.isNull()) {
+      return TaQLResult(expr);                 // result of CALC command
+    }
+    //# Copy the possibly selected column names.
+    cols.reference (hrval.getNames());
+    return TaQLResult(hrval.getTable());
+  } catch (std::exception& x) {
+    throw TableParseError ("'" + itsCommand + "'\n  " + x.what());
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,141 @@
+//# TaQLPreparedStatement.h: TaQL command parsed once and executed repeatedly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TAQLPREPAREDSTATEMENT_H
+#define TABLES_TAQLPREPAREDSTATEMENT_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/TaQLNode.h>
+#include <casacore/tables/TaQL/TaQLResult.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Table;
+
+
+// <summary>
+// TaQL command parsed once and executed repeatedly
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTaQLPreparedStatement">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto group=TableParse.h#tableCommand>tableCommand</linkto>
+//   <li> <linkto class=TaQLPlanCache>TaQLPlanCache</linkto>
+// </prerequisite>
+
+// <synopsis>
+// A prepared statement is a TaQL command that is parsed once and can be
+// executed many times. The command can contain placeholders
+// <src>?1</src>, <src>?2</src>, etc. in its expressions. Before executing
+// the command, a value has to be bound to each placeholder used. A value is
+// a constant TableExprNode, thus it can be a scalar or an array.
+// A placeholder can be used multiple times in a command.
+// <br>The parse tree is taken from the global
+// <linkto class=TaQLPlanCache>TaQLPlanCache</linkto>, so creating a
+// prepared statement for a command used before is cheap as well.
+// <p>
+// Note that the names of tables and columns cannot be given by
+// placeholders, because they are resolved when the command is executed.
+// For the same reason, the tables used in a command can be changed between
+// executions.
+// <br>The <src>execute</src> functions can be used by multiple threads
+// simultaneously, but binding values cannot be done at the same time.
+// <p>
+// If the command is given with EXPLAIN ANALYZE (or style ANALYZE), the
+// timings of the parse and of the steps of the query are shown on cout
+// after executing it (see <linkto class=TableParseAnalyze>
+// TableParseAnalyze</linkto>).
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   TaQLPreparedStatement stmt ("select from my.ms where ANTENNA1 == ?1"
+//                               " && TIME > ?2");
+//   for (Int ant=0; ant<10; ++ant) {
+//     stmt.bind (1, ant);
+//     stmt.bind (2, startTime);
+//     Table sel = stmt.execute().table();
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Services executing many nearly identical selections spend most of
+// the time in parsing the commands if the result sets are small.
+// </motivation>
+
+class TaQLPreparedStatement
+{
+public:
+  // Parse the TaQL command (if not in the plan cache yet).
+  // An exception is thrown if the command cannot be parsed.
+  explicit TaQLPreparedStatement (const String& command);
+
+  // Get the command.
+  const String& command() const
+    { return itsCommand; }
+
+  // Bind a value to placeholder ?index (1-relative).
+  // An exception is thrown if the value is not a constant.
+  void bind (uInt index, const TableExprNode& value);
+
+  // Remove the values bound to the placeholders.
+  void clearBindings()
+    { itsParams.clear(); }
+
+  // Execute the command with the values bound to the placeholders.
+  // Temporary tables can be used in the command using the $nnn syntax.
+  // The command type and the selected or updated column names can be
+  // returned as in <src>tableCommand</src>.
+  // <group>
+  TaQLResult execute() const;
+  TaQLResult execute (const std::vector<const Table*>& tempTables) const;
+  TaQLResult execute (const std::vector<const Table*>& tempTables,
+                      Vector<String>& columnNames,
+                      String& commandType) const;
+  // </group>
+
+private:
+  String                     itsCommand;
+  TaQLNode                   itsTree;
+  std::vector<TableExprNode> itsParams;
+  Double                     itsParseTime;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -35,7 +35,9 @@ TaQLStyle::TaQLStyle (uInt origin)
     itsEndExcl   (False),
     itsCOrder    (False),
     itsDoTiming  (False),
-    itsDoTracing (False)
+    itsDoTracing (False),
+    itsDoAnalyze (False),
+    itsNThreads  (1)
 {
   // Define mscal as a synonym for derivedmscal.
   defineSynonym ("mscal", "derivedmscal");
@@ -73,6 +75,14 @@ void TaQLStyle::set (const String& value)
     itsDoTracing = True;
   } else if (val == "NOTRACE") {
     itsDoTracing = False;
+  } else if (val == "ANALYZE") {
+    itsDoAnalyze = True;
+  } else if (val == "NOANALYZE") {
+    itsDoAnalyze = False;
+  } else if (val == "PARALLEL") {
+    itsNThreads = 0;
+  } else if (val == "NOPARALLEL") {
+    itsNThreads = 1;
   } else {
     throw TableError(value + " is an invalid TaQL STYLE value");
   }
@@ -83,6 +93,8 @@ void TaQLStyle::reset()
   set ("GLISH");
   itsDoTiming  = False;
   itsDoTracing = False;
+  itsDoAnalyze = False;
+  itsNThreads  = 1;
 }
 
 void TaQLStyle::defineSynonym (const String& synonym, const String& udfLibName)
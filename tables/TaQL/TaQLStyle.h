@@ -53,6 +53,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //
 // The class is also used to tell the TaQL execution engine if timings
 // or tracing of the various parts of the TaQL command need to be done.
+// Furthermore it tells how many threads can be used to evaluate the
+// WHERE clause. By default it is done serially.
 //
 // Finally it is possible to define synonyms for UDF library names.
 // For example, 'derivedmscal' is a lot to type, so a synonym 'mscal'
@@ -71,6 +73,9 @@ public:
   // Set the style according to the (case-insensitive) value.
   // Possible values are Glish, Python, Base0, Base1, FortranOrder, Corder,
   // InclEnd, and ExclEnd.
+  // Furthermore Time, NoTime, Trace, NoTrace, Analyze, NoAnalyze,
+  // Parallel (use as many threads as OpenMP allows), and NoParallel
+  // can be given.
   void set (const String& value);
 
   // Define a UDF library name synonym.
@@ -113,12 +118,33 @@ public:
   Bool doTracing() const
     { return itsDoTracing; }
 
+  // Set if the query needs to be analyzed. It means that the time spent
+  // and number of rows processed are shown for each phase and for each
+  // node of its expressions.
+  void setAnalyze (Bool doAnalyze)
+    { itsDoAnalyze = doAnalyze; }
+
+  // Should the query be analyzed?
+  Bool doAnalyze() const
+    { return itsDoAnalyze; }
+
+  // Set the number of threads to use for the WHERE and GROUPBY clauses.
+  // 0 means as many as OpenMP allows; 1 means serial evaluation.
+  void setNThreads (uInt nthreads)
+    { itsNThreads = nthreads; }
+
+  // Get the number of threads to use for the WHERE and GROUPBY clauses.
+  uInt nthreads() const
+    { return itsNThreads; }
+
 private:
   uInt itsOrigin;
   Bool itsEndExcl;
   Bool itsCOrder;
   Bool itsDoTiming;
   Bool itsDoTracing;
+  Bool itsDoAnalyze;
+  uInt itsNThreads;
   std::map<String,String> itsUDFLibNameMap;
 };
 
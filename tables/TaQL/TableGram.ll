@@ -115,6 +115,8 @@ INTERSECT [Ii][Nn][Tt][Ee][Rr][Ss][Ee][Cc][Tt]
 EXCEPT    ([Ee][Xx][Cc][Ee][Pp][Tt])|([Mm][Ii][Nn][Uu][Ss])
 STYLE     [Uu][Ss][Ii][Nn][Gg]{WHITE}[Ss][Tt][Yy][Ll][Ee]{WHITE1}
 TIMEWORD  [Tt][Ii][Mm][Ee]
+ANALYZEWORD [Aa][Nn][Aa][Ll][Yy][Zz][Ee]
+EXPLAIN   [Ee][Xx][Pp][Ll][Aa][Ii][Nn]{WHITE1}+{ANALYZEWORD}
 SHOW      ([Ss][Hh][Oo][Ww])|([Hh][Ee][Ll][Pp])
 WITH      [Ww][Ii][Tt][Hh]
 TABLE     [Tt][Aa][Bb][Ll][Ee]
@@ -193,6 +195,8 @@ NAME      \\?[A-Za-z_]([A-Za-z_0-9]|(\\.))*
 NAMEFLD   ({NAME}".")?{NAME}?("::")?{NAME}("."{NAME})*
 /* A temporary table name can be followed by field names */
 TEMPTAB   [$]{INT}(("."{NAME})?("::"{NAME}("."{NAME})*)*)
+/* A placeholder for a value bound to a prepared statement */
+PARAM     "?"{INT}
 /* A table name can contain about every character
    (but is recognized in specific states only).
    It can be a mix of quoted and unquoted strings (with escaped characters).
@@ -627,6 +631,15 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
             TaQLNode::theirNodesCreated.push_back (lvalp->val);
             return LITERAL;
           }
+<EXPRstate>{PARAM} {
+            tableGramPosition() += yyleng;
+            Int64 v = atoi(TableGramtext+1);
+            TaQLConstNodeRep* rep = new TaQLConstNodeRep (v);
+            rep->setIsParam();
+            lvalp->val = new TaQLConstNode(rep);
+            TaQLNode::theirNodesCreated.push_back (lvalp->val);
+            return LITERAL;
+          }
 {TRUE}    {
             tableGramPosition() += yyleng;
             lvalp->val = new TaQLConstNode(new TaQLConstNodeRep (True));
@@ -674,7 +687,7 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
 
  /* In most states the word TIME is a normal column or function name.
     Otherwise it is the TIME keyword (to show timings).
-    The same for SHOW.
+    The same for ANALYZE (which can be given as EXPLAIN ANALYZE) and SHOW.
  */
 <EXPRstate,TABLENAMEstate>{TIMEWORD} { 
             tableGramPosition() += yyleng;
@@ -687,6 +700,17 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
             tableGramPosition() += yyleng;
             return TIMING;
           }
+<EXPRstate,TABLENAMEstate>{ANALYZEWORD} { 
+            tableGramPosition() += yyleng;
+            lvalp->val = new TaQLConstNode(
+                new TaQLConstNodeRep (tableGramRemoveEscapes (TableGramtext)));
+            TaQLNode::theirNodesCreated.push_back (lvalp->val);
+            return NAME;
+          }
+{ANALYZEWORD}|{EXPLAIN} {
+            tableGramPosition() += yyleng;
+            return ANALYZE;
+          }
 <EXPRstate,TABLENAMEstate>{SHOW} { 
             tableGramPosition() += yyleng;
             lvalp->val = new TaQLConstNode(
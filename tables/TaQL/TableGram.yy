@@ -43,6 +43,7 @@ Expect them, so bison does not generate an error message.
 /* Define the terminals (tokens returned by flex), if needed with their type */
 %token STYLE
 %token TIMING
+%token ANALYZE
 %token SHOW
 %token SELECT
 %token UPDATE
@@ -280,20 +281,23 @@ topcomm:   topcomm1
          | topcomm1 SEMICOL
          ;
 
-/* A command can be preceded by the TIME keyword and style arguments */
+/* A command can be preceded by the TIME or ANALYZE keyword and style
+   arguments */
 topcomm1:  command
          | sttimcoms command
          ;
 
-sttimcoms: TIMING
-             { TaQLNode::theirStyle.setTiming (True); }
+sttimcoms: timing
          | stylecoms
-         | stylecoms TIMING
-             { TaQLNode::theirStyle.setTiming (True); }
-         | TIMING stylecoms
-             { TaQLNode::theirStyle.setTiming (True); }
-         | stylecoms TIMING stylecoms
+         | stylecoms timing
+         | timing stylecoms
+         | stylecoms timing stylecoms
+         ;
+
+timing:    TIMING
              { TaQLNode::theirStyle.setTiming (True); }
+         | ANALYZE
+             { TaQLNode::theirStyle.setAnalyze (True); }
          ;
 
 /* Multiple STYLE commands can be given */
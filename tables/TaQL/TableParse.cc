@@ -24,12 +24,8 @@
 //#                        Charlottesville, VA 22903-2475 USA
 
 #include <casacore/tables/TaQL/TableParse.h>
-#include <casacore/tables/TaQL/TaQLNode.h>
-#include <casacore/tables/TaQL/TaQLNodeHandler.h>
-#include <casacore/tables/TaQL/ExprNode.h>
-#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/TaQL/TaQLPreparedStatement.h>
 #include <casacore/casa/Arrays/Vector.h>
-#include <casacore/casa/OS/Timer.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -76,35 +72,15 @@ TaQLResult tableCommand (const String& str,
 }
 
 //# Do the actual parsing of a command and execute it.
+//# The parse tree is taken from the plan cache if the command was used before.
 TaQLResult tableCommand (const String& str,
                          const std::vector<const Table*>& tempTables,
                          Vector<String>& cols,
                          String& commandType)
 {
   commandType = "error";
-  // Do the first parse step. It returns a raw parse tree
-  // (or throws an exception).
-  Timer timer;
-  TaQLNode tree = TaQLNode::parse(str);
-  // Now process the raw tree and get the final ParseSelect object.
-  try {
-    TaQLNodeHandler treeHandler;
-    TaQLNodeResult res = treeHandler.handleTree (tree, tempTables);
-    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
-    commandType = hrval.getString();
-    TableExprNode expr = hrval.getExpr();
-    if (tree.style().doTiming()) {
-      timer.show (" Total time   ");
-    }
-    if (! expr.isNull()) {
-      return TaQLResult(expr);                 // result of CALC command
-    }
-    //# Copy the possibly selected column names.
-    cols.reference (hrval.getNames());
-    return TaQLResult(hrval.getTable());
-  } catch (std::exception& x) {
-    throw TableParseError ("'" + str + "'\n  " + x.what());
-  }
+  TaQLPreparedStatement command(str);
+  return command.execute (tempTables, cols, commandType);
 }
 
 } //# NAMESPACE CASACORE - END
@@ -47,6 +47,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // column names can be returned.
   // Zero or more temporary tables can be used in the command
   // using the $nnn syntax.
+  // <br>The parse tree of the command is kept in the global
+  // <linkto class=TaQLPlanCache>TaQLPlanCache</linkto>, so the command
+  // is not parsed again if executed multiple times. Use class
+  // <linkto class=TaQLPreparedStatement>TaQLPreparedStatement</linkto>
+  // to execute a command with placeholders for values.
   // </synopsis>
   // <group name=tableCommand>
   TaQLResult tableCommand (const String& command);
@@ -0,0 +1,321 @@
+//# TableParseAnalyze.cc: Collect the timings of the steps of a TaQL command
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/tables/TaQL/TableParseAnalyze.h>
+#include <casacore/tables/TaQL/ExprNodeRep.h>
+#include <casacore/tables/TaQL/ExprDerNode.h>
+#include <casacore/tables/TaQL/ExprNodeArray.h>
+#include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/tables/TaQL/MArray.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Utilities/ValType.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/iostream.h>
+#include <casacore/casa/iomanip.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  // The number of rows evaluated at once for scalar nodes.
+  static const rownr_t theBlockSize = 1024;
+
+
+  void TableParseAnalyze::addPhase (const String& name, uInt level,
+                                    Double time,
+                                    rownr_t nrowIn, rownr_t nrowOut)
+  {
+    itsPhases.push_back (Phase{name, level, time, nrowIn, nrowOut});
+  }
+
+  void TableParseAnalyze::addExpr (const String& name, uInt level,
+                                   const TableExprNode& expr,
+                                   const Vector<rownr_t>& rownrs)
+  {
+    if (expr.isNull()  ||
+        ! TableExprNodeUtil::getAggrNodes(expr.getRep().get()).empty()) {
+      return;
+    }
+    String exprName (name);
+    if (level > 0) {
+      exprName += " (level " + String::toString(level) + ')';
+    }
+    // The tree is flattened in preorder, so the subtree of a node is
+    // contiguous. Use the end of the subtrees to determine the depth.
+    std::vector<TableExprNodeRep*> nodes;
+    expr.getRep()->flattenTree (nodes);
+    std::vector<size_t> ends;
+    for (size_t i=0; i<nodes.size(); ++i) {
+      while (!ends.empty()  &&  ends.back() <= i) {
+        ends.pop_back();
+      }
+      std::vector<TableExprNodeRep*> subNodes;
+      nodes[i]->flattenTree (subNodes);
+      Node node{exprName, uInt(ends.size()), describe(*nodes[i]),
+                False, 0, 0};
+      ends.push_back (i + subNodes.size());
+      TableExprNodeRep::ValueType vtype = nodes[i]->valueType();
+      if (! nodes[i]->isConstant()  &&
+          (vtype == TableExprNodeRep::VTScalar  ||
+           vtype == TableExprNodeRep::VTArray)) {
+        uInt64 nvalues = 0;
+        uInt64 nbytes  = 0;
+        Timer timer;
+        try {
+          evaluate (*nodes[i], rownrs, nvalues, nbytes);
+          node.evaluated = True;
+          node.time      = timer.real();
+          node.nrow      = rownrs.size();
+        } catch (std::exception&) {
+          // The node cannot be evaluated on its own (e.g. it needs
+          // the result of a subquery); it is not reported.
+        }
+        if (node.evaluated  &&  nodes[i]->operType() ==
+                                TableExprNodeRep::OtColumn) {
+          addColumn (*nodes[i], rownrs.size(), nvalues, nbytes);
+        }
+      }
+      itsNodes.push_back (node);
+    }
+  }
+
+  void TableParseAnalyze::evaluate (TableExprNodeRep& node,
+                                    const Vector<rownr_t>& rownrs,
+                                    uInt64& nvalues, uInt64& nbytes)
+  {
+    nvalues = 0;
+    nbytes  = 0;
+    rownr_t nrow = rownrs.size();
+    if (node.valueType() == TableExprNodeRep::VTScalar) {
+      nvalues = nrow;
+      switch (node.dataType()) {
+      case TableExprNodeRep::NTBool:
+      case TableExprNodeRep::NTInt:
+      case TableExprNodeRep::NTDouble:
+        {
+          // Use the block evaluation like the WHERE does.
+          Vector<Bool>   bvals;
+          Vector<Int64>  ivals;
+          Vector<Double> dvals;
+          for (rownr_t st=0; st<nrow; st+=theBlockSize) {
+            rownr_t n = std::min (theBlockSize, nrow-st);
+            Vector<rownr_t> blockRows (rownrs(Slice(st, n)));
+            if (node.dataType() == TableExprNodeRep::NTBool) {
+              node.getBoolBlock (blockRows, bvals);
+            } else if (node.dataType() == TableExprNodeRep::NTInt) {
+              node.getIntBlock (blockRows, ivals);
+            } else {
+              node.getDoubleBlock (blockRows, dvals);
+            }
+          }
+        }
+        break;
+      case TableExprNodeRep::NTComplex:
+        for (rownr_t i=0; i<nrow; ++i) {
+          node.getDComplex (rownrs[i]);
+        }
+        break;
+      case TableExprNodeRep::NTString:
+        for (rownr_t i=0; i<nrow; ++i) {
+          nbytes += node.getString(rownrs[i]).size();
+        }
+        break;
+      case TableExprNodeRep::NTDate:
+        for (rownr_t i=0; i<nrow; ++i) {
+          node.getDate (rownrs[i]);
+        }
+        break;
+      default:
+        throw AipsError ("TableParseAnalyze: cannot evaluate node");
+      }
+    } else {
+      for (rownr_t i=0; i<nrow; ++i) {
+        TableExprId id(rownrs[i]);
+        if (! node.isDefined (id)) {
+          continue;
+        }
+        switch (node.dataType()) {
+        case TableExprNodeRep::NTBool:
+          nvalues += node.getArrayBool(id).size();
+          break;
+        case TableExprNodeRep::NTInt:
+          nvalues += node.getArrayInt(id).size();
+          break;
+        case TableExprNodeRep::NTDouble:
+          nvalues += node.getArrayDouble(id).size();
+          break;
+        case TableExprNodeRep::NTComplex:
+          nvalues += node.getArrayDComplex(id).size();
+          break;
+        case TableExprNodeRep::NTString:
+          {
+            MArray<String> arr (node.getArrayString(id));
+            nvalues += arr.size();
+            for (const String& str : arr.array()) {
+              nbytes += str.size();
+            }
+          }
+          break;
+        case TableExprNodeRep::NTDate:
+          nvalues += node.getArrayDate(id).size();
+          break;
+        default:
+          throw AipsError ("TableParseAnalyze: cannot evaluate node");
+        }
+      }
+    }
+  }
+
+  void TableParseAnalyze::addColumn (const TableExprNodeRep& node,
+                                     rownr_t nrow,
+                                     uInt64 nvalues, uInt64 nbytes)
+  {
+    const TableColumn* col = 0;
+    const TableExprNodeColumn* scaNode =
+      dynamic_cast<const TableExprNodeColumn*>(&node);
+    if (scaNode) {
+      col = &(scaNode->getColumn());
+    } else {
+      const TableExprNodeArrayColumn* arrNode =
+        dynamic_cast<const TableExprNodeArrayColumn*>(&node);
+      if (arrNode) {
+        col = &(arrNode->getColumn());
+      }
+    }
+    if (col == 0  ||  col->isNull()) {
+      return;
+    }
+    const ColumnDesc& cdesc = col->columnDesc();
+    // Strings have a variable size, so their length has been counted.
+    if (cdesc.dataType() != TpString) {
+      nbytes = nvalues * ValType::getTypeSize (cdesc.dataType());
+    }
+    String tabName = col->table().tableName();
+    for (Column& column : itsColumns) {
+      if (column.table == tabName  &&  column.name == cdesc.name()) {
+        column.nrow   += nrow;
+        column.nbytes += nbytes;
+        return;
+      }
+    }
+    itsColumns.push_back (Column{tabName, cdesc.name(),
+                                 cdesc.dataManagerType(), nrow, nbytes});
+  }
+
+  String TableParseAnalyze::describe (const TableExprNodeRep& node)
+  {
+    String str;
+    switch (node.operType()) {
+    case TableExprNodeRep::OtPlus:     str = "+"; break;
+    case TableExprNodeRep::OtMinus:    str = "-"; break;
+    case TableExprNodeRep::OtTimes:    str = "*"; break;
+    case TableExprNodeRep::OtDivide:   str = "/"; break;
+    case TableExprNodeRep::OtModulo:   str = "%"; break;
+    case TableExprNodeRep::OtBitAnd:   str = "&"; break;
+    case TableExprNodeRep::OtBitOr:    str = "|"; break;
+    case TableExprNodeRep::OtBitXor:   str = "^"; break;
+    case TableExprNodeRep::OtBitNegate:str = "~"; break;
+    case TableExprNodeRep::OtEQ:       str = "=="; break;
+    case TableExprNodeRep::OtGE:       str = ">="; break;
+    case TableExprNodeRep::OtGT:       str = ">"; break;
+    case TableExprNodeRep::OtNE:       str = "!="; break;
+    case TableExprNodeRep::OtIN:       str = "IN"; break;
+    case TableExprNodeRep::OtAND:      str = "AND"; break;
+    case TableExprNodeRep::OtOR:       str = "OR"; break;
+    case TableExprNodeRep::OtNOT:      str = "NOT"; break;
+    case TableExprNodeRep::OtMIN:      str = "unary -"; break;
+    case TableExprNodeRep::OtField:    str = "field"; break;
+    case TableExprNodeRep::OtLiteral:  str = "constant"; break;
+    case TableExprNodeRep::OtFunc:     str = "function"; break;
+    case TableExprNodeRep::OtSlice:    str = "slice"; break;
+    case TableExprNodeRep::OtRownr:    str = "rownr"; break;
+    case TableExprNodeRep::OtRandom:   str = "random"; break;
+    case TableExprNodeRep::OtColumn:
+      {
+        str = "column";
+        const TableExprNodeColumn* scaNode =
+          dynamic_cast<const TableExprNodeColumn*>(&node);
+        const TableExprNodeArrayColumn* arrNode =
+          dynamic_cast<const TableExprNodeArrayColumn*>(&node);
+        if (scaNode  &&  ! scaNode->getColumn().isNull()) {
+          str += ' ' + scaNode->getColumn().columnDesc().name();
+        } else if (arrNode  &&  ! arrNode->getColumn().isNull()) {
+          str += ' ' + arrNode->getColumn().columnDesc().name();
+        }
+      }
+      break;
+    default:
+      str = node.isConstant() ? "constant" : "node";
+      break;
+    }
+    return str + " (" + TableExprNodeRep::typeString(node.dataType()) + ' ' +
+      TableExprNodeRep::typeString(node.valueType()) + ')';
+  }
+
+  void TableParseAnalyze::show (ostream& os) const
+  {
+    os << "Analysis of TaQL command" << endl;
+    os << "  Phase                   Time(s)       Rows in      Rows out"
+       << endl;
+    for (const Phase& phase : itsPhases) {
+      String name (String(2*phase.level, ' ') + phase.name);
+      os << "  " << std::left << std::setw(18) << name << std::right
+         << std::fixed << std::setprecision(6) << std::setw(14) << phase.time
+         << std::setw(14) << phase.nrowIn << std::setw(14) << phase.nrowOut
+         << endl;
+    }
+    String lastExpr;
+    for (const Node& node : itsNodes) {
+      if (node.expr != lastExpr) {
+        lastExpr = node.expr;
+        os << "Expression " << lastExpr << endl;
+        os << "        Time(s)          Rows  Node" << endl;
+      }
+      if (node.evaluated) {
+        os << std::fixed << std::setprecision(6) << std::setw(15) << node.time
+           << std::setw(14) << node.nrow;
+      } else {
+        os << std::setw(15) << '-' << std::setw(14) << '-';
+      }
+      os << "  " << String(2*node.depth, ' ') << node.description << endl;
+    }
+    if (! itsColumns.empty()) {
+      os << "Columns read" << endl;
+      for (const Column& column : itsColumns) {
+        os << "  " << column.name << " (" << column.dataManager << " in "
+           << column.table << "): " << column.nrow << " rows, "
+           << column.nbytes << " bytes" << endl;
+      }
+    }
+    os.unsetf (std::ios::floatfield);
+    os << std::setprecision(6);
+  }
+
+
+} //# NAMESPACE CASACORE - END
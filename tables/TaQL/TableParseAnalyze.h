@@ -0,0 +1,148 @@
+//# TableParseAnalyze.h: Collect the timings of the steps of a TaQL command
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TABLEPARSEANALYZE_H
+#define TABLES_TABLEPARSEANALYZE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/iosfwd.h>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  // <summary>
+  // Collect the timings of the steps of a TaQL command
+  // </summary>
+
+  // <use visibility=local>
+
+  // <reviewed reviewer="" date="" tests="tTableParseAnalyze">
+  // </reviewed>
+
+  // <synopsis>
+  // An object of this class is used if a TaQL command is executed with
+  // EXPLAIN ANALYZE (or style ANALYZE). It collects for each phase of the
+  // command (parse, where, groupby, orderby, projection, giving, etc.)
+  // the wall time used and the number of rows going in and out.
+  // Phases of nested queries are marked with their nesting level.
+  // <p>
+  // Furthermore, it records the expression trees evaluated in the phases
+  // (e.g., the WHERE expression and the sort keys). For each node in such
+  // a tree, the number of rows and the wall time spent in the node and
+  // its children are given. They are measured by evaluating the subtree
+  // of each node on its own for the rows processed in the phase, so the
+  // time of a node includes the time of its children. Note that it means
+  // that the query expressions are evaluated again, which can take a
+  // while for large tables.
+  // <br>
+  // For the column nodes, the number of bytes read from the column's data
+  // manager is accumulated. It is the size of the values read, thus
+  // excluding overhead of the storage manager (such as compression).
+  // </synopsis>
+
+  class TableParseAnalyze
+  {
+  public:
+    // A phase of a command.
+    struct Phase {
+      String  name;
+      uInt    level;
+      Double  time;
+      rownr_t nrowIn;
+      rownr_t nrowOut;
+    };
+    // A node of an analyzed expression.
+    struct Node {
+      String  expr;          // name of the expression (e.g. WHERE)
+      uInt    depth;         // depth of node in the expression tree
+      String  description;
+      Bool    evaluated;     // could the node be evaluated on its own?
+      Double  time;
+      rownr_t nrow;
+    };
+    // A column read by an analyzed expression.
+    struct Column {
+      String  table;
+      String  name;
+      String  dataManager;
+      rownr_t nrow;
+      uInt64  nbytes;
+    };
+
+    TableParseAnalyze()
+    {}
+
+    // Add the timing of a phase.
+    void addPhase (const String& name, uInt level, Double time,
+                   rownr_t nrowIn, rownr_t nrowOut);
+
+    // Analyze an expression by evaluating each node for the given rows.
+    // Nothing is done for an expression containing aggregate functions,
+    // because they can only be evaluated in a GROUPBY.
+    void addExpr (const String& name, uInt level,
+                  const TableExprNode& expr, const Vector<rownr_t>& rownrs);
+
+    // Get the phases, nodes and columns.
+    // <group>
+    const std::vector<Phase>& phases() const
+      { return itsPhases; }
+    const std::vector<Node>& nodes() const
+      { return itsNodes; }
+    const std::vector<Column>& columns() const
+      { return itsColumns; }
+    // </group>
+
+    // Show the results.
+    void show (ostream& os) const;
+
+    // Get the description of a node (operator or column name and types).
+    static String describe (const TableExprNodeRep& node);
+
+  private:
+    // Evaluate a node for the given rows and return the nr of values
+    // and the nr of bytes (for strings) obtained.
+    static void evaluate (TableExprNodeRep& node,
+                          const Vector<rownr_t>& rownrs,
+                          uInt64& nvalues, uInt64& nbytes);
+
+    // Add the bytes read for a column node.
+    void addColumn (const TableExprNodeRep& node, rownr_t nrow,
+                    uInt64 nvalues, uInt64 nbytes);
+
+    //# Data members.
+    std::vector<Phase>  itsPhases;
+    std::vector<Node>   itsNodes;
+    std::vector<Column> itsColumns;
+  };
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -29,7 +29,12 @@
 #include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/TaQL/TableExprIdAggr.h>
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/tables/TaQL/ExprDerNode.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/OS/OMP.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
 
 using namespace std;
 
@@ -134,7 +139,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   std::shared_ptr<TableExprGroupResult> TableParseGroupby::execGroupAggr
-  (Vector<rownr_t>& rownrs) const
+  (Vector<rownr_t>& rownrs, uInt nthreads) const
   {
     // If only 'select count(*)' was given, get the size of the WHERE,
     // thus the size of rownrs_p.
@@ -142,7 +147,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         (itsGroupAggrUsed & GROUPBY) == 0) {
       return countAll (rownrs);
     }
-    return aggregate (rownrs);
+    return aggregate (rownrs, nthreads);
   }
 
   Bool TableParseGroupby::execHaving
@@ -168,7 +173,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   std::shared_ptr<TableExprGroupResult> TableParseGroupby::aggregate
-  (Vector<rownr_t>& rownrs) const
+  (Vector<rownr_t>& rownrs, uInt nthreads) const
   {
     // Get the aggregate functions to be evaluated lazily.
     std::vector<TableExprNodeRep*> immediateNodes;
@@ -195,15 +200,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       immediateNodes.push_back (&expridNode);
     }
     std::vector<std::shared_ptr<TableExprGroupFuncSet>> funcSets;
-    // Use a faster way for a single groupby key.
-    if (itsGroupbyNodes.size() == 1  &&
-        itsGroupbyNodes[0].dataType() == TpDouble) {
-      funcSets = singleKey<Double> (immediateNodes, rownrs);
-    } else if (itsGroupbyNodes.size() == 1  &&
-               itsGroupbyNodes[0].dataType() == TpInt) {
-      funcSets = singleKey<Int64> (immediateNodes, rownrs);
-    } else {
-      funcSets = multiKey (immediateNodes, rownrs);
+    // Lazy functions need all ids of a group, so cannot be done in parallel.
+    if (nthreads == 1  ||  ! lazyNodes.empty()  ||
+        ! parallelKey (immediateNodes, rownrs, nthreads, funcSets)) {
+      // Use a faster way for a single groupby key.
+      if (itsGroupbyNodes.size() == 1  &&
+          itsGroupbyNodes[0].dataType() == TpDouble) {
+        funcSets = singleKey<Double> (immediateNodes, rownrs);
+      } else if (itsGroupbyNodes.size() == 1  &&
+                 itsGroupbyNodes[0].dataType() == TpInt) {
+        funcSets = singleKey<Int64> (immediateNodes, rownrs);
+      } else {
+        funcSets = multiKey (immediateNodes, rownrs);
+      }
     }
     // Let the function nodes finish their operation.
     // Form the rownr vector from the rows kept in the aggregate objects.
@@ -282,5 +291,111 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return funcSets;
   }
 
+  Bool TableParseGroupby::parallelKey
+  (const std::vector<TableExprNodeRep*>& nodes, const Vector<rownr_t>& rownrs,
+   uInt nthreads,
+   std::vector<std::shared_ptr<TableExprGroupFuncSet>>& funcSets) const
+  {
+    if (nthreads == 0) {
+      nthreads = OMP::maxThreads();
+    }
+    // Each thread should aggregate a reasonable number of rows.
+    const rownr_t minChunkSize = 1024;
+    rownr_t nrow = rownrs.size();
+    rownr_t nchunk = std::min (rownr_t(nthreads), nrow / minChunkSize);
+    if (nchunk <= 1) {
+      return False;
+    }
+    // All aggregate functions must be able to merge partial results.
+    // Only scalar column nodes can read data; they are given a mutex.
+    std::vector<TableExprNodeColumn*> colNodes;
+    for (TableExprNodeRep* node : nodes) {
+      if (! node->makeGroupAggrFunc()->isMergeable()  ||
+          ! TableExprNodeUtil::getParallelColumnNodes (node, colNodes)) {
+        return False;
+      }
+    }
+    for (const TableExprNode& node : itsGroupbyNodes) {
+      if (! TableExprNodeUtil::getParallelColumnNodes (node.getRep().get(),
+                                                       colNodes)) {
+        return False;
+      }
+    }
+    // Each thread groups and aggregates a contiguous part of the rows.
+    // It keeps the keys of its groups in order of first occurrence.
+    rownr_t chunkSize = (nrow + nchunk - 1) / nchunk;
+    std::vector<std::vector<TableExprGroupKeySet>> partKeys(nchunk);
+    std::vector<std::vector<std::shared_ptr<TableExprGroupFuncSet>>> partSets(nchunk);
+    std::mutex readMutex;
+    for (TableExprNodeColumn* colNode : colNodes) {
+      colNode->setReadMutex (&readMutex);
+    }
+    String errorMsg;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(nchunk)
+#endif
+    for (Int64 chunk=0; chunk<Int64(nchunk); ++chunk) {
+      try {
+        std::vector<TableExprGroupKeySet>& keys = partKeys[chunk];
+        std::vector<std::shared_ptr<TableExprGroupFuncSet>>& sets = partSets[chunk];
+        std::map<TableExprGroupKeySet, Int> keyFuncMap;
+        TableExprGroupKeySet keySet(itsGroupbyNodes);
+        TableExprId rowid(0);
+        rownr_t end = std::min (nrow, (chunk+1) * chunkSize);
+        for (rownr_t i=chunk*chunkSize; i<end; ++i) {
+          rowid.setRownr (rownrs[i]);
+          keySet.fill (itsGroupbyNodes, rowid);
+          Int groupnr = sets.size();
+          std::map<TableExprGroupKeySet, Int>::iterator iter=keyFuncMap.find (keySet);
+          if (iter == keyFuncMap.end()) {
+            keyFuncMap[keySet] = groupnr;
+            keys.push_back (keySet);
+            // Making the function objects changes the aggregate nodes.
+#ifdef _OPENMP
+#pragma omp critical(TableParseGroupby_parallelKey_makeFuncs)
+#endif
+            {
+              sets.push_back (std::make_shared<TableExprGroupFuncSet>(nodes));
+            }
+          } else {
+            groupnr = iter->second;
+          }
+          sets[groupnr]->apply (rowid);
+        }
+      } catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(TableParseGroupby_parallelKey_error)
+#endif
+        {
+          if (errorMsg.empty()) {
+            errorMsg = x.what();
+          }
+        }
+      }
+    }
+    for (TableExprNodeColumn* colNode : colNodes) {
+      colNode->setReadMutex (0);
+    }
+    if (! errorMsg.empty()) {
+      throw AipsError (errorMsg);
+    }
+    // Merge the partial results in order of the parts, so the groups are
+    // ordered and get the last row of the group as done serially.
+    std::map<TableExprGroupKeySet, Int> keyFuncMap;
+    for (rownr_t chunk=0; chunk<nchunk; ++chunk) {
+      for (size_t j=0; j<partSets[chunk].size(); ++j) {
+        std::map<TableExprGroupKeySet, Int>::iterator iter =
+          keyFuncMap.find (partKeys[chunk][j]);
+        if (iter == keyFuncMap.end()) {
+          keyFuncMap[partKeys[chunk][j]] = funcSets.size();
+          funcSets.push_back (partSets[chunk][j]);
+        } else {
+          funcSets[iter->second]->merge (*partSets[chunk][j]);
+        }
+      }
+    }
+    return True;
+  }
+
 
 } //# NAMESPACE CASACORE - END
@@ -101,7 +101,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Execute the grouping and aggregation and return the results.
     // The rownrs are adapted to the resulting rownrs consisting of the
     // first row of each group.
-    std::shared_ptr<TableExprGroupResult> execGroupAggr (Vector<rownr_t>& rownrs) const;
+    // If nthreads differs from 1, the rows are aggregated in parallel
+    // if possible (0 means use all available cores).
+    std::shared_ptr<TableExprGroupResult> execGroupAggr (Vector<rownr_t>& rownrs,
+                                                         uInt nthreads=1) const;
 
     // Execute the HAVING clause (if present).
     // Return False in no HAVING.
@@ -113,7 +116,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // It distinguishes the immediate and lazy aggregate functions.
     // The rownrs are adapted to the resulting rownrs consisting of the
     // first row of each group.
-    std::shared_ptr<TableExprGroupResult> aggregate (Vector<rownr_t>& rownrs) const;
+    std::shared_ptr<TableExprGroupResult> aggregate (Vector<rownr_t>& rownrs,
+                                                     uInt nthreads) const;
 
     // Do the grouping and aggregation and return the results.
     // It consists of a single COUNTALL operation.
@@ -125,6 +129,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     std::vector<std::shared_ptr<TableExprGroupFuncSet>> multiKey
     (const std::vector<TableExprNodeRep*>&, const Vector<rownr_t>& rownrs) const;
 
+    // Create the set of aggregate functions and groupby keys using
+    // multiple threads. Each thread aggregates a contiguous part of the rows,
+    // after which the partial results are merged.
+    // False is returned if that is not possible, because an aggregate
+    // function cannot merge partial results or because an expression cannot
+    // be evaluated by multiple threads.
+    Bool parallelKey (const std::vector<TableExprNodeRep*>&,
+                      const Vector<rownr_t>& rownrs, uInt nthreads,
+                      std::vector<std::shared_ptr<TableExprGroupFuncSet>>& funcSets) const;
+
     // Create the set of aggregate functions and groupby keys in case
     // a single groupby key is given.
     // This offers much faster map access then the general multipleKeys.
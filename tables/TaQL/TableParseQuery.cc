@@ -42,6 +42,7 @@
 #include <casacore/tables/Tables/TableIter.h>
 #include <casacore/tables/Tables/TableRow.h>
 #include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/ColumnsIndex.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/tables/Tables/ScaColDesc.h>
@@ -57,8 +58,12 @@
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/ostream.h>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -73,6 +78,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       endianFormat_p  (Table::AipsrcEndian),
       overwrite_p     (True),
       resultSet_p     (0),
+      nthreads_p      (1),
+      analyzeLevel_p  (0),
       distinct_p      (False),
       limit_p         (0),
       endrow_p        (0),
@@ -717,6 +724,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (showTimings) {
       timer.show ("  Insert      ");
     }
+    analyzePhase ("Insert", timer.real(), sel.nrow(), tab.nrow());
     return tab;
   }
 
@@ -735,10 +743,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       throw TableInvExpr ("Table " + table.tableName() + " is not writable");
     }
     // Delete all rows.
+    rownr_t nrow = table.nrow();
     table.removeRow (rownrs_p);
     if (showTimings) {
       timer.show ("  Delete      ");
     }
+    analyzePhase ("Delete", timer.real(), nrow, rownrs_p.size());
   }
 
 
@@ -773,19 +783,399 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (showTimings) {
       timer.show ("  Count       ");
     }
+    analyzePhase ("Count", timer.real(), intab.nrow(), tab.nrow());
     return tab;
   }
 
 
-  //# Execute the groupby.
+  //# Check if the WHERE tables have the same size (as Table::operator()).
+  void TableParseQuery::checkWhereTables (const Table& table) const
+  {
+    std::vector<Table> tables
+      (TableExprNodeUtil::getNodeTables (node_p.getRep().get(), True));
+    if (! tables.empty()) {
+      if (TableExprNodeUtil::getCheckNRow(tables) != table.nrow()) {
+        throw TableInvExpr ("select expression for table " +
+                            tables[0].tableName() +
+                            " is used on a differently sized table " +
+                            table.tableName());
+      }
+    }
+  }
+
+  //# Do the WHERE selection in parallel.
+  Bool TableParseQuery::doParallelWhere (const Table& table,
+                                         const Vector<rownr_t>* rownrsIn,
+                                         uInt nthreads,
+                                         Bool doTracing, Table& result)
+  {
+    if (nthreads == 0) {
+      nthreads = OMP::maxThreads();
+    }
+    // The expression is evaluated for a block of rows at a time.
+    const rownr_t blockSize = 1024;
+    rownr_t nrow = (rownrsIn  ?  rownrsIn->size() : table.nrow());
+    if (nthreads <= 1  ||  nrow <= blockSize  ||
+        node_p.getRep()->isConstant()) {
+      return False;
+    }
+    // Only scalar column nodes can read data; they are given a mutex.
+    // Other nodes reading data or having state cannot be used by
+    // multiple threads.
+    std::vector<TableExprNodeColumn*> colNodes;
+    if (! TableExprNodeUtil::getParallelColumnNodes (node_p.getRep().get(),
+                                                     colNodes)) {
+      if (doTracing) {
+        cerr << "WHERE cannot be done in parallel" << endl;
+      }
+      return False;
+    }
+    checkWhereTables (table);
+    // Divide the rows into chunks of whole blocks, a few per thread to
+    // balance the load.
+    rownr_t nblock = (nrow + blockSize - 1) / blockSize;
+    rownr_t nchunk = std::min (nblock, rownr_t(8*nthreads));
+    rownr_t chunkSize = (nblock + nchunk - 1) / nchunk * blockSize;
+    nchunk = (nrow + chunkSize - 1) / chunkSize;
+    if (doTracing) {
+      cerr << "WHERE done in parallel using " << nthreads << " threads and "
+           << nchunk << " chunks of " << chunkSize << " rows" << endl;
+    }
+    std::vector<std::vector<rownr_t>> selRows(nchunk);
+    std::mutex readMutex;
+    for (TableExprNodeColumn* colNode : colNodes) {
+      colNode->setReadMutex (&readMutex);
+    }
+    String errorMsg;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+#endif
+    for (Int64 chunk=0; chunk<Int64(nchunk); ++chunk) {
+      try {
+        Vector<rownr_t> rownrs;
+        Vector<Bool> vals;
+        std::vector<rownr_t>& rows = selRows[chunk];
+        rownr_t end = std::min (nrow, (chunk+1) * chunkSize);
+        for (rownr_t st=chunk*chunkSize; st<end; st+=blockSize) {
+          rownr_t nr = std::min (blockSize, end-st);
+          rownrs.resize (nr);
+          if (rownrsIn) {
+            std::copy (rownrsIn->data() + st, rownrsIn->data() + st + nr,
+                       rownrs.data());
+          } else {
+            indgen (rownrs, st);
+          }
+          node_p.getRep()->getBoolBlock (rownrs, vals);
+          for (rownr_t i=0; i<nr; ++i) {
+            if (vals[i]) {
+              rows.push_back (rownrs[i]);
+            }
+          }
+        }
+      } catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(TableParseQuery_doParallelWhere)
+#endif
+        {
+          if (errorMsg.empty()) {
+            errorMsg = x.what();
+          }
+        }
+      }
+    }
+    for (TableExprNodeColumn* colNode : colNodes) {
+      colNode->setReadMutex (0);
+    }
+    if (! errorMsg.empty()) {
+      throw AipsError (errorMsg);
+    }
+    // Merge the selected rows in order.
+    rownr_t nsel = 0;
+    for (const std::vector<rownr_t>& rows : selRows) {
+      nsel += rows.size();
+    }
+    Vector<rownr_t> rownrs(nsel);
+    rownr_t* ptr = rownrs.data();
+    for (const std::vector<rownr_t>& rows : selRows) {
+      ptr = std::copy (rows.begin(), rows.end(), ptr);
+    }
+    result = table(rownrs);
+    return True;
+  }
+
+  //# Do the WHERE selection for the given rows.
+  Table TableParseQuery::doRowsWhere (const Table& table,
+                                      const Vector<rownr_t>& rownrs,
+                                      rownr_t nrmax)
+  {
+    checkWhereTables (table);
+    const rownr_t blockSize = 1024;
+    std::vector<rownr_t> rows;
+    Vector<rownr_t> blockRows;
+    Vector<Bool> vals;
+    for (rownr_t st=0; st<rownrs.size(); st+=blockSize) {
+      rownr_t nr = std::min (blockSize, rownrs.size()-st);
+      blockRows.resize (nr);
+      std::copy (rownrs.data() + st, rownrs.data() + st + nr,
+                 blockRows.data());
+      node_p.getRep()->getBoolBlock (blockRows, vals);
+      for (rownr_t i=0; i<nr; ++i) {
+        if (vals[i]) {
+          rows.push_back (blockRows[i]);
+          if (rows.size() == nrmax) {
+            return table(Vector<rownr_t>(rows));
+          }
+        }
+      }
+    }
+    return table(Vector<rownr_t>(rows));
+  }
+
+  //# Find the rows matching the ranges of the sorted columns.
+  Bool TableParseQuery::findRangeRows (const Table& table, Bool doTracing,
+                                       Vector<rownr_t>& rownrs)
+  {
+    rownr_t nrow = table.nrow();
+    if (nrow == 0  ||  node_p.getRep()->isConstant()) {
+      return False;
+    }
+    // The rows must be in the order of the underlying (non-concatenated)
+    // table to make the sort order of its columns valid.
+    if (table.getPartNames(True).size() != 1) {
+      return False;
+    }
+    if (! table.isRootTable()) {
+      Vector<rownr_t> rootRows = table.rowNumbers();
+      for (rownr_t i=1; i<rootRows.size(); ++i) {
+        if (rootRows[i] <= rootRows[i-1]) {
+          return False;
+        }
+      }
+    }
+    Block<TableExprRange> ranges;
+    node_p.ranges (ranges);
+    // The row intervals [start,end) found; initially all rows.
+    std::vector<std::pair<rownr_t,rownr_t>> intervals(1, std::make_pair(0, nrow));
+    String usedNames;
+    for (const TableExprRange& range : ranges) {
+      const TableColumn& rangeCol = range.getColumn();
+      // The column must belong to this table (not to another one in
+      // a join or subquery).
+      if (! rangeCol.table().isSameTable (table)) {
+        continue;
+      }
+      String colName = rangeCol.columnDesc().name();
+      const TableRecord& keys = rangeCol.keywordSet();
+      String order;
+      if (keys.isDefined ("SORTED")  &&  keys.dataType ("SORTED") == TpString) {
+        order = keys.asString ("SORTED");
+        order.upcase();
+      }
+      std::vector<std::pair<rownr_t,rownr_t>> colIntervals;
+      if (order == "ASCENDING"  ||  order == "DESCENDING") {
+        Bool ascending = (order == "ASCENDING");
+        TableColumn col (table, colName);
+        // Find the row interval for each value range.
+        // The intervals are in ascending value order, so in descending
+        // row order for a descending column.
+        for (size_t i=0; i<range.start().size(); ++i) {
+          Double st  = range.start()[i];
+          Double end = range.end()[i];
+          rownr_t first, last;
+          if (ascending) {
+            first = findSortedRow (col, nrow, st, True, False);
+            last  = findSortedRow (col, nrow, end, True, True);
+          } else {
+            first = findSortedRow (col, nrow, end, False, False);
+            last  = findSortedRow (col, nrow, st, False, True);
+          }
+          if (first < last) {
+            colIntervals.push_back (std::make_pair (first, last));
+          }
+        }
+        if (! ascending) {
+          std::reverse (colIntervals.begin(), colIntervals.end());
+        }
+      } else if (! findIndexRows (table, colName, range, colIntervals)) {
+        continue;
+      }
+      // Intersect with the intervals found for the previous columns.
+      std::vector<std::pair<rownr_t,rownr_t>> result;
+      auto iter1 = intervals.begin();
+      auto iter2 = colIntervals.begin();
+      while (iter1 != intervals.end()  &&  iter2 != colIntervals.end()) {
+        rownr_t st  = std::max (iter1->first, iter2->first);
+        rownr_t end = std::min (iter1->second, iter2->second);
+        if (st < end) {
+          result.push_back (std::make_pair (st, end));
+        }
+        if (iter1->second < iter2->second) {
+          ++iter1;
+        } else {
+          ++iter2;
+        }
+      }
+      intervals.swap (result);
+      if (! usedNames.empty()) {
+        usedNames += ',';
+      }
+      usedNames += colName;
+    }
+    if (usedNames.empty()) {
+      return False;
+    }
+    rownr_t nsel = 0;
+    for (const std::pair<rownr_t,rownr_t>& interval : intervals) {
+      nsel += interval.second - interval.first;
+    }
+    if (doTracing) {
+      cerr << "WHERE restricted to " << nsel << " of " << nrow
+           << " rows using sorted or indexed column(s) " << usedNames
+           << endl;
+    }
+    rownrs.resize (nsel);
+    rownr_t* ptr = rownrs.data();
+    for (const std::pair<rownr_t,rownr_t>& interval : intervals) {
+      for (rownr_t row=interval.first; row<interval.second; ++row) {
+        *ptr++ = row;
+      }
+    }
+    return True;
+  }
+
+  //# Set a key of a stored index from a range limit.
+  template<typename T>
+  static void setIndexKey (Record& key, const String& name, Double value,
+                           Bool lower)
+  {
+    // Clamp the value to the data type, so the interval found contains
+    // all rows in the range.
+    if (std::numeric_limits<T>::is_integer) {
+      value = (lower  ?  std::ceil(value) : std::floor(value));
+    }
+    value = std::max (value, Double(std::numeric_limits<T>::lowest()));
+    value = std::min (value, Double(std::numeric_limits<T>::max()));
+    key.define (name, T(value));
+  }
+
+  Bool TableParseQuery::findIndexRows
+  (const Table& table, const String& columnName, const TableExprRange& range,
+   std::vector<std::pair<rownr_t,rownr_t>>& intervals)
+  {
+    // A stored index uses the row numbers of the plain table.
+    if (table.tableType() != Table::Plain  ||  !table.isRootTable()  ||
+        table.getPartNames().size() != 1) {
+      return False;
+    }
+    DataType dtype = table.tableDesc()[columnName].dataType();
+    if (dtype != TpUChar  &&  dtype != TpShort  &&  dtype != TpInt  &&
+        dtype != TpUInt  &&  dtype != TpInt64  &&  dtype != TpFloat  &&
+        dtype != TpDouble) {
+      return False;
+    }
+    // Find an up to date index on the column only.
+    const String& tableName = table.tableName();
+    String indexName;
+    Vector<String> names = ColumnsIndex::storedIndexNames (tableName);
+    for (const String& name : names) {
+      Vector<String> cols = ColumnsIndex::storedIndexColumns (tableName, name);
+      if (cols.size() == 1  &&  cols[0] == columnName  &&
+          ColumnsIndex::storedIndexNrow (tableName, name) == table.nrow()  &&
+          ColumnsIndex::isStoredIndexValid (table, name)) {
+        indexName = name;
+        break;
+      }
+    }
+    if (indexName.empty()) {
+      return False;
+    }
+    ColumnsIndex index (table, Vector<String>(1, columnName), indexName);
+    Record& lower = index.accessLowerKey();
+    Record& upper = index.accessUpperKey();
+    std::vector<rownr_t> rows;
+    for (size_t i=0; i<range.start().size(); ++i) {
+      Double st  = range.start()[i];
+      Double end = range.end()[i];
+      switch (dtype) {
+      case TpUChar:
+        setIndexKey<uChar> (lower, columnName, st, True);
+        setIndexKey<uChar> (upper, columnName, end, False);
+        break;
+      case TpShort:
+        setIndexKey<Short> (lower, columnName, st, True);
+        setIndexKey<Short> (upper, columnName, end, False);
+        break;
+      case TpInt:
+        setIndexKey<Int> (lower, columnName, st, True);
+        setIndexKey<Int> (upper, columnName, end, False);
+        break;
+      case TpUInt:
+        setIndexKey<uInt> (lower, columnName, st, True);
+        setIndexKey<uInt> (upper, columnName, end, False);
+        break;
+      case TpInt64:
+        setIndexKey<Int64> (lower, columnName, st, True);
+        setIndexKey<Int64> (upper, columnName, end, False);
+        break;
+      case TpFloat:
+        setIndexKey<Float> (lower, columnName, st, True);
+        setIndexKey<Float> (upper, columnName, end, False);
+        break;
+      default:
+        setIndexKey<Double> (lower, columnName, st, True);
+        setIndexKey<Double> (upper, columnName, end, False);
+        break;
+      }
+      RowNumbers rownrs = index.getRowNumbers (True, True);
+      rows.insert (rows.end(), rownrs.begin(), rownrs.end());
+    }
+    // Combine the rows into intervals of consecutive rows.
+    std::sort (rows.begin(), rows.end());
+    rows.erase (std::unique (rows.begin(), rows.end()), rows.end());
+    intervals.clear();
+    for (rownr_t row : rows) {
+      if (intervals.empty()  ||  intervals.back().second != row) {
+        intervals.push_back (std::make_pair (row, row+1));
+      } else {
+        intervals.back().second++;
+      }
+    }
+    return True;
+  }
+
+  rownr_t TableParseQuery::findSortedRow (const TableColumn& col,
+                                          rownr_t nrow, Double value,
+                                          Bool ascending, Bool pastValue)
+  {
+    // Binary search for the first row whose value is not before the value.
+    rownr_t first = 0;
+    rownr_t count = nrow;
+    while (count > 0) {
+      rownr_t step = count / 2;
+      rownr_t row  = first + step;
+      Double v = col.asdouble (row);
+      Bool before = (ascending ?
+                     (pastValue  ?  v <= value : v < value) :
+                     (pastValue  ?  v >= value : v > value));
+      if (before) {
+        first = row + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    return first;
+  }
+
   std::shared_ptr<TableExprGroupResult> TableParseQuery::doGroupby
   (Bool showTimings)
   {
     Timer timer;
-    std::shared_ptr<TableExprGroupResult> result = groupby_p.execGroupAggr(rownrs_p);
+    std::shared_ptr<TableExprGroupResult> result = groupby_p.execGroupAggr (rownrs_p, nthreads_p);
     if (showTimings) {
       timer.show ("  Groupby     ");
     }
+    analyzePhase ("Groupby", timer.real(), rownrs_p.size(), result->ngroup());
     return result;
   }
 
@@ -806,11 +1196,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                   const std::shared_ptr<TableExprGroupResult>& groups)
   {
     Timer timer;
+    rownr_t nrow = rownrs_p.size();
     // Find the rows matching the HAVING expression.
     Bool done = groupby_p.execHaving (rownrs_p, groups);
     if (showTimings) {
       timer.show ("  Having      ");
     }
+    if (done) {
+      analyzePhase ("Having", timer.real(), nrow, rownrs_p.size());
+    }
     return done;
   }
 
@@ -840,6 +1234,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (showTimings) {
       timer.show ("  Orderby     ");
     }
+    analyzePhase ("Orderby", timer.real(), nrrow, newRownrs.size());
+    for (size_t i=0; i<sort_p.size(); ++i) {
+      analyzeExpr ("ORDERBY key " + String::toString(i+1),
+                   sort_p[i].node(), rownrs_p);
+    }
     // Convert index to rownr.
     for (rownr_t i=0; i<newRownrs.size(); ++i) {
       newRownrs[i] = rownrs_p[newRownrs[i]];
@@ -851,6 +1250,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void TableParseQuery::doLimOff (Bool showTimings)
   {
     Timer timer;
+    rownr_t nrowIn = rownrs_p.size();
     Vector<rownr_t> newRownrs;
     // Negative values mean from the end (a la Python indexing).
     Int64 nrow = rownrs_p.size();
@@ -877,6 +1277,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (showTimings) {
       timer.show ("  Limit/Offset");
     }
+    analyzePhase ("Limit/Offset", timer.real(), nrowIn, rownrs_p.size());
   }
 
   Table TableParseQuery::doLimOff (Bool showTimings, const Table& table)
@@ -912,6 +1313,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (showTimings) {
       timer.show ("  Projection  ");
     }
+    analyzePhase ("Projection", timer.real(), rownrs_p.size(), tabp.nrow());
+    if (analyze_p  &&  tableProject_p.hasExpressions()) {
+      const Block<TableExprNode>& exprs = tableProject_p.getColumnExpr();
+      const Block<String>& names = tableProject_p.getColumnNames();
+      for (uInt i=0; i<exprs.size(); ++i) {
+        if (! exprs[i].isNull()) {
+          analyzeExpr ("SELECT " + names[i], exprs[i], rownrs_p);
+        }
+      }
+    }
     if (distinct_p) {
       tabp = doDistinct (showTimings, tabp);
     }
@@ -977,6 +1388,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (showTimings) {
       timer.show ("  Giving      ");
     }
+    analyzePhase ("Giving", timer.real(), table.nrow(), result.nrow());
     return result;
   }
 
@@ -1003,6 +1415,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (showTimings) {
       timer.show ("  Distinct    ");
     }
+    analyzePhase ("Distinct", timer.real(), table.nrow(), result.nrow());
     return result;
   }
 
@@ -1248,10 +1661,38 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       //#//                 << rang[i].end() << endl;
       //#//        }
       Timer timer;
-      resultTable = table(node_p, nrmax);
+      // Limit the rows to evaluate using the sorted columns.
+      Vector<rownr_t> rangeRows;
+      Bool useRange = findRangeRows (table, doTracing, rangeRows);
+      // A parallel selection cannot stop early, so only do it without limit.
+      if (nthreads_p == 1  ||  nrmax > 0  ||
+          !doParallelWhere (table, useRange ? &rangeRows : 0, nthreads_p,
+                            doTracing, resultTable)) {
+        if (useRange) {
+          resultTable = doRowsWhere (table, rangeRows, nrmax);
+        } else {
+          resultTable = table(node_p, nrmax);
+        }
+      }
       if (showTimings) {
         timer.show ("  Where       ");
       }
+      if (analyze_p) {
+        analyzePhase ("Where", timer.real(), table.nrow(), resultTable.nrow());
+        // Analyze the expression for the rows evaluated.
+        // If the selection stopped early, these are the rows until the last
+        // one found.
+        Vector<rownr_t> evalRows (rangeRows);
+        if (! useRange) {
+          rownr_t nrow = table.nrow();
+          if (nrmax > 0  &&  resultTable.nrow() == nrmax) {
+            nrow = resultTable.rowNumbers(table)[nrmax-1] + 1;
+          }
+          evalRows.resize (nrow);
+          indgen (evalRows);
+        }
+        analyzeExpr ("WHERE", node_p, evalRows);
+      }
       if (doTracing) {
         cerr << "WHERE resulted in " << resultTable.nrow() << " rows" << endl;
       }
@@ -1330,8 +1771,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     //# Then do the update, delete, insert, or projection and so.
     if (commandType_p == PUPDATE) {
+      Timer timer;
       doUpdate (showTimings, table, resultTable, rownrs_p);
       table.flush();
+      analyzePhase ("Update", timer.real(), rownrs_p.size(), rownrs_p.size());
     } else if (commandType_p == PINSERT) {
       Table tabNewRows = doInsert (showTimings, table);
       table.flush();
@@ -1419,6 +1862,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
 
+  void TableParseQuery::analyzePhase (const String& name, Double time,
+                                      rownr_t nrowIn, rownr_t nrowOut)
+  {
+    if (analyze_p) {
+      analyze_p->addPhase (name, analyzeLevel_p, time, nrowIn, nrowOut);
+    }
+  }
+
+  void TableParseQuery::analyzeExpr (const String& name,
+                                     const TableExprNode& expr,
+                                     const Vector<rownr_t>& rownrs)
+  {
+    if (analyze_p) {
+      analyze_p->addExpr (name, analyzeLevel_p, expr, rownrs);
+    }
+  }
+
+
   void TableParseQuery::show (ostream& os) const
   {
     if (! node_p.isNull()) {
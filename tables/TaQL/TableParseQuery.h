@@ -34,6 +34,7 @@
 #include <casacore/tables/TaQL/TableParseUpdate.h>
 #include <casacore/tables/TaQL/TableParseSortKey.h>
 #include <casacore/tables/TaQL/TableParseGroupby.h>
+#include <casacore/tables/TaQL/TableParseAnalyze.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprGroup.h>
@@ -160,6 +161,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Keep the selection expression.
     void handleWhere (const TableExprNode&);
 
+    // Set the number of threads to use for the selection and grouping.
+    // 0 means as many as OpenMP allows; 1 means serial execution.
+    void setNThreads (uInt nthreads)
+      { nthreads_p = nthreads; }
+
+    // Set the object collecting the timings of the steps (EXPLAIN ANALYZE).
+    // The level tells the nesting level of the query.
+    void setAnalyze (const std::shared_ptr<TableParseAnalyze>& analyze,
+                     uInt level)
+      { analyze_p = analyze; analyzeLevel_p = level; }
+
     // Keep the groupby expressions.
     // It checks if they are all scalar expressions.
     void handleGroupby (const std::vector<TableExprNode>&, Bool rollup);
@@ -366,6 +378,61 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // It returns the Table containing the subset of rows in the input Table.
     Table adjustApplySelNodes (const Table&);
 
+    // Do the WHERE selection in parallel using the given number of threads
+    // (0 means as many as OpenMP allows).
+    // The rows are divided into chunks, which are evaluated block-wise by
+    // the threads, each using its own TableExprId objects. The rows selected
+    // in the chunks are merged in row order.
+    // If <src>rownrs</src> is not null, only those rows are evaluated.
+    // The reads of the columns in the expression are serialized, so only
+    // the evaluation of the expression is done in parallel.
+    // It returns False (and does nothing) if the expression cannot be
+    // evaluated in parallel, e.g. because it uses array columns, a join,
+    // a UDF, a regex, or the rand() function.
+    Bool doParallelWhere (const Table& table, const Vector<rownr_t>* rownrs,
+                          uInt nthreads, Bool doTracing, Table& result);
+
+    // Do the WHERE selection for the given rows only (in row order).
+    // It stops when nrmax rows are found (if nrmax > 0).
+    Table doRowsWhere (const Table& table, const Vector<rownr_t>& rownrs,
+                       rownr_t nrmax);
+
+    // Push the range and equality conditions on sorted columns in the
+    // WHERE expression down to a binary search on those columns.
+    // A column is sorted if it has the keyword SORTED with value ASCENDING
+    // or DESCENDING (case-insensitive). It is only used if the table
+    // rows are in the order of the underlying table.
+    // The ranges of the columns are found using
+    // <src>TableExprNode::ranges</src>, so only conditions combined with
+    // AND and OR are taken into account.
+    // Stored indices (see class ColumnsIndex) on a single numeric column
+    // are used as well if the table is a plain table and the index is
+    // up to date.
+    // It returns the (ordered) rows that can match the expression. The entire
+    // expression still needs to be evaluated for those rows.
+    // False is returned if no sorted or indexed column can restrict the rows.
+    Bool findRangeRows (const Table& table, Bool doTracing,
+                        Vector<rownr_t>& rownrs);
+
+    // Find the row intervals matching the ranges of a column using
+    // a stored index on that column.
+    // False is returned if there is no such index.
+    static Bool findIndexRows
+    (const Table& table, const String& columnName,
+     const TableExprRange& range,
+     std::vector<std::pair<rownr_t,rownr_t>>& intervals);
+
+    // Find the first row in a sorted column for which the value is not
+    // before the given value. If <src>pastValue</src> is True, rows with
+    // the given value are also regarded to be before the value.
+    static rownr_t findSortedRow (const TableColumn& col, rownr_t nrow,
+                                  Double value, Bool ascending,
+                                  Bool pastValue);
+
+    // Check if the tables used in the WHERE expression have the same
+    // number of rows as the given table.
+    void checkWhereTables (const Table& table) const;
+
     // Do the groupby/aggregate step and return its result.
     std::shared_ptr<TableExprGroupResult> doGroupby (bool showTimings);
 
@@ -398,6 +465,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Evaluate an int scalar expression.
     Int64 evalIntScaExpr (const TableExprNode& expr) const;
 
+    // Add the timing of a phase or analyze an expression if EXPLAIN ANALYZE
+    // is used. Nothing is done otherwise.
+    // <group>
+    void analyzePhase (const String& name, Double time,
+                       rownr_t nrowIn, rownr_t nrowOut);
+    void analyzeExpr (const String& name, const TableExprNode& expr,
+                      const Vector<rownr_t>& rownrs);
+    // </group>
+
     //# Data mambers.
     //# Command type.
     CommandType commandType_p;
@@ -418,6 +494,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TableExprNodeSet* resultSet_p;
     //# The WHERE expression tree.
     TableExprNode node_p;
+    //# The number of threads for WHERE and GROUPBY (0 means OpenMP maximum).
+    uInt nthreads_p;
+    //# The collector of timings for EXPLAIN ANALYZE (null if not used).
+    std::shared_ptr<TableParseAnalyze> analyze_p;
+    uInt analyzeLevel_p;
     //# The GROUPBY, aggregate and HAVING info.
     TableParseGroupby groupby_p;
     //# Distinct values in output?
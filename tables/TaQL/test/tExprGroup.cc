@@ -58,6 +58,31 @@ Bool foundError = False;
   }\
 }
 
+// Apply the first part of the records to an aggregate function object and
+// the remaining part to another one. Merge them and finish the aggregation.
+// A null pointer is returned if the function cannot merge partial results.
+std::shared_ptr<TableExprGroupFuncBase> applyMerged
+(TableExprAggrNode& aggr, const vector<Record>& recs)
+{
+  std::shared_ptr<TableExprGroupFuncBase> func1 = aggr.makeGroupAggrFunc();
+  if (! func1->isMergeable()) {
+    return std::shared_ptr<TableExprGroupFuncBase>();
+  }
+  std::shared_ptr<TableExprGroupFuncBase> func2 = aggr.makeGroupAggrFunc();
+  uInt nfirst = recs.size() / 3;
+  for (uInt i=0; i<recs.size(); ++i) {
+    TableExprId id(recs[i]);
+    if (i < nfirst) {
+      func1->apply (id);
+    } else {
+      func2->apply (id);
+    }
+  }
+  func1->merge (*func2);
+  func1->finish();
+  return func1;
+}
+
 void check (const TableExprNode& expr,
             const vector<Record>& recs,
             Bool expVal, const String& str)
@@ -78,6 +103,16 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  // Check the result if aggregated in two parts.
+  func = applyMerged (aggr, recs);
+  if (func) {
+    val = func->getBool();
+    if (val != expVal) {
+      foundError = True;
+      cout << str << ": found merged value " << val << "; expected "
+           << expVal << endl;
+    }
+  }
 }
 
 void check (const TableExprNode& expr,
@@ -100,6 +135,16 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  // Check the result if aggregated in two parts.
+  func = applyMerged (aggr, recs);
+  if (func) {
+    val = func->getInt();
+    if (val != expVal) {
+      foundError = True;
+      cout << str << ": found merged value " << val << "; expected "
+           << expVal << endl;
+    }
+  }
 }
 
 void check (const TableExprNode& expr,
@@ -122,6 +167,16 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  // Check the result if aggregated in two parts.
+  func = applyMerged (aggr, recs);
+  if (func) {
+    val = func->getDouble();
+    if (!near (val, expVal, 1.e-10)) {
+      foundError = True;
+      cout << str << ": found merged value " << val << "; expected "
+           << expVal << endl;
+    }
+  }
 }
 
 void check (const TableExprNode& expr,
@@ -144,6 +199,16 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  // Check the result if aggregated in two parts.
+  func = applyMerged (aggr, recs);
+  if (func) {
+    val = func->getDComplex();
+    if (!near (val, expVal, 1.e-10)) {
+      foundError = True;
+      cout << str << ": found merged value " << val << "; expected "
+           << expVal << endl;
+    }
+  }
 }
 
 void checkLazy (const TableExprNode& expr,
@@ -0,0 +1,186 @@
+//# tExprNodeBlock.cc: Test program for block-at-a-time expression evaluation
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprNodeRep.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the block-at-a-time evaluation of table expressions.
+// It checks if the result of evaluating an expression for a block of rows
+// matches the result of evaluating it row by row.
+// </summary>
+
+Table makeTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ai"));
+  td.addColumn (ScalarColumnDesc<Short>("as"));
+  td.addColumn (ScalarColumnDesc<Float>("af"));
+  td.addColumn (ScalarColumnDesc<Double>("ad"));
+  td.addColumn (ScalarColumnDesc<Bool>("ab"));
+  td.addColumn (ScalarColumnDesc<String>("astr"));
+  SetupNewTable newtab ("tExprNodeBlock_tmp.tab", td, Table::Scratch);
+  Table tab (newtab, nrow);
+  ScalarColumn<Int> ai (tab, "ai");
+  ScalarColumn<Short> as (tab, "as");
+  ScalarColumn<Float> af (tab, "af");
+  ScalarColumn<Double> ad (tab, "ad");
+  ScalarColumn<Bool> ab (tab, "ab");
+  ScalarColumn<String> astr (tab, "astr");
+  for (uInt i=0; i<nrow; ++i) {
+    ai.put (i, i%13);
+    as.put (i, i%7 - 3);
+    af.put (i, (i%11) * 0.5);
+    ad.put (i, (i%17) * 0.25);
+    ab.put (i, i%3 == 0);
+    astr.put (i, String::toString(i%5));
+  }
+  return tab;
+}
+
+// Check the block result against the row by row result for all rows and
+// for a subset of them. Also check the number of rows selected.
+void checkBool (const Table& tab, const TableExprNode& expr)
+{
+  rownr_t nrow = tab.nrow();
+  Vector<rownr_t> rownrs(nrow);
+  indgen (rownrs);
+  Vector<Bool> vals;
+  expr.getRep()->getBoolBlock (rownrs, vals);
+  AlwaysAssertExit (vals.size() == nrow);
+  rownr_t nfound = 0;
+  for (rownr_t i=0; i<nrow; ++i) {
+    Bool val;
+    expr.get (i, val);
+    AlwaysAssertExit (vals[i] == val);
+    if (val) nfound++;
+  }
+  AlwaysAssertExit (tab(expr).nrow() == nfound);
+  // Use every third row in reversed order.
+  Vector<rownr_t> subRows(nrow/3);
+  for (rownr_t i=0; i<subRows.size(); ++i) {
+    subRows[i] = nrow - 1 - 3*i;
+  }
+  expr.getRep()->getBoolBlock (subRows, vals);
+  AlwaysAssertExit (vals.size() == subRows.size());
+  for (rownr_t i=0; i<subRows.size(); ++i) {
+    Bool val;
+    expr.get (subRows[i], val);
+    AlwaysAssertExit (vals[i] == val);
+  }
+  // Check selection with an offset and limit spanning multiple blocks.
+  if (nfound > 10) {
+    Table all = tab(expr);
+    Table part = tab(expr, nfound-5, 3);
+    AlwaysAssertExit (part.nrow() == nfound-5);
+    Vector<rownr_t> allRows = all.rowNumbers();
+    Vector<rownr_t> partRows = part.rowNumbers();
+    for (rownr_t i=0; i<partRows.size(); ++i) {
+      AlwaysAssertExit (partRows[i] == allRows[i+3]);
+    }
+  }
+}
+
+void checkInt (const Table& tab, const TableExprNode& expr)
+{
+  rownr_t nrow = tab.nrow();
+  Vector<rownr_t> rownrs(nrow);
+  indgen (rownrs);
+  Vector<Int64> ivals;
+  Vector<Double> dvals;
+  expr.getRep()->getIntBlock (rownrs, ivals);
+  expr.getRep()->getDoubleBlock (rownrs, dvals);
+  for (rownr_t i=0; i<nrow; ++i) {
+    Int64 val;
+    expr.get (i, val);
+    AlwaysAssertExit (ivals[i] == val);
+    AlwaysAssertExit (dvals[i] == Double(val));
+  }
+}
+
+void checkDouble (const Table& tab, const TableExprNode& expr)
+{
+  rownr_t nrow = tab.nrow();
+  Vector<rownr_t> rownrs(nrow);
+  indgen (rownrs);
+  Vector<Double> vals;
+  expr.getRep()->getDoubleBlock (rownrs, vals);
+  for (rownr_t i=0; i<nrow; ++i) {
+    Double val;
+    expr.get (i, val);
+    AlwaysAssertExit (vals[i] == val);
+  }
+}
+
+int main()
+{
+  try {
+    // Use a number of rows that is not a multiple of the block size.
+    Table tab = makeTable (5000);
+    TableExprNode ai = tab.col("ai");
+    TableExprNode as = tab.col("as");
+    TableExprNode af = tab.col("af");
+    TableExprNode ad = tab.col("ad");
+    TableExprNode ab = tab.col("ab");
+    TableExprNode astr = tab.col("astr");
+    // Column and arithmetic nodes.
+    checkInt (tab, ai);
+    checkInt (tab, as);
+    checkInt (tab, ai + as*2 - 3);
+    checkDouble (tab, af);
+    checkDouble (tab, ad);
+    checkDouble (tab, ai/2 + af*ad - as);
+    // Fallback to row by row evaluation.
+    checkDouble (tab, sqrt(ad) + ai);
+    checkInt (tab, iif(ab, ai, as));
+    // Comparison and logical operators.
+    checkBool (tab, ab);
+    checkBool (tab, ai > 3);
+    checkBool (tab, ai >= as+5);
+    checkBool (tab, ad == af);
+    checkBool (tab, ai != 4  &&  ad < 2.);
+    checkBool (tab, ab  ||  (af > 2  &&  as <= 0));
+    checkBool (tab, !(ab  ||  ai == 5));
+    checkBool (tab, ai+ad > 6  &&  astr == "2");
+    checkBool (tab, astr != "3"  ||  ai < 0);
+    checkBool (tab, ai > 100);
+    checkBool (tab, ai >= 0);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,207 @@
+//# tTaQLPreparedStatement.cc: Test program for TaQL prepared statements
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/TaQL/TaQLPreparedStatement.h>
+#include <casacore/tables/TaQL/TaQLPlanCache.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/TableUtil.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for TaQL prepared statements and the TaQL plan cache.
+// </summary>
+
+void makeTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ai"));
+  td.addColumn (ScalarColumnDesc<Double>("ad"));
+  td.addColumn (ScalarColumnDesc<String>("astr"));
+  SetupNewTable newtab ("tTaQLPreparedStatement_tmp.tab", td, Table::New);
+  Table tab (newtab, nrow);
+  ScalarColumn<Int> ai (tab, "ai");
+  ScalarColumn<Double> ad (tab, "ad");
+  ScalarColumn<String> astr (tab, "astr");
+  for (uInt i=0; i<nrow; ++i) {
+    ai.put (i, i%10);
+    ad.put (i, i*0.5);
+    astr.put (i, String::toString(i%4));
+  }
+}
+
+void testSelect()
+{
+  TaQLPreparedStatement stmt ("select from tTaQLPreparedStatement_tmp.tab"
+                              " where ai == ?1");
+  for (Int i=0; i<12; ++i) {
+    stmt.bind (1, i);
+    AlwaysAssertExit (stmt.execute().table().nrow() == (i<10 ? 10u : 0u));
+  }
+  // A placeholder can be used multiple times and with other types.
+  TaQLPreparedStatement stmt2 ("select ai from tTaQLPreparedStatement_tmp.tab"
+                               " where ai >= ?1 && ai < ?1+2 &&"
+                               " astr == ?2 && ad > ?3");
+  stmt2.bind (1, 4);
+  stmt2.bind (2, String("1"));
+  stmt2.bind (3, 20.);
+  Vector<String> cols;
+  String type;
+  std::vector<const Table*> tmp;
+  Table result = stmt2.execute(tmp, cols, type).table();
+  AlwaysAssertExit (type == "select");
+  AlwaysAssertExit (cols.size() == 1  &&  cols[0] == "ai");
+  // Rows 45, 65, 85 match.
+  AlwaysAssertExit (result.nrow() == 3);
+  stmt2.bind (3, 40.);
+  AlwaysAssertExit (stmt2.execute().table().nrow() == 1);
+  // An array can be bound as well.
+  Vector<Int> vals(3);
+  vals[0] = 1; vals[1] = 3; vals[2] = 11;
+  TaQLPreparedStatement stmt3 ("select from tTaQLPreparedStatement_tmp.tab"
+                               " where ai in ?1");
+  stmt3.bind (1, vals);
+  AlwaysAssertExit (stmt3.execute().table().nrow() == 20);
+  // A placeholder can be used with a temporary table.
+  Table tab("tTaQLPreparedStatement_tmp.tab");
+  TaQLPreparedStatement stmt4 ("select from $1 where ai < ?1");
+  stmt4.bind (1, 3);
+  tmp.push_back (&tab);
+  AlwaysAssertExit (stmt4.execute(tmp).table().nrow() == 30);
+}
+
+void testCalc()
+{
+  TaQLPreparedStatement stmt ("calc ?1 * ?2 + 1");
+  stmt.bind (1, 3);
+  stmt.bind (2, 4.5);
+  AlwaysAssertExit (stmt.execute().node().getDouble(0) == 14.5);
+}
+
+void testErrors()
+{
+  // No value bound to ?2.
+  TaQLPreparedStatement stmt ("calc ?1 + ?2");
+  stmt.bind (1, 3);
+  Bool failed = False;
+  try {
+    stmt.execute();
+  } catch (const TableParseError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  // The value must be a constant.
+  Table tab("tTaQLPreparedStatement_tmp.tab");
+  failed = False;
+  try {
+    stmt.bind (2, tab.col("ai"));
+  } catch (const TableInvExpr&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  // Placeholders are 1-relative.
+  failed = False;
+  try {
+    stmt.bind (0, 1);
+  } catch (const TableInvExpr&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  stmt.bind (2, 5);
+  AlwaysAssertExit (stmt.execute().node().getInt(0) == 8);
+  stmt.clearBindings();
+  failed = False;
+  try {
+    stmt.execute();
+  } catch (const TableParseError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+void testCache()
+{
+  TaQLPlanCache& cache = TaQLPlanCache::global();
+  cache.clear();
+  AlwaysAssertExit (cache.size() == 0);
+  uInt64 nhit  = cache.nhit();
+  uInt64 nmiss = cache.nmiss();
+  String cmd1 ("select from tTaQLPreparedStatement_tmp.tab where ai < 2");
+  String cmd2 ("select from tTaQLPreparedStatement_tmp.tab where ai < 3");
+  AlwaysAssertExit (tableCommand(cmd1).table().nrow() == 20);
+  AlwaysAssertExit (tableCommand(cmd1).table().nrow() == 20);
+  AlwaysAssertExit (tableCommand(cmd2).table().nrow() == 30);
+  AlwaysAssertExit (cache.size() == 2);
+  AlwaysAssertExit (cache.nhit() == nhit+1  &&  cache.nmiss() == nmiss+2);
+  // Commands that cannot be parsed are not cached.
+  Bool failed = False;
+  try {
+    tableCommand ("select from tTaQLPreparedStatement_tmp.tab where");
+  } catch (const TableParseError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  AlwaysAssertExit (cache.size() == 2);
+  // Reducing the size removes the least recently used command (cmd1).
+  cache.setMaxSize (1);
+  AlwaysAssertExit (cache.size() == 1);
+  nmiss = cache.nmiss();
+  tableCommand (cmd2);
+  AlwaysAssertExit (cache.nmiss() == nmiss);
+  tableCommand (cmd1);
+  AlwaysAssertExit (cache.nmiss() == nmiss+1);
+  AlwaysAssertExit (cache.size() == 1);
+  // Nothing is cached if the size is 0.
+  cache.setMaxSize (0);
+  AlwaysAssertExit (cache.size() == 0);
+  tableCommand (cmd1);
+  AlwaysAssertExit (cache.size() == 0);
+  cache.setMaxSize (64);
+}
+
+int main()
+{
+  try {
+    makeTable (100);
+    testSelect();
+    testCalc();
+    testErrors();
+    testCache();
+    TableUtil::deleteTable ("tTaQLPreparedStatement_tmp.tab");
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
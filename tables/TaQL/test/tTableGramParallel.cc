@@ -0,0 +1,180 @@
+//# tTableGramParallel.cc: Test program for parallel TaQL query evaluation
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for TaQL queries evaluated with multiple threads.
+// The result of a query using style PARALLEL is compared to the result of
+// the same query evaluated serially. The table is large enough for the
+// parallel code paths to be used.
+// </summary>
+
+Table makeTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ICOL"));
+  td.addColumn (ScalarColumnDesc<Double>("DCOL"));
+  td.addColumn (ScalarColumnDesc<Complex>("CCOL"));
+  td.addColumn (ScalarColumnDesc<String>("SCOL"));
+  td.addColumn (ScalarColumnDesc<Bool>("BCOL"));
+  td.addColumn (ArrayColumnDesc<Float>("ACOL", IPosition(1,3),
+                                       ColumnDesc::FixedShape));
+  SetupNewTable newtab ("tTableGramParallel_tmp.tab", td, Table::Scratch);
+  Table tab (newtab, nrow);
+  ScalarColumn<Int> icol (tab, "ICOL");
+  ScalarColumn<Double> dcol (tab, "DCOL");
+  ScalarColumn<Complex> ccol (tab, "CCOL");
+  ScalarColumn<String> scol (tab, "SCOL");
+  ScalarColumn<Bool> bcol (tab, "BCOL");
+  ArrayColumn<Float> acol (tab, "ACOL");
+  Vector<Float> arr(3);
+  for (uInt i=0; i<nrow; ++i) {
+    icol.put (i, (i*37) % 1000);
+    dcol.put (i, i * 0.5);
+    ccol.put (i, Complex(i%7, Float(i%11) / 2));
+    scol.put (i, "s" + String::toString(i%13));
+    bcol.put (i, i%3 == 0);
+    indgen (arr, Float(i%5));
+    acol.put (i, arr);
+  }
+  return tab;
+}
+
+// Execute the command serially and in parallel and check if the results
+// are the same.
+void check (const String& command)
+{
+  Table serTab = tableCommand(command).table();
+  Table parTab = tableCommand("using style parallel " + command).table();
+  AlwaysAssertExit (serTab.nrow() > 0);
+  AlwaysAssertExit (parTab.nrow() == serTab.nrow());
+  AlwaysAssertExit (allEQ (parTab.rowNumbers(), serTab.rowNumbers()));
+}
+
+// Execute the grouping command serially and in parallel and check if the
+// groups are the same and in the same order. The aggregated values can
+// differ slightly because partial results are merged.
+void checkGroup (const String& command)
+{
+  Table serTab = tableCommand(command).table();
+  Table parTab = tableCommand("using style parallel " + command).table();
+  AlwaysAssertExit (serTab.nrow() > 1);
+  AlwaysAssertExit (parTab.nrow() == serTab.nrow());
+  AlwaysAssertExit (allEQ (parTab.rowNumbers(), serTab.rowNumbers()));
+  Vector<String> names = serTab.tableDesc().columnNames();
+  for (const String& name : names) {
+    TableColumn serCol (serTab, name);
+    TableColumn parCol (parTab, name);
+    DataType dtype = serCol.columnDesc().dataType();
+    for (rownr_t i=0; i<serTab.nrow(); ++i) {
+      if (dtype == TpBool) {
+        AlwaysAssertExit (parCol.asBool(i) == serCol.asBool(i));
+      } else if (dtype == TpString) {
+        AlwaysAssertExit (parCol.asString(i) == serCol.asString(i));
+      } else if (dtype == TpComplex  ||  dtype == TpDComplex) {
+        AlwaysAssertExit (near (parCol.asDComplex(i), serCol.asDComplex(i),
+                                1e-10));
+      } else {
+        AlwaysAssertExit (near (parCol.asdouble(i), serCol.asdouble(i),
+                                1e-10));
+      }
+    }
+  }
+}
+
+void checkWhere (const String& where)
+{
+  const String tab("tTableGramParallel_tmp.tab");
+  check ("select from " + tab + " where " + where);
+  check ("select ICOL, DCOL*2 as D2 from " + tab + " where " + where);
+  // Use a selection in row order and one not in row order.
+  check ("select from [select from " + tab + " where ICOL != 5] where " +
+         where);
+  check ("select from [select from " + tab + " orderby desc DCOL] where " +
+         where);
+}
+
+int main()
+{
+  try {
+    // Make sure multiple threads are used, even on a single core.
+    OMP::setNumThreads (4);
+    Table tab = makeTable (5000);
+    checkWhere ("ICOL % 7 == 3 && DCOL > 100.5");
+    checkWhere ("near(DCOL, 200.0, 1e-5) || SCOL == 's3'");
+    checkWhere ("SCOL in ['s1','s5','s12'] && BCOL");
+    checkWhere ("abs(CCOL) > 5 && sqrt(DCOL) < 40");
+    checkWhere ("ICOL between 100 and 300 && !BCOL");
+    checkWhere ("iif(BCOL, ICOL, -ICOL) > 50");
+    checkWhere ("DCOL in [10=:<50, 1000<:=2000]");
+    checkWhere ("rownumber() > 4000 || upcase(SCOL) == 'S7'");
+    // These expressions are evaluated serially.
+    checkWhere ("sum(ACOL) > 10");
+    checkWhere ("SCOL ~ p/s1*/");
+    const String tabName("tTableGramParallel_tmp.tab");
+    checkGroup ("select ICOL%10 as K, gcount() as N, gsum(ICOL) as SI,"
+                " gmin(ICOL) as MINI, gmax(DCOL) as MAXD, gmean(DCOL) as MEAN,"
+                " gvariance(DCOL) as VAR, gstddev(DCOL) as SD, grms(DCOL) as RMS,"
+                " gsumsqr(DCOL) as SQ, gany(BCOL) as ANYB, gall(BCOL) as ALLB,"
+                " gntrue(BCOL) as NT, gnfalse(BCOL) as NF from " + tabName +
+                " groupby ICOL%10");
+    checkGroup ("select SCOL, gsum(CCOL) as SC, gmean(CCOL) as MC,"
+                " gvariance(CCOL) as VC, gcount() as N from " + tabName +
+                " groupby SCOL");
+    checkGroup ("select floor(DCOL/100) as K, gsum(DCOL) as S, gcount() as N"
+                " from " + tabName + " groupby floor(DCOL/100)");
+    checkGroup ("select SCOL, BCOL, gcount() as N, gmin(DCOL) as MIN from " +
+                tabName + " where ICOL != 5 groupby SCOL,BCOL"
+                " having gcount() > 100");
+    checkGroup ("select ICOL%3 as K, gmax(ICOL) as M, gcount() as N from"
+                " [select from " + tabName + " orderby desc DCOL] groupby ICOL%3");
+    // A non-mergeable aggregate function is done serially.
+    checkGroup ("select ICOL%10 as K, gmedian(DCOL) as MED from " + tabName +
+                " groupby ICOL%10");
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
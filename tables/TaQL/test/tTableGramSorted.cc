@@ -0,0 +1,172 @@
+//# tTableGramSorted.cc: Test program for TaQL selections on sorted columns
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/ColumnsIndex.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for TaQL selections on columns marked as sorted.
+// The result of a selection on the sorted columns (which uses a binary
+// search) is compared to the result of the same selection on unmarked
+// copies of those columns (which uses a full scan).
+// It is also compared to the selection on copies having a stored index.
+// </summary>
+
+Table makeTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Double>("TIME"));
+  td.addColumn (ScalarColumnDesc<Int>("ANT"));
+  td.addColumn (ScalarColumnDesc<Double>("TIMEU"));
+  td.addColumn (ScalarColumnDesc<Int>("ANTU"));
+  td.addColumn (ScalarColumnDesc<Double>("TIMEI"));
+  td.addColumn (ScalarColumnDesc<Int>("ANTI"));
+  td.addColumn (ScalarColumnDesc<Int>("VAL"));
+  td.rwColumnDesc("TIME").rwKeywordSet().define ("SORTED", String("ascending"));
+  td.rwColumnDesc("ANT").rwKeywordSet().define ("SORTED", String("DESCENDING"));
+  SetupNewTable newtab ("tTableGramSorted_tmp.tab", td, Table::Scratch);
+  Table tab (newtab, nrow);
+  ScalarColumn<Double> time (tab, "TIME");
+  ScalarColumn<Int> ant (tab, "ANT");
+  ScalarColumn<Double> timeu (tab, "TIMEU");
+  ScalarColumn<Int> antu (tab, "ANTU");
+  ScalarColumn<Double> timei (tab, "TIMEI");
+  ScalarColumn<Int> anti (tab, "ANTI");
+  ScalarColumn<Int> val (tab, "VAL");
+  for (uInt i=0; i<nrow; ++i) {
+    // Both sorted columns contain duplicate values.
+    time.put (i, 100 + (i/7) * 1.5);
+    ant.put (i, (nrow-1-i) / 13);
+    timeu.put (i, 100 + (i/7) * 1.5);
+    antu.put (i, (nrow-1-i) / 13);
+    timei.put (i, 100 + (i/7) * 1.5);
+    anti.put (i, (nrow-1-i) / 13);
+    val.put (i, i%5);
+  }
+  // Store an index for the indexed copies.
+  ColumnsIndex timeIndex (tab, Vector<String>(1, "TIMEI"), "timei");
+  ColumnsIndex antIndex (tab, Vector<String>(1, "ANTI"), "anti");
+  return tab;
+}
+
+// Make a second table with a sorted column having the same name.
+Table makeTable2 (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Double>("TIME"));
+  td.rwColumnDesc("TIME").rwKeywordSet().define ("SORTED", String("descending"));
+  SetupNewTable newtab ("tTableGramSorted_tmp.tab2", td, Table::Scratch);
+  Table tab (newtab, nrow);
+  ScalarColumn<Double> time (tab, "TIME");
+  for (uInt i=0; i<nrow; ++i) {
+    time.put (i, 100 + ((nrow-1-i)/7) * 1.5);
+  }
+  return tab;
+}
+
+// Execute the command using the sorted and unsorted columns and check
+// if the results are the same.
+void check (const String& command)
+{
+  String sortCommand (command);
+  sortCommand.gsub ("$T", "TIME");
+  sortCommand.gsub ("$A", "ANT");
+  String unsortCommand (command);
+  unsortCommand.gsub ("$T", "TIMEU");
+  unsortCommand.gsub ("$A", "ANTU");
+  String indexCommand (command);
+  indexCommand.gsub ("$T", "TIMEI");
+  indexCommand.gsub ("$A", "ANTI");
+  Table sortTab = tableCommand(sortCommand).table();
+  Table unsortTab = tableCommand(unsortCommand).table();
+  Table indexTab = tableCommand(indexCommand).table();
+  AlwaysAssertExit (sortTab.nrow() == unsortTab.nrow());
+  AlwaysAssertExit (allEQ (sortTab.rowNumbers(), unsortTab.rowNumbers()));
+  AlwaysAssertExit (indexTab.nrow() == unsortTab.nrow());
+  AlwaysAssertExit (allEQ (indexTab.rowNumbers(), unsortTab.rowNumbers()));
+}
+
+void checkWhere (const String& where)
+{
+  const String tab("tTableGramSorted_tmp.tab");
+  check ("select from " + tab + " where " + where);
+  check ("select from " + tab + " where " + where + " limit 5");
+  check ("select from " + tab + " where " + where + " offset 3");
+  // Use a selection in row order and one not in row order.
+  check ("select from [select from " + tab + " where VAL > 0] where " + where);
+  check ("select from [select from " + tab + " orderby VAL] where " + where);
+  // Use multiple threads.
+  check ("using style parallel select from " + tab + " where " + where);
+}
+
+// Check a selection using columns with the same name in two tables.
+// Their ranges must not be combined.
+void checkTwoTables (const String& where)
+{
+  check ("select from tTableGramSorted_tmp.tab t1, tTableGramSorted_tmp.tab2 t2"
+         " where " + where);
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable (10000);
+    Table tab2 = makeTable2 (10000);
+    checkWhere ("$T > 120 && $T <= 200.5");
+    checkWhere ("$T == 130");
+    checkWhere ("$T == 130.5");
+    checkWhere ("$T < 110");
+    checkWhere ("110 >= $T");
+    checkWhere ("$T BETWEEN 150 AND 160 || $T IN [300=:=310, 400=:=405]");
+    checkWhere ("$T < 110 || VAL == 2");
+    checkWhere ("$T > 200 && $T < 100");
+    checkWhere ("!($T > 200)");
+    checkWhere ("$T > 1e10");
+    checkWhere ("$A == 100");
+    checkWhere ("$A < 50 && $T > 1000");
+    checkWhere ("$A >= 200 && $A <= 300 && VAL != 1");
+    checkWhere ("($A > 700 || $A < 10) && ($T < 150 || $T > 2000)");
+    checkTwoTables ("t1.$T > 1000 && t2.TIME < 1500");
+    checkTwoTables ("t2.TIME < 1500 && t1.$T > 1000");
+    checkTwoTables ("t1.$T < 200 || t2.TIME < 200");
+    checkTwoTables ("(t1.$T < 200 || t2.TIME < 200) && t1.$T < 2000");
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,158 @@
+//# tTableParseAnalyze.cc: Test program for the analysis of TaQL commands
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/TaQL/TableParseAnalyze.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <casacore/casa/sstream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for class TableParseAnalyze.
+// It checks the nodes, rows and bytes found when analyzing expressions
+// and executes a command with EXPLAIN ANALYZE.
+// </summary>
+
+Table makeTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ai"));
+  td.addColumn (ScalarColumnDesc<Double>("ad"));
+  td.addColumn (ScalarColumnDesc<String>("astr"));
+  td.addColumn (ArrayColumnDesc<Float>("arr", IPosition(1,4),
+                                       ColumnDesc::FixedShape));
+  SetupNewTable newtab ("tTableParseAnalyze_tmp.tab", td, Table::Scratch);
+  Table tab (newtab, nrow);
+  ScalarColumn<Int> ai (tab, "ai");
+  ScalarColumn<Double> ad (tab, "ad");
+  ScalarColumn<String> astr (tab, "astr");
+  ArrayColumn<Float> arr (tab, "arr");
+  Vector<Float> vec(4);
+  for (uInt i=0; i<nrow; ++i) {
+    ai.put (i, i%13);
+    ad.put (i, (i%17) * 0.25);
+    astr.put (i, String::toString(i%5) + "ab");
+    indgen (vec, Float(i));
+    arr.put (i, vec);
+  }
+  return tab;
+}
+
+const TableParseAnalyze::Column& findColumn (const TableParseAnalyze& analyze,
+                                             const String& name)
+{
+  for (const TableParseAnalyze::Column& col : analyze.columns()) {
+    if (col.name == name) {
+      return col;
+    }
+  }
+  throw AipsError ("column " + name + " not analyzed");
+}
+
+void testExpr (const Table& tab)
+{
+  TableParseAnalyze analyze;
+  Vector<rownr_t> rownrs(tab.nrow());
+  indgen (rownrs);
+  // ai > 3 && ad < 2 gives AND, >, ai, 3, <, ad, 2 (< is reversed >).
+  analyze.addExpr ("WHERE", 0, tab.col("ai") > 3  &&  tab.col("ad") < 2.,
+                   rownrs);
+  const std::vector<TableParseAnalyze::Node>& nodes = analyze.nodes();
+  AlwaysAssertExit (nodes.size() == 7);
+  AlwaysAssertExit (nodes[0].depth == 0  &&  nodes[1].depth == 1  &&
+                    nodes[2].depth == 2  &&  nodes[3].depth == 2  &&
+                    nodes[4].depth == 1  &&  nodes[5].depth == 2  &&
+                    nodes[6].depth == 2);
+  AlwaysAssertExit (nodes[0].description == "AND (Bool Scalar)");
+  AlwaysAssertExit (nodes[2].description == "column ai (Integer Scalar)");
+  for (const TableParseAnalyze::Node& node : nodes) {
+    AlwaysAssertExit (node.expr == "WHERE");
+    if (node.description.startsWith("constant")) {
+      AlwaysAssertExit (! node.evaluated);
+    } else {
+      AlwaysAssertExit (node.evaluated  &&  node.nrow == tab.nrow());
+    }
+  }
+  // Only half of the rows for the string and array column.
+  Vector<rownr_t> halfRows(tab.nrow() / 2);
+  indgen (halfRows, rownr_t(0), rownr_t(2));
+  analyze.addExpr ("SELECT", 1, tab.col("astr") + "c", halfRows);
+  analyze.addExpr ("SELECT", 1, sum(tab.col("arr")), halfRows);
+  AlwaysAssertExit (analyze.nodes().size() == 7+3+2);
+  AlwaysAssertExit (analyze.nodes()[7].expr == "SELECT (level 1)");
+  AlwaysAssertExit (analyze.columns().size() == 4);
+  const TableParseAnalyze::Column& aiCol = findColumn (analyze, "ai");
+  AlwaysAssertExit (aiCol.nrow == tab.nrow());
+  AlwaysAssertExit (aiCol.nbytes == 4*tab.nrow());
+  AlwaysAssertExit (aiCol.dataManager == "StandardStMan");
+  AlwaysAssertExit (findColumn(analyze, "ad").nbytes == 8*tab.nrow());
+  AlwaysAssertExit (findColumn(analyze, "astr").nbytes == 3*halfRows.size());
+  AlwaysAssertExit (findColumn(analyze, "arr").nbytes == 4*4*halfRows.size());
+  analyze.addPhase ("Where", 0, 0.5, tab.nrow(), 10);
+  AlwaysAssertExit (analyze.phases().size() == 1);
+  std::ostringstream os;
+  analyze.show (os);
+  AlwaysAssertExit (os.str().find ("Expression WHERE") != String::npos);
+  AlwaysAssertExit (os.str().find ("column arr") != String::npos);
+}
+
+void testCommand (const Table& tab)
+{
+  Table res = tableCommand ("EXPLAIN ANALYZE select ai, ad*2 from $1"
+                            " where ai > 3 orderby ad limit 100", tab).table();
+  AlwaysAssertExit (res.nrow() == 100);
+  res = tableCommand ("using style python analyze select from $1"
+                      " where astr == '2ab'", tab).table();
+  AlwaysAssertExit (res.nrow() == tab.nrow() / 5);
+  // Aggregate expressions are not analyzed, but the phases are.
+  res = tableCommand ("analyze select gsum(ad) from $1 groupby ai",
+                      tab).table();
+  AlwaysAssertExit (res.nrow() == 13);
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable (3000);
+    testExpr (tab);
+    testCommand (tab);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -1278,6 +1278,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       This storage manager could be used for a table with a column
 //       containing line and continuum data, which will result
 //       in 2 hypercubes.
+//  <dt> <linkto class=TiledCompressStMan:description>TiledCompressStMan
+//       </linkto>
+//  <dd> is the same as <src>TiledShapeStMan</src>, but losslessly
+//       compresses the tiles when writing them to disk.
+//       <br>
+//       It is meant for highly redundant columns like FLAG and
+//       WEIGHT_SPECTRUM in a MeasurementSet, which are usually much
+//       smaller when compressed.
 //  <dt> <linkto class=TiledCellStMan:description>TiledCellStMan</linkto>
 //  <dd> creates (automatically) a new hypercube for each row.
 //       Thus each row of the hypercolumn is stored in a separate hypercube.
@@ -66,10 +66,13 @@ BaseTableIterator::BaseTableIterator (const std::shared_ptr<BaseTable>& btp,
         Sort::Option sortopt = Sort::QuickSort;
         if (option == TableIterator::HeapSort) {
             sortopt = Sort::HeapSort;
-        } else if (option == TableIterator::ParSort) {
+        } else if (option == TableIterator::ParSort  ||
+                   option == TableIterator::CheckSort) {
             sortopt = Sort::ParSort;
         } else if (option == TableIterator::InsSort) {
             sortopt = Sort::InsSort;
+        } else if (option == TableIterator::RadixSort) {
+            sortopt = Sort::RadixSort;
         }
         Block<Int> ord(nrkeys_p, Sort::Ascending);
         for (uInt i=0; i<nrkeys_p; i++) {
@@ -81,9 +84,17 @@ BaseTableIterator::BaseTableIterator (const std::shared_ptr<BaseTable>& btp,
             sortIterBoundaries_p   = std::make_shared<Vector<rownr_t>>();
             sortIterKeyIdxChange_p = std::make_shared<Vector<size_t>>();
         }
-        sortTab_p = btp->sort (keys, cmpObj_p, ord, sortopt,
-                               sortIterBoundaries_p,
-                               sortIterKeyIdxChange_p);
+        // If already in order, the table itself can be used, where the
+        // check also gives the iteration boundaries.
+        if (option == TableIterator::CheckSort  &&
+            btp->isSorted (keys, cmpObj_p, ord,
+                           sortIterBoundaries_p, sortIterKeyIdxChange_p)) {
+            sortTab_p = btp;
+        } else {
+            sortTab_p = btp->sort (keys, cmpObj_p, ord, sortopt,
+                                   sortIterBoundaries_p,
+                                   sortIterKeyIdxChange_p);
+        }
     }
     // Get the pointers to the BaseColumn object.
     // Get a buffer to hold the current and last value per column.
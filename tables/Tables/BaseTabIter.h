@@ -71,6 +71,9 @@ class String;
 // order and then creating a RefTable for each step containing the
 // rows for that iteration step. Each iteration step assembles the
 // rows with equal key values.
+// If the table is already in the required order (TableIterator::NoSort
+// or checked with TableIterator::CheckSort), it iterates through the
+// table itself without making a sorted RefTable.
 // </synopsis> 
 
 //# <todo asof="$DATE:$">
@@ -676,6 +676,39 @@ std::shared_ptr<BaseTable> BaseTable::sort
  std::shared_ptr<Vector<rownr_t>> sortIterBoundaries,
  std::shared_ptr<Vector<size_t>> sortIterKeyIdxChange)
 
+{
+    PtrBlock<BaseColumn*> sortCol = getSortColumns (names, order);
+    // Return the result as a table.
+    return doSort (sortCol, cmpObj, order, option,
+                   sortIterBoundaries, sortIterKeyIdxChange);
+}
+
+//# Test if a table is in sort order.
+Bool BaseTable::isSorted
+(const Block<String>& names,
+ const Block<std::shared_ptr<BaseCompare>>& cmpObj,
+ const Block<Int>& order,
+ std::shared_ptr<Vector<rownr_t>> sortIterBoundaries,
+ std::shared_ptr<Vector<size_t>> sortIterKeyIdxChange)
+{
+    PtrBlock<BaseColumn*> sortCol = getSortColumns (names, order);
+    uInt nrkey = sortCol.nelements();
+    //# Read the keys once like doSort does and let Sort test the order.
+    Sort sortobj;
+    Block<std::shared_ptr<ArrayBase>> data(nrkey);        // to remember data blocks
+    Block<std::shared_ptr<BaseCompare>> cmp(cmpObj);
+    for (uInt i=0; i<nrkey; i++) {
+        sortCol[i]->makeSortKey (sortobj, cmp[i], order[i], data[i]);
+    }
+    if (sortIterBoundaries && sortIterKeyIdxChange) {
+        return sortobj.isSorted (*sortIterBoundaries, *sortIterKeyIdxChange,
+                                 nrow());
+    }
+    return sortobj.isSorted (nrow());
+}
+
+PtrBlock<BaseColumn*> BaseTable::getSortColumns (const Block<String>& names,
+                                                 const Block<Int>& order)
 {
     AlwaysAssert (!isNull(), AipsError);
     //# Check if the vectors have equal length.
@@ -695,9 +728,7 @@ std::shared_ptr<BaseTable> BaseTable::sort
                                  name_p + " is not a scalar"));
         }
     }
-    // Return the result as a table.
-    return doSort (sortCol, cmpObj, order, option,
-                   sortIterBoundaries, sortIterKeyIdxChange);
+    return sortCol;
 }
 
 //# Do the actual sort.
@@ -800,26 +831,34 @@ std::shared_ptr<BaseTable> BaseTable::select (const TableExprNode& node,
     }
     //# Create a reference table, which will be in row order.
     //# Loop through all rows and add to reference table if true.
+    //# The expression is evaluated for a block of rows at a time.
     //# Add the rownr of the root table (one may search a reference table).
     //# Adjust the row numbers to reflect row numbers in the root table.
     std::shared_ptr<RefTable> resultTable = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(resultTable), AipsError);
-    Bool val;
+    const rownr_t blockSize = 1024;
     rownr_t nrrow = nrow();
-    TableExprId id;
-    for (rownr_t i=0; i<nrrow; i++) {
-      id.setRownr (i);
-      node.get (id, val);
-      if (val) {
-        if (offset == 0) {
-          resultTable->addRownr (i);                  // add row
-          // Stop if max #rows reached (note that maxRow==0 means no limit).
-          if (resultTable->nrow() == maxRow) {
-            break;
+    Vector<rownr_t> rownrs;
+    Vector<Bool> vals;
+    Bool done = False;
+    for (rownr_t st=0; st<nrrow && !done; st+=blockSize) {
+      rownr_t nr = std::min (blockSize, nrrow-st);
+      rownrs.resize (nr);
+      indgen (rownrs, st);
+      node.getRep()->getBoolBlock (rownrs, vals);
+      for (rownr_t i=0; i<nr; i++) {
+        if (vals[i]) {
+          if (offset == 0) {
+            resultTable->addRownr (st+i);             // add row
+            // Stop if max #rows reached (note that maxRow==0 means no limit).
+            if (resultTable->nrow() == maxRow) {
+              done = True;
+              break;
+            }
+          } else {
+            // Skip first offset matching rows.
+            offset--;
           }
-        } else {
-          // Skip first offset matching rows.
-          offset--;
         }
       }
     }
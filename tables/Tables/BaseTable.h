@@ -393,6 +393,16 @@ public:
      std::shared_ptr<Vector<rownr_t>> sortIterBoundaries = nullptr,
      std::shared_ptr<Vector<size_t>> sortIterKeyIdxChange = nullptr);
 
+    // Test if a table is already in the order of one or more columns
+    // of scalars. If so, the iteration boundaries (as made by sort) are
+    // filled in if given.
+    Bool isSorted
+    (const Block<String>& columnNames,
+     const Block<std::shared_ptr<BaseCompare>>& compareObjects,
+     const Block<Int>& sortOrder,
+     std::shared_ptr<Vector<rownr_t>> sortIterBoundaries = nullptr,
+     std::shared_ptr<Vector<size_t>> sortIterKeyIdxChange = nullptr);
+
     // Create an iterator.
     BaseTableIterator* makeIterator (const Block<String>& columnNames,
                                      const Block<std::shared_ptr<BaseCompare>>&,
@@ -479,6 +489,10 @@ public:
      std::shared_ptr<Vector<rownr_t>> sortIterBoundaries,
      std::shared_ptr<Vector<size_t>> sortIterKeyIdxChange);
 
+    // Get the columns to sort on and check if they are scalars.
+    PtrBlock<BaseColumn*> getSortColumns (const Block<String>& columnNames,
+                                          const Block<Int>& sortOrder);
+
     // Create a RefTable object.
     std::shared_ptr<RefTable> makeRefTable (Bool rowOrder,
                                             rownr_t initialNrrow);
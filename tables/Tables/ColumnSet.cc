@@ -978,6 +978,22 @@ void ColumnSet::syncColumns (const ColumnSet& other,
 	TableRecord& newKeySet = othercol->keywordSet();
 	newKeySet.setTableAttr (oldKeySet, defaultAttr);
 	oldKeySet = newKeySet;
+	// Another process might have stored an index on the column.
+	thiscol->resetIndexed();
+    }
+}
+
+void ColumnSet::checkIndexedRows (rownr_t firstRow)
+{
+    for (uInt i=0; i<colMap_p.size(); i++) {
+	getColumn(i)->checkIndexedRows (firstRow);
+    }
+}
+
+void ColumnSet::clearIndexChanged()
+{
+    for (uInt i=0; i<colMap_p.size(); i++) {
+	getColumn(i)->clearIndexChanged();
     }
 }
 
@@ -215,6 +215,10 @@ public:
     int traceId() const
       { return baseTablePtr_p->traceId(); }
 
+    // Get the name of the table.
+    const String& tableName() const
+      { return baseTablePtr_p->tableName(); }
+
     // Initialize rows startRownr till endRownr (inclusive).
     void initialize (rownr_t startRownr, rownr_t endRownr);
 
@@ -274,6 +278,14 @@ public:
     // The other ColumnSet gives the new data.
     void syncColumns (const ColumnSet& other, const TableAttr& defaultAttr);
 
+    // Increment the change counters of the columns in stored indices
+    // (see class ColumnsIndex) covering rows from <src>firstRow</src> on.
+    void checkIndexedRows (rownr_t firstRow);
+
+    // Clear the flags telling that the change counters have been
+    // incremented. It is done when the table is flushed.
+    void clearIndexChanged();
+
 private:
     // Remove the last data manager (used by addColumn after an exception).
     // It does the opposite of addDataManager.
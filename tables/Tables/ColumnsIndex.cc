@@ -25,6 +25,8 @@
 
 //# Includes
 #include <casacore/tables/Tables/ColumnsIndex.h>
+#include <casacore/tables/Tables/BaseTable.h>
+#include <casacore/tables/Tables/PlainColumn.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/TableLocker.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
@@ -34,11 +36,70 @@
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Utilities/Compare.h>
+#include <casacore/casa/Utilities/ValType.h>
+#include <casacore/casa/Utilities/Regex.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/OS/Directory.h>
+#include <casacore/casa/OS/DirectoryIterator.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# The header of a stored index.
+struct StoredIndexHeader
+{
+  Vector<String> names;
+  Vector<Int>    types;
+  Bool           noSort;
+  uInt64         nrow;
+  Vector<Int64>  changes;   //# change counters of the columns indexed
+};
+
+//# Read or write the header of a stored index.
+//# An index written without change counters (version 1 and 2) never
+//# matches the table.
+static void getStoredHeader (AipsIO& ios, StoredIndexHeader& header)
+{
+  uInt version = ios.getstart ("ColumnsIndex");
+  ios >> header.names >> header.types >> header.noSort >> header.nrow;
+  header.changes.resize (0);
+  if (version < 3) {
+    uInt64 stamp;
+    ios >> stamp;
+    if (version == 2) {
+      ios >> stamp;
+    }
+  } else {
+    ios >> header.changes;
+  }
+}
+static void putStoredHeader (AipsIO& ios, const StoredIndexHeader& header)
+{
+  ios.putstart ("ColumnsIndex", 3);
+  ios << header.names << header.types << header.noSort
+      << header.nrow << header.changes;
+}
+
+//# Read the header of a stored index; False if it does not exist.
+static Bool readStoredHeader (const String& fileName,
+                              StoredIndexHeader& header)
+{
+  if (! File(fileName).exists()) {
+    return False;
+  }
+  AipsIO ios (fileName);
+  getStoredHeader (ios, header);
+  return True;
+}
+
 ColumnsIndex::ColumnsIndex (const Table& table, const String& columnName,
 			    Compare* compareFunction, Bool noSort)
 : itsLowerKeyPtr (0),
@@ -52,10 +113,25 @@ ColumnsIndex::ColumnsIndex (const Table& table, const String& columnName,
 ColumnsIndex::ColumnsIndex (const Table& table,
 			    const Vector<String>& columnNames,
 			    Compare* compareFunction, Bool noSort)
+: itsLowerKeyPtr (0),
+  itsUpperKeyPtr (0)
 {
   create (table, columnNames, compareFunction, noSort);
 }
 
+ColumnsIndex::ColumnsIndex (const Table& table,
+			    const Vector<String>& columnNames,
+			    const String& indexName,
+			    Compare* compareFunction, Bool noSort)
+: itsLowerKeyPtr (0),
+  itsUpperKeyPtr (0)
+{
+  if (indexName.empty()) {
+    throw TableError ("ColumnsIndex: no name given for a stored index");
+  }
+  create (table, columnNames, compareFunction, noSort, indexName);
+}
+
 ColumnsIndex::ColumnsIndex (const ColumnsIndex& that)
 : itsLowerKeyPtr (0),
   itsUpperKeyPtr (0)
@@ -82,7 +158,12 @@ void ColumnsIndex::copy (const ColumnsIndex& that)
     itsNrrow   = itsTable.nrow();
     itsNoSort  = that.itsNoSort;
     itsCompare = that.itsCompare;
+    itsIndexName  = that.itsIndexName;
+    itsSaved      = False;
     makeObjects (that.itsLowerKeyPtr->description());
+    if (! itsIndexName.empty()) {
+      loadStored();
+    }
   }
 }
 
@@ -186,12 +267,30 @@ void ColumnsIndex::addColumnToDesc (RecordDesc& description,
 void ColumnsIndex::create (const Table& table,
 			   const Vector<String>& columnNames,
 			   Compare* compareFunction,
-			   Bool noSort)
+			   Bool noSort,
+                           const String& indexName)
 {
   itsTable = table;
   itsNrrow = itsTable.nrow();
   itsCompare = (compareFunction == 0  ?  compare : compareFunction);
   itsNoSort = noSort;
+  itsIndexName  = indexName;
+  itsSaved      = False;
+  if (! indexName.empty()) {
+    // The index is stored in the table directory, so the table has to
+    // be a plain table.
+    if (itsTable.tableType() != Table::Plain  ||  !itsTable.isRootTable()  ||
+        itsTable.getPartNames().size() != 1) {
+      throw TableError ("ColumnsIndex: stored index " + indexName +
+                        " can only be made for a plain table");
+    }
+    for (uInt i=0; i<indexName.size(); ++i) {
+      if (! (isalnum(indexName[i])  ||  indexName[i] == '_')) {
+        throw TableError ("ColumnsIndex: invalid stored index name " +
+                          indexName);
+      }
+    }
+  }
   // Loop through all column names.
   // Always add it to the RecordDesc.
   RecordDesc description;
@@ -201,6 +300,9 @@ void ColumnsIndex::create (const Table& table,
 		     TableColumn (itsTable, columnNames(i)));
   }
   makeObjects (description);
+  if (! itsIndexName.empty()) {
+    loadStored();
+  }
   readData();
 }
 	    
@@ -223,6 +325,8 @@ void ColumnsIndex::makeObjects (const RecordDesc& description)
   itsColumnChanged.resize (nrfield, False, False);
   itsColumnChanged.set (True);
   itsChanged = True;
+  itsChangeCounts.resize (nrfield);
+  itsChangeCounts = -1;
   // Create the correct column object for each field.
   // Also create a RecordFieldPtr object for each Key.
   // This makes a fast data copy possible.
@@ -316,13 +420,27 @@ void ColumnsIndex::readData()
 {
   // Acquire a lock if needed.
   TableLocker locker(itsTable, FileLocker::Read);
+  if (! itsIndexName.empty()) {
+    checkStored();
+  }
   rownr_t nrrow = itsTable.nrow();
   if (nrrow != itsNrrow) {
+    // Rows added to an unchanged stored index are merged into it.
+    if (!itsIndexName.empty()  &&  !itsChanged  &&  nrrow > itsNrrow) {
+      addRows (nrrow);
+      registerColumns();
+      itsSaved = False;
+      saveIfLocked();
+      return;
+    }
     itsColumnChanged.set (True);
     itsChanged = True;
     itsNrrow = nrrow;
   }
   if (!itsChanged) {
+    if (! itsIndexName.empty()) {
+      saveIfLocked();
+    }
     return;
   }
   Sort sort;
@@ -461,6 +579,439 @@ void ColumnsIndex::readData()
   itsDataInx = itsDataIndex.getStorage (deleteIt);
   itsUniqueInx = itsUniqueIndex.getStorage (deleteIt);
   itsChanged = False;
+  if (! itsIndexName.empty()) {
+    registerColumns();
+    itsSaved = False;
+    saveIfLocked();
+  }
+}
+
+template <typename T>
+void ColumnsIndex::addColumnRows (uInt field, rownr_t nrrow, Sort& sort)
+{
+  Vector<T>* vecptr = (Vector<T>*)itsDataVectors[field];
+  rownr_t nrold = vecptr->size();
+  vecptr->resize (nrrow, True);
+  Vector<T> newData ((*vecptr)(Slice(nrold, nrrow-nrold)));
+  ScalarColumn<T>(itsTable, itsLowerKeyPtr->description().name(field))
+    .getColumnRange (Slicer(IPosition(1,nrold), IPosition(1,nrrow-nrold)),
+                     newData);
+  itsData[field] = vecptr->data();
+  sort.sortKey (newData.data(), DataType(itsDataTypes[field]));
+}
+
+void ColumnsIndex::addRows (rownr_t nrrow)
+{
+  // Read and sort the new rows only.
+  rownr_t nrold = itsNrrow;
+  Sort sort;
+  uInt nrfield = itsDataTypes.nelements();
+  for (uInt i=0; i<nrfield; i++) {
+    switch (itsDataTypes[i]) {
+    case TpBool:
+      addColumnRows<Bool> (i, nrrow, sort);
+      break;
+    case TpUChar:
+      addColumnRows<uChar> (i, nrrow, sort);
+      break;
+    case TpShort:
+      addColumnRows<Short> (i, nrrow, sort);
+      break;
+    case TpInt:
+      addColumnRows<Int> (i, nrrow, sort);
+      break;
+    case TpUInt:
+      addColumnRows<uInt> (i, nrrow, sort);
+      break;
+    case TpInt64:
+      addColumnRows<Int64> (i, nrrow, sort);
+      break;
+    case TpFloat:
+      addColumnRows<Float> (i, nrrow, sort);
+      break;
+    case TpDouble:
+      addColumnRows<Double> (i, nrrow, sort);
+      break;
+    case TpComplex:
+      addColumnRows<Complex> (i, nrrow, sort);
+      break;
+    case TpDComplex:
+      addColumnRows<DComplex> (i, nrrow, sort);
+      break;
+    case TpString:
+      addColumnRows<String> (i, nrrow, sort);
+      break;
+    default:
+      throw (TableError ("ColumnsIndex: unknown data type"));
+    }
+  }
+  Vector<rownr_t> newIndex(nrrow - nrold);
+  if (!itsNoSort) {
+    sort.sort (newIndex, nrrow - nrold);
+  } else {
+    indgen (newIndex);
+  }
+  newIndex += nrold;
+  // Merge the new rows into the sorted rows. Compare the keys in the
+  // same way as Sort does. Equal keys keep their row order.
+  Vector<rownr_t> index(nrrow);
+  if (!itsNoSort) {
+    std::vector<std::shared_ptr<BaseCompare>> cmpObjs;
+    std::vector<size_t> sizes;
+    for (uInt i=0; i<nrfield; i++) {
+      DataType dtype = DataType(itsDataTypes[i]);
+      cmpObjs.push_back (ValType::getCmpObj (dtype));
+      sizes.push_back (ValType::getTypeSize (dtype));
+    }
+    std::merge (itsDataIndex.begin(), itsDataIndex.end(),
+                newIndex.begin(), newIndex.end(), index.begin(),
+                [&] (rownr_t row1, rownr_t row2)
+                {
+                  for (uInt i=0; i<nrfield; i++) {
+                    const char* data = static_cast<const char*>(itsData[i]);
+                    int cmp = cmpObjs[i]->comp (data + row1*sizes[i],
+                                                data + row2*sizes[i]);
+                    if (cmp != 0) {
+                      return cmp < 0;
+                    }
+                  }
+                  return False;
+                });
+  } else {
+    std::copy (itsDataIndex.begin(), itsDataIndex.end(), index.begin());
+    std::copy (newIndex.begin(), newIndex.end(), index.data() + nrold);
+  }
+  itsDataIndex.reference (index);
+  // Determine the unique keys again.
+  Sort usort;
+  for (uInt i=0; i<nrfield; i++) {
+    usort.sortKey (itsData[i], DataType(itsDataTypes[i]));
+  }
+  usort.unique (itsUniqueIndex, itsDataIndex);
+  itsDataInx = itsDataIndex.data();
+  itsUniqueInx = itsUniqueIndex.data();
+  itsNrrow = nrrow;
+}
+
+String ColumnsIndex::storedFileName (const String& tableName,
+                                     const String& indexName)
+{
+  return tableName + "/table.idx_" + indexName;
+}
+
+void ColumnsIndex::loadStored()
+{
+  // The index is recreated unless the stored index can be used.
+  setChanged();
+  itsNrrow = 0;
+  itsSaved = False;
+  String fileName = storedFileName (itsTable.tableName(), itsIndexName);
+  if (! File(fileName).exists()) {
+    return;
+  }
+  // An index not matching the columns or table is recreated.
+  // So are indices that cannot be read.
+  try {
+    AipsIO ios (fileName);
+    StoredIndexHeader header;
+    getStoredHeader (ios, header);
+    uInt nrfield = itsDataTypes.nelements();
+    if (header.nrow == 0  ||  header.nrow > itsTable.nrow()  ||
+        header.noSort != itsNoSort  ||  header.names.size() != nrfield) {
+      return;
+    }
+    // The indexed rows must not have been changed since it was stored.
+    if (header.changes.size() != nrfield  ||
+        !allEQ (header.changes, changeCounts (itsTable, header.names))) {
+      return;
+    }
+    const RecordDesc& desc = itsLowerKeyPtr->description();
+    for (uInt i=0; i<nrfield; i++) {
+      if (header.names[i] != desc.name(i)  ||
+          header.types[i] != itsDataTypes[i]) {
+        return;
+      }
+    }
+    for (uInt i=0; i<nrfield; i++) {
+      switch (itsDataTypes[i]) {
+      case TpBool:
+        ios >> *(Vector<Bool>*)itsDataVectors[i];
+        itsData[i] = ((Vector<Bool>*)itsDataVectors[i])->data();
+        break;
+      case TpUChar:
+        ios >> *(Vector<uChar>*)itsDataVectors[i];
+        itsData[i] = ((Vector<uChar>*)itsDataVectors[i])->data();
+        break;
+      case TpShort:
+        ios >> *(Vector<Short>*)itsDataVectors[i];
+        itsData[i] = ((Vector<Short>*)itsDataVectors[i])->data();
+        break;
+      case TpInt:
+        ios >> *(Vector<Int>*)itsDataVectors[i];
+        itsData[i] = ((Vector<Int>*)itsDataVectors[i])->data();
+        break;
+      case TpUInt:
+        ios >> *(Vector<uInt>*)itsDataVectors[i];
+        itsData[i] = ((Vector<uInt>*)itsDataVectors[i])->data();
+        break;
+      case TpInt64:
+        ios >> *(Vector<Int64>*)itsDataVectors[i];
+        itsData[i] = ((Vector<Int64>*)itsDataVectors[i])->data();
+        break;
+      case TpFloat:
+        ios >> *(Vector<Float>*)itsDataVectors[i];
+        itsData[i] = ((Vector<Float>*)itsDataVectors[i])->data();
+        break;
+      case TpDouble:
+        ios >> *(Vector<Double>*)itsDataVectors[i];
+        itsData[i] = ((Vector<Double>*)itsDataVectors[i])->data();
+        break;
+      case TpComplex:
+        ios >> *(Vector<Complex>*)itsDataVectors[i];
+        itsData[i] = ((Vector<Complex>*)itsDataVectors[i])->data();
+        break;
+      case TpDComplex:
+        ios >> *(Vector<DComplex>*)itsDataVectors[i];
+        itsData[i] = ((Vector<DComplex>*)itsDataVectors[i])->data();
+        break;
+      case TpString:
+        ios >> *(Vector<String>*)itsDataVectors[i];
+        itsData[i] = ((Vector<String>*)itsDataVectors[i])->data();
+        break;
+      default:
+        throw (TableError ("ColumnsIndex: unknown data type"));
+      }
+    }
+    ios >> itsDataIndex >> itsUniqueIndex;
+    ios.getend();
+    itsDataInx = itsDataIndex.data();
+    itsUniqueInx = itsUniqueIndex.data();
+    itsNrrow = header.nrow;
+    itsColumnChanged.set (False);
+    itsChanged = False;
+    registerColumns();
+    itsSaved = True;
+  } catch (const AipsError&) {
+    setChanged();
+    itsNrrow = 0;
+  }
+}
+
+void ColumnsIndex::saveStored()
+{
+  // The index is only stored if possible; otherwise it is kept in memory.
+  const String& tableName = itsTable.tableName();
+  if (! File(tableName).isWritable()) {
+    return;
+  }
+  String fileName = storedFileName (tableName, itsIndexName);
+  String tmpName = tableName + "/table.tmpidx_" + itsIndexName;
+  StoredIndexHeader header;
+  try {
+    // Columns without change counter get one, so they can be checked.
+    // Getting the keywords for write marks the table as changed, so other
+    // processes syncing the table know the rows covered might have changed.
+    Vector<String> names = columnNames();
+    for (uInt i=0; i<names.size(); i++) {
+      TableRecord& keys = TableColumn(itsTable, names[i]).rwKeywordSet();
+      if (! keys.isDefined (changeCounterName())) {
+        keys.define (changeCounterName(), Int64(0));
+        itsChangeCounts[i] = 0;
+      }
+    }
+    header.changes = itsChangeCounts;
+    header.names = columnNames();
+    header.types.resize (itsDataTypes.nelements());
+    std::copy (itsDataTypes.begin(), itsDataTypes.end(),
+               header.types.begin());
+    header.noSort = itsNoSort;
+    header.nrow = itsNrrow;
+    {
+      AipsIO ios (tmpName, ByteIO::New);
+      putStoredHeader (ios, header);
+      for (uInt i=0; i<itsDataTypes.nelements(); i++) {
+        switch (itsDataTypes[i]) {
+        case TpBool:
+          ios << *(Vector<Bool>*)itsDataVectors[i];
+          break;
+        case TpUChar:
+          ios << *(Vector<uChar>*)itsDataVectors[i];
+          break;
+        case TpShort:
+          ios << *(Vector<Short>*)itsDataVectors[i];
+          break;
+        case TpInt:
+          ios << *(Vector<Int>*)itsDataVectors[i];
+          break;
+        case TpUInt:
+          ios << *(Vector<uInt>*)itsDataVectors[i];
+          break;
+        case TpInt64:
+          ios << *(Vector<Int64>*)itsDataVectors[i];
+          break;
+        case TpFloat:
+          ios << *(Vector<Float>*)itsDataVectors[i];
+          break;
+        case TpDouble:
+          ios << *(Vector<Double>*)itsDataVectors[i];
+          break;
+        case TpComplex:
+          ios << *(Vector<Complex>*)itsDataVectors[i];
+          break;
+        case TpDComplex:
+          ios << *(Vector<DComplex>*)itsDataVectors[i];
+          break;
+        case TpString:
+          ios << *(Vector<String>*)itsDataVectors[i];
+          break;
+        default:
+          throw (TableError ("ColumnsIndex: unknown data type"));
+        }
+      }
+      ios << itsDataIndex << itsUniqueIndex;
+      ios.putend();
+    }
+    RegularFile(tmpName).move (fileName, True);
+  } catch (const AipsError&) {
+    if (File(tmpName).exists()) {
+      RegularFile(tmpName).remove();
+    }
+    return;
+  }
+  itsSaved = True;
+}
+
+void ColumnsIndex::saveIfLocked()
+{
+  if (!itsSaved  &&  itsTable.hasLock (FileLocker::Write)) {
+    saveStored();
+  }
+}
+
+void ColumnsIndex::save()
+{
+  if (itsIndexName.empty()) {
+    throw TableError ("ColumnsIndex::save: the index has no name");
+  }
+  TableLocker locker(itsTable, FileLocker::Write);
+  readData();
+}
+
+void ColumnsIndex::registerColumns()
+{
+  // The columns have to increment their change counters when written.
+  Vector<String> names = columnNames();
+  BaseTable* btab = itsTable.baseTablePtr();
+  for (const String& name : names) {
+    PlainColumn* col = dynamic_cast<PlainColumn*>(btab->getColumn (name));
+    if (col) {
+      col->setIndexed (itsNrrow);
+    }
+  }
+  itsChangeCounts = changeCounts (itsTable, names);
+}
+
+void ColumnsIndex::checkStored()
+{
+  // The indexed rows might have been changed by this or another process.
+  // Load the stored index again (which recreates it if not valid).
+  if (! allEQ (itsChangeCounts, changeCounts (itsTable, columnNames()))) {
+    loadStored();
+  }
+}
+
+Vector<Int64> ColumnsIndex::changeCounts (const Table& table,
+                                          const Vector<String>& columnNames)
+{
+  Vector<Int64> counts(columnNames.size(), -1);
+  const TableDesc& tdesc = table.tableDesc();
+  for (uInt i=0; i<columnNames.size(); i++) {
+    if (tdesc.isColumn (columnNames[i])) {
+      const TableRecord& keys =
+        TableColumn(table, columnNames[i]).keywordSet();
+      if (keys.isDefined (changeCounterName())) {
+        counts[i] = keys.asInt64 (changeCounterName());
+      }
+    }
+  }
+  return counts;
+}
+
+const String& ColumnsIndex::changeCounterName()
+{
+  static const String name("INDEX_CHANGES");
+  return name;
+}
+
+Vector<String> ColumnsIndex::storedIndexNames (const String& tableName)
+{
+  std::vector<String> names;
+  if (File(tableName).isDirectory()) {
+    DirectoryIterator iter (Directory(tableName), Regex("table\\.idx_.*"));
+    for (; !iter.pastEnd(); iter++) {
+      names.push_back (iter.name().after ("table.idx_"));
+    }
+  }
+  std::sort (names.begin(), names.end());
+  return Vector<String>(names);
+}
+
+Vector<String> ColumnsIndex::storedIndexColumns (const String& tableName,
+                                                 const String& indexName)
+{
+  StoredIndexHeader header;
+  if (! readStoredHeader (storedFileName (tableName, indexName), header)) {
+    throw TableError ("ColumnsIndex: stored index " + indexName +
+                      " does not exist in table " + tableName);
+  }
+  return header.names;
+}
+
+rownr_t ColumnsIndex::storedIndexNrow (const String& tableName,
+                                       const String& indexName)
+{
+  StoredIndexHeader header;
+  if (! readStoredHeader (storedFileName (tableName, indexName), header)) {
+    return 0;
+  }
+  return header.nrow;
+}
+
+rownr_t ColumnsIndex::storedIndexedRows (const String& tableName,
+                                         const String& columnName)
+{
+  rownr_t nrow = 0;
+  Vector<String> names = storedIndexNames (tableName);
+  for (const String& name : names) {
+    StoredIndexHeader header;
+    if (readStoredHeader (storedFileName (tableName, name), header)  &&
+        anyEQ (header.names, columnName)) {
+      nrow = std::max (nrow, rownr_t(header.nrow));
+    }
+  }
+  return nrow;
+}
+
+Bool ColumnsIndex::isStoredIndexValid (const Table& table,
+                                       const String& indexName)
+{
+  StoredIndexHeader header;
+  if (! readStoredHeader (storedFileName (table.tableName(), indexName),
+                          header)) {
+    return False;
+  }
+  return header.nrow > 0  &&  header.nrow <= table.nrow()  &&
+    header.changes.size() == header.names.size()  &&
+    allEQ (header.changes, changeCounts (table, header.names));
+}
+
+void ColumnsIndex::removeStoredIndex (const String& tableName,
+                                      const String& indexName)
+{
+  String fileName = storedFileName (tableName, indexName);
+  if (File(fileName).exists()) {
+    RegularFile(fileName).remove();
+  }
 }
 
 rownr_t ColumnsIndex::bsearch (Bool& found, const Block<void*>& fieldPtrs) const
@@ -39,6 +39,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward Declarations
 class String;
 class TableColumn;
+class Sort;
 template<typename T> class RecordFieldPtr;
 
 // <summary>
@@ -108,6 +109,34 @@ template<typename T> class RecordFieldPtr;
 // <br>If data have changed, the entire index will be recreated by
 // rereading and optionally resorting the data. This will be deferred
 // until the next key lookup.
+// <p>
+// An index can also be made persistent by giving it a name when
+// constructing it. It is stored in the table directory in the file
+// <src>table.idx_NAME</src>, so other processes opening the same index
+// can load it instead of reading and sorting the columns again.
+// When the stored index does not match the columns, it is recreated.
+// The stored index is kept up to date in the following way:
+// <ul>
+//  <li> Each indexed column has a change counter in its keyword
+//       <src>INDEX_CHANGES</src>. The table system increments it when
+//       a row covered by a stored index is written or removed (at most
+//       once between flushes of the table).
+//       The stored index contains the counters of its columns and the
+//       number of rows it covers. It is only used if the counters match
+//       (otherwise it is recreated).
+//  <li> When rows are added to the table, only the new rows are read
+//       and sorted. They are merged with the sorted index.
+//  <li> The index is only stored when the table is write-locked by the
+//       caller at the time the index is made or updated, or when
+//       <src>save</src> is called explicitly. The table is not flushed;
+//       the data written are known to other processes after the next
+//       flush or unlock.
+// </ul>
+// A stored index can only be made for a plain table (not for a selection,
+// concatenation or memory table).
+// <br>Static functions make it possible to find and remove the indices
+// stored for a table. TaQL uses a stored index on a single column to
+// limit the rows for which the WHERE expression needs to be evaluated.
 // </synopsis>
 
 // <example>
@@ -258,6 +287,15 @@ public:
     ColumnsIndex (const Table&, const Vector<String>& columnNames,
 		  Compare* compareFunction = 0, Bool noSort = False);
 
+    // Create an index on the given table for the given columns and
+    // store it with the given name in the table directory.
+    // If an index with that name and columns is already stored, it is
+    // loaded instead of reading and sorting the columns.
+    // The name can only contain alphanumeric characters and underscores.
+    ColumnsIndex (const Table&, const Vector<String>& columnNames,
+		  const String& indexName, Compare* compareFunction = 0,
+		  Bool noSort = False);
+
     // Copy constructor (copy semantics).
     ColumnsIndex (const ColumnsIndex& that);
 
@@ -275,6 +313,14 @@ public:
     // Get the table for which this index is created.
     const Table& table() const;
 
+    // Get the name of the stored index (empty if not stored).
+    const String& indexName() const;
+
+    // Bring the index up to date and store it in the table directory.
+    // It acquires a write lock on the table.
+    // An exception is thrown if the index has no name.
+    void save();
+
     // Something has changed in the table, so the index has to be recreated.
     // The 2nd version indicates that a specific column has changed,
     // so only that column is reread. If that column is not part of the
@@ -337,6 +383,35 @@ public:
     // The data type may differ.
     static void copyKeyField (void* field, int dtype, const Record& key);
 
+    // Get the names of the indices stored for the given table.
+    static Vector<String> storedIndexNames (const String& tableName);
+
+    // Get the names of the columns of the given stored index.
+    static Vector<String> storedIndexColumns (const String& tableName,
+                                              const String& indexName);
+
+    // Get the number of table rows covered by the given stored index.
+    static rownr_t storedIndexNrow (const String& tableName,
+                                    const String& indexName);
+
+    // Get the maximum number of table rows covered by the stored indices
+    // containing the given column.
+    static rownr_t storedIndexedRows (const String& tableName,
+                                      const String& columnName);
+
+    // Tell if the given stored index matches the data in the table, thus
+    // if the change counters of its columns have not been incremented
+    // since the index was stored.
+    static Bool isStoredIndexValid (const Table& table,
+                                    const String& indexName);
+
+    // Get the name of the column keyword holding the change counter.
+    static const String& changeCounterName();
+
+    // Remove the given stored index. Nothing is done if it does not exist.
+    static void removeStoredIndex (const String& tableName,
+                                   const String& indexName);
+
 protected:
     // Copy that object to this.
     void copy (const ColumnsIndex& that);
@@ -350,7 +425,8 @@ protected:
 
     // Create the various members in the object.
     void create (const Table& table, const Vector<String>& columnNames,
-		 Compare* compareFunction, Bool noSort);
+		 Compare* compareFunction, Bool noSort,
+                 const String& indexName = String());
 
     // Make the various internal <src>RecordFieldPtr</src> objects.
     void makeObjects (const RecordDesc& description);
@@ -359,6 +435,28 @@ protected:
     // form the index.
     void readData();
 
+    // Merge the rows added to the table into the sorted index.
+    void addRows (rownr_t nrrow);
+
+    // Load the stored index if it matches the columns.
+    // Otherwise the index is marked as changed, so it gets recreated.
+    void loadStored();
+
+    // Store the index (if the table directory is writable).
+    // The caller must hold a write lock on the table.
+    void saveStored();
+
+    // Store the index if not done yet and if the table is write-locked.
+    void saveIfLocked();
+
+    // Load the stored index again if a change counter of its columns
+    // has been incremented (by this or another process).
+    void checkStored();
+
+    // Tell the table columns that they are indexed and keep their
+    // change counters.
+    void registerColumns();
+
     // Do a binary search on <src>itsUniqueIndex</src> for the key in
     // <src>fieldPtrs</src>.
     // If the key is found, <src>found</src> is set to True and the index
@@ -390,6 +488,18 @@ private:
       key.get (field.name(), *field);
     }
 
+    // Read the added rows of a column and add them as sort key.
+    template <typename T>
+    void addColumnRows (uInt field, rownr_t nrrow, Sort& sort);
+
+    // Get the file name of a stored index.
+    static String storedFileName (const String& tableName,
+                                  const String& indexName);
+
+    // Get the change counters of the given columns (-1 if undefined).
+    static Vector<Int64> changeCounts (const Table& table,
+                                       const Vector<String>& columnNames);
+
     Table   itsTable;
     rownr_t itsNrrow;
     Record* itsLowerKeyPtr;
@@ -410,6 +520,9 @@ private:
     Vector<rownr_t> itsUniqueIndex;
     rownr_t*        itsDataInx;           //# pointer to data in itsDataIndex
     rownr_t*        itsUniqueInx;         //# pointer to data in itsUniqueIndex
+    String          itsIndexName;         //# name of stored index
+    Vector<Int64>   itsChangeCounts;      //# change counters of the columns
+    Bool            itsSaved;             //# stored index is up to date?
 };
 
 
@@ -421,6 +534,10 @@ inline const Table& ColumnsIndex::table() const
 {
     return itsTable;
 }
+inline const String& ColumnsIndex::indexName() const
+{
+    return itsIndexName;
+}
 inline Record& ColumnsIndex::accessKey()
 {
     return *itsLowerKeyPtr;
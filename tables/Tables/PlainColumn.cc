@@ -28,11 +28,15 @@
 #include <casacore/tables/Tables/TableTrace.h>
 #include <casacore/tables/Tables/BaseColDesc.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/ColumnsIndex.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayIter.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <algorithm>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -42,11 +46,14 @@ PlainColumn::PlainColumn (const BaseColumnDesc* cdp, ColumnSet* csp)
   dataManPtr_p  (0),
   dataColPtr_p  (0),
   colSetPtr_p   (csp),
-  originalName_p(cdp->name())
+  originalName_p(cdp->name()),
+  indexedRows_p (0),
+  indexChanged_p (False)
 {
   int trace = TableTrace::traceColumn (columnDesc());
   rtraceColumn_p = (trace&TableTrace::READ)  != 0;
   wtraceColumn_p = (trace&TableTrace::WRITE) != 0;
+  resetIndexed();
 }
 
 PlainColumn::~PlainColumn()
@@ -155,5 +162,51 @@ void PlainColumn::checkValueLength (const Array<String>* value) const
     }
 }
 
+void PlainColumn::setIndexed (rownr_t nrow)
+{
+    // Other stored indices on the column might cover more rows.
+    indexedRows_p = std::max (nrow, ColumnsIndex::storedIndexedRows
+                              (colSetPtr_p->tableName(), columnDesc().name()));
+    indexChanged_p = False;
+}
+void PlainColumn::resetIndexed()
+{
+    // Without knowing the stored indices, all rows are covered.
+    if (colDescPtr_p->keywordSet().isDefined
+        (ColumnsIndex::changeCounterName())) {
+        indexedRows_p = std::numeric_limits<rownr_t>::max();
+    } else {
+        indexedRows_p = 0;
+    }
+}
+void PlainColumn::incrIndexChanges()
+{
+    // The caller has acquired the write lock.
+    TableRecord& keys =
+      const_cast<BaseColumnDesc*>(colDescPtr_p)->rwKeywordSet();
+    const String& name = ColumnsIndex::changeCounterName();
+    Int64 count = (keys.isDefined(name)  ?  keys.asInt64(name) : 0);
+    keys.define (name, count + 1);
+    colSetPtr_p->setTableChanged();
+    indexChanged_p = True;
+}
+void PlainColumn::checkIndexedRows (const RefRows& rownrs)
+{
+    if (indexedRows_p == 0  ||  indexChanged_p) {
+        return;
+    }
+    // A sliced vector contains start,end,incr triplets.
+    const Vector<rownr_t>& rows = rownrs.rowVector();
+    if (rows.empty()) {
+        return;
+    }
+    size_t incr = (rownrs.isSliced()  ?  3 : 1);
+    rownr_t firstRow = rows[0];
+    for (size_t i=incr; i<rows.size(); i+=incr) {
+        firstRow = std::min (firstRow, rows[i]);
+    }
+    checkIndexedRows (firstRow);
+}
+
 } //# NAMESPACE CASACORE - END
 
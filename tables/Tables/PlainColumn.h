@@ -43,6 +43,7 @@ class DataManager;
 class DataManagerColumn;
 class AipsIO;
 class IPosition;
+class RefRows;
 
 
 // <summary>
@@ -135,6 +136,27 @@ public:
     // Read the column.
     void getFile (AipsIO&, const ColumnSet&, const TableAttr&);
 
+    // Tell that the column is part of a stored index (see class
+    // ColumnsIndex) covering the given number of rows. Writing a covered
+    // row increments the change counter of the column, which is kept in
+    // its keywords and used to tell if a stored index is still valid.
+    // The counter is incremented at most once until the next flush (or
+    // the next call of this function).
+    void setIndexed (rownr_t nrow);
+
+    // Tell that another process might have changed the stored indices.
+    // All rows are considered covered if the column has a change counter.
+    void resetIndexed();
+
+    // Clear the flag telling that the change counter has been incremented.
+    // It is done when the table is flushed.
+    void clearIndexChanged()
+      { indexChanged_p = False; }
+
+    // Increment the change counter if rows from <src>firstRow</src> on
+    // are covered by a stored index (and not done since the last flush).
+    void checkIndexedRows (rownr_t firstRow);
+
 protected:
     DataManager*        dataManPtr_p;    //# Pointer to data manager.
     DataManagerColumn*  dataColPtr_p;    //# Pointer to column in data manager.
@@ -142,6 +164,8 @@ protected:
     String              originalName_p;  //# Column name before any rename
     Bool                rtraceColumn_p;  //# trace reads of the column?
     Bool                wtraceColumn_p;  //# trace writes of the column?
+    rownr_t             indexedRows_p;   //# nr of rows in stored indices
+    Bool                indexChanged_p;  //# change counter incremented?
 
     // Get the trace-id of the table.
     int traceId() const
@@ -177,6 +201,14 @@ protected:
     // Inspect the auto lock when the inspection interval has expired and
     // release it when another process needs the lock.
     void autoReleaseLock() const;
+
+    // Increment the change counter if the rows to be written are covered
+    // by a stored index.
+    void checkIndexedRows (const RefRows& rownrs);
+
+private:
+    // Increment the change counter in the column keywords.
+    void incrIndexChanges();
 };
 
 
@@ -194,6 +226,12 @@ inline void PlainColumn::checkWriteLock (Bool wait) const
     { colSetPtr_p->checkWriteLock (wait); }
 inline void PlainColumn::autoReleaseLock() const
     { colSetPtr_p->autoReleaseLock(); }
+inline void PlainColumn::checkIndexedRows (rownr_t firstRow)
+{
+    if (firstRow < indexedRows_p  &&  !indexChanged_p) {
+        incrIndexChanges();
+    }
+}
 
 
 
@@ -576,6 +576,7 @@ Bool PlainTable::putFile (Bool always)
     // Clear the change-flags for the next round.
     tableChanged_p = False;
     colSetPtr_p->dataManChanged() = False;
+    colSetPtr_p->clearIndexChanged();
     return writeTab;
 }
 
@@ -690,6 +691,8 @@ void PlainTable::removeRow (rownr_t rownr)
     //# Locking has to be done here, otherwise nrrow_p is not up-to-date
     //# when autoReleaseLock releases the lock and writes the data.
     colSetPtr_p->checkWriteLock (True);
+    // Stored indices covering the row are no longer valid.
+    colSetPtr_p->checkIndexedRows (rownr);
     colSetPtr_p->removeRow (rownr);
     nrrow_p--;
     colSetPtr_p->autoReleaseLock();
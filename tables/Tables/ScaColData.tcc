@@ -144,6 +144,7 @@ void ScalarColumnData<T>::put (rownr_t rownr, const void* val)
     }
     checkValueLength (static_cast<const T*>(val));
     checkWriteLock (True);
+    checkIndexedRows (rownr);
     dataColPtr_p->put (rownr, static_cast<const T*>(val));
     autoReleaseLock();
 }
@@ -159,6 +160,7 @@ void ScalarColumnData<T>::putScalarColumn (const ArrayBase& val)
     }
     checkValueLength (static_cast<const Array<T>*>(&val));
     checkWriteLock (True);
+    checkIndexedRows (0);
     dataColPtr_p->putScalarColumnV (val);
     autoReleaseLock();
 }
@@ -175,6 +177,7 @@ void ScalarColumnData<T>::putScalarColumnCells (const RefRows& rownrs,
     }
     checkValueLength (static_cast<const Array<T>*>(&val));
     checkWriteLock (True);
+    checkIndexedRows (rownrs);
     dataColPtr_p->putScalarColumnCellsV (rownrs, val);
     autoReleaseLock();
 }
@@ -735,6 +735,20 @@ Table Table::sort (const Block<String>& names,
 		   const Block<Int>& orders, int option) const
     { return Table(baseTabPtr_p->sort (names, cmpObjs, orders, option)); }
 
+//# Test if in order of multiple columns, where a global order is given.
+Bool Table::isSorted (const Block<String>& names, int order) const
+{
+    return isSorted (names,
+                     Block<std::shared_ptr<BaseCompare>>(names.nelements()),
+                     Block<Int>(names.nelements(), order));
+}
+
+//# Test if in order of multiple columns with given orders and functions.
+Bool Table::isSorted (const Block<String>& names,
+                      const Block<std::shared_ptr<BaseCompare>>& cmpObjs,
+                      const Block<Int>& orders) const
+    { return baseTabPtr_p->isSorted (names, cmpObjs, orders); }
+
 
 //# Create an expression node to handle a keyword.
 //# The code to handle this is in TableExprNode, because there the
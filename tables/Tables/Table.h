@@ -165,6 +165,7 @@ friend class TableIterator;
 friend class RODataManAccessor;
 friend class TableExprNode;
 friend class TableExprNodeRep;
+friend class ColumnsIndex;
 
 public:
     // Define the possible options how a table can be opened.
@@ -827,6 +828,8 @@ public:
     // the standard compare function defined in Compare.h will be used.
     // Default sort order is ascending.
     // Default sorting algorithm is the parallel sort.
+    // For large tables Sort::RadixSort is faster if all columns are of a
+    // fixed-width numeric type (e.g. TIME, ANTENNA1, ANTENNA2).
     // <group>
     // Sort on one column.
     Table sort (const String& columnName,
@@ -855,6 +858,18 @@ public:
 		int = Sort::ParSort) const;
     // </group>
 
+    // Test if the table is already in the order of one or more columns of
+    // scalars, thus if <src>sort</src> would keep the rows in their order.
+    // It reads the key columns once and stops at the first row out of
+    // order. It can be used to avoid an expensive sort.
+    // <group>
+    Bool isSorted (const Block<String>& columnNames,
+                   int = Sort::Ascending) const;
+    Bool isSorted (const Block<String>& columnNames,
+                   const Block<std::shared_ptr<BaseCompare>>& compareObjects,
+                   const Block<Int>& sortOrders) const;
+    // </group>
+
     // Get a vector of row numbers in the root table of rows in this table.
     // In case the table is a subset of the root table, this tells which
     // rows of the root table are part of the subset.
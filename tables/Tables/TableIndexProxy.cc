@@ -25,13 +25,14 @@
 
 #include <casacore/tables/Tables/TableIndexProxy.h>
 #include <casacore/tables/Tables/TableProxy.h>
+#include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 TableIndexProxy::TableIndexProxy (const TableProxy& tablep,
 				  const Vector<String>& columnNames,
-				  Bool noSort)
+				  Bool noSort, const String& indexName)
 : scaIndex_p (0),
   arrIndex_p (0)
 {
@@ -39,11 +40,20 @@ TableIndexProxy::TableIndexProxy (const TableProxy& tablep,
     const String& colName = columnNames(0);
     const TableDesc& td = tablep.table().tableDesc();
     if (td.isColumn(colName)  &&  td[colName].isArray()) {
+      if (! indexName.empty()) {
+        throw TableError ("TableIndexProxy: stored index " + indexName +
+                          " cannot be made for array column " + colName);
+      }
       arrIndex_p = new ColumnsIndexArray (tablep.table(), colName);
       return;
     }
   }
-  scaIndex_p = new ColumnsIndex (tablep.table(), columnNames, 0, noSort);
+  if (indexName.empty()) {
+    scaIndex_p = new ColumnsIndex (tablep.table(), columnNames, 0, noSort);
+  } else {
+    scaIndex_p = new ColumnsIndex (tablep.table(), columnNames, indexName,
+                                   0, noSort);
+  }
 }
 
 TableIndexProxy::TableIndexProxy (const TableIndexProxy& that)
@@ -82,6 +92,14 @@ Vector<String> TableIndexProxy::columnNames() const
   return names;
 }
 
+String TableIndexProxy::indexName() const
+{
+  if (scaIndex_p != 0) {
+    return scaIndex_p->indexName();
+  }
+  return String();
+}
+
 void TableIndexProxy::setChanged (const Vector<String>& columnNames)
 {
   if (columnNames.nelements() == 0) {
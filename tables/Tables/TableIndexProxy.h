@@ -69,8 +69,11 @@ class TableIndexProxy
 {
 public:
   // Construct for the given columns in the table.
+  // If an index name is given, the index is stored in the table directory
+  // (see class ColumnsIndex). It is only possible for scalar columns.
   TableIndexProxy (const TableProxy& table,
-		   const Vector<String>& columnNames, Bool noSort);
+		   const Vector<String>& columnNames, Bool noSort,
+                   const String& indexName = String());
 
   // Copy constructor.
   TableIndexProxy (const TableIndexProxy&);
@@ -86,6 +89,9 @@ public:
   // Return the names of the columns forming the index.
   Vector<String> columnNames() const;
 
+  // Return the name of the stored index (empty if not stored).
+  String indexName() const;
+
   // Something has changed in the table, so the index has to be recreated.
   // An empty vector means that all columns have changed, otherwise
   // only the given columns.
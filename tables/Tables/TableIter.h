@@ -73,7 +73,7 @@ template<class T> class Block;
 // (e.g. iterate in 60 seconds time intervals).
 //
 // The table is sorted before doing the iteration unless TableIterator::NoSort
-// is given.
+// is given or TableIterator::CheckSort finds the table is already in order.
 // </synopsis> 
 
 // <example>
@@ -123,7 +123,9 @@ public:
                  HeapSort = Sort::HeapSort,
                  InsSort  = Sort::InsSort,
                  ParSort  = Sort::ParSort,
-                 NoSort   = 64};
+                 RadixSort= Sort::RadixSort,
+                 NoSort   = 64,
+                 CheckSort= 128};
 
     // Create a null TableIterator object (i.e. no iterator is attached yet).
     // The sole purpose of this constructor is to allow construction
@@ -150,8 +152,17 @@ public:
     // a single core machine QuickSort usually performs better.
     // InsSort (insertion sort) should only be used if the input
     // is almost in order.
+    // RadixSort is the fastest for large tables if all columns are of
+    // a fixed-width numeric type using the default compare object. If not,
+    // ParSort is used instead.
     // If it is known that the table is already in order, the sort step can be
     // bypassed by giving the option TableIterator::NoSort.
+    // If the table is likely to be in order (e.g. a MeasurementSet in
+    // TIME order), the option TableIterator::CheckSort can be given.
+    // It reads the key columns once to check if the table is in order.
+    // If so, no sort is done and the iteration steps through the table
+    // itself finding the boundaries of the groups as it goes.
+    // Otherwise, the table is sorted using ParSort.
     // The default option is ParSort.
     // <group>
     TableIterator (const Table&, const String& columnName,
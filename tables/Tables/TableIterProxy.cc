@@ -68,6 +68,10 @@ TableIterProxy::TableIterProxy (const TableProxy& tab,
       tabsort = TableIterator::ParSort;
     } else if (csort[0] == 'n') {
       tabsort = TableIterator::NoSort;
+    } else if (csort[0] == 'r') {
+      tabsort = TableIterator::RadixSort;
+    } else if (csort[0] == 'c') {
+      tabsort = TableIterator::CheckSort;
     }
   }
   if (iterSteps.empty()  ||  tab.table().nrow() == 0) {
@@ -117,6 +121,10 @@ void TableIterProxy::makeStepIter (const Table& tab,
   }
   // First sort the table to fully order the columns with an interval.
   Table sortab(tab);
+  if (option == TableIterator::CheckSort) {
+    option = (tab.isSorted (columns, comps, orders)  ?
+              TableIterator::NoSort : TableIterator::ParSort);
+  }
   if (option != TableIterator::NoSort) {
     Table sortab = tab.sort (columns, comps, orders, option);
   }
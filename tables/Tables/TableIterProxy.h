@@ -93,7 +93,9 @@ public:
   // character in it is important.
   // <br>order[0]=a means ascending; d means descending.
   // <br>sortType[0]=q means quicksort, i means insertion sort,
-  //                 n means nosort, h means heapsort, otherwise parsort
+  //                 n means nosort, h means heapsort, r means radixsort,
+  //                 c means check if in order and only parsort if not,
+  //                 otherwise parsort
   // <br>For each column an iteration interval can be given making it possible
   // to iterate in e.g. time chunks of 1 minute. Not given or zero means
   // no interval is given for that column, thus a normal comparison is done.
@@ -0,0 +1,279 @@
+//# tColumnsIndexStored.cc: Test program for stored ColumnsIndex objects
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/ColumnsIndex.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/Containers/RecordField.h>
+#include <casacore/casa/Utilities/GenSort.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for indices stored in the table directory.
+// The rows found using a stored index are compared to the rows found
+// using a transient index after the stored index has been loaded,
+// extended with new rows, and invalidated by changing data.
+// </summary>
+
+const String theTableName ("tColumnsIndexStored_tmp.tab");
+
+Table makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ANT"));
+  td.addColumn (ScalarColumnDesc<Double>("TIME"));
+  td.addColumn (ScalarColumnDesc<String>("NAME"));
+  SetupNewTable newtab (theTableName, td, Table::Scratch);
+  Table tab (newtab);
+  return tab;
+}
+
+void addRows (Table& tab, uInt nrow)
+{
+  ScalarColumn<Int> ant (tab, "ANT");
+  ScalarColumn<Double> time (tab, "TIME");
+  ScalarColumn<String> name (tab, "NAME");
+  rownr_t first = tab.nrow();
+  tab.addRow (nrow);
+  for (rownr_t i=first; i<tab.nrow(); ++i) {
+    ant.put (i, (i*7) % 13);
+    time.put (i, 10 + (i/20) * 0.5);
+    name.put (i, "N" + String::toString(i%4));
+  }
+}
+
+// Compare the rows found in the index with those of a transient index.
+void checkIndex (ColumnsIndex& index)
+{
+  const Table& tab = index.table();
+  ColumnsIndex trans (tab, stringToVector("ANT,TIME"));
+  AlwaysAssertExit (index.isUnique() == trans.isUnique());
+  Record key (index.accessKey().description());
+  RecordFieldPtr<Int> ant (key, "ANT");
+  RecordFieldPtr<Double> time (key, "TIME");
+  rownr_t nfound = 0;
+  for (Int a=-1; a<14; ++a) {
+    for (rownr_t i=0; i<tab.nrow()+40; i+=17) {
+      *ant = a;
+      *time = 10 + (i/20) * 0.5;
+      Vector<rownr_t> rows1 = index.getRowNumbers (key);
+      Vector<rownr_t> rows2 = trans.getRowNumbers (key);
+      genSort (rows1);
+      genSort (rows2);
+      AlwaysAssertExit (rows1.size() == rows2.size());
+      AlwaysAssertExit (allEQ (rows1, rows2));
+      nfound += rows1.size();
+    }
+  }
+  AlwaysAssertExit (nfound > 0);
+  // Check a key range.
+  Record lower (key);
+  Record upper (key);
+  lower.define ("ANT", 3);
+  lower.define ("TIME", 12.);
+  upper.define ("ANT", 5);
+  upper.define ("TIME", 14.);
+  Vector<rownr_t> rows1 = index.getRowNumbers (lower, upper, True, False);
+  Vector<rownr_t> rows2 = trans.getRowNumbers (lower, upper, True, False);
+  genSort (rows1);
+  genSort (rows2);
+  AlwaysAssertExit (rows1.size() > 0);
+  AlwaysAssertExit (allEQ (rows1, rows2));
+}
+
+Int64 changeCount (const Table& tab, const String& columnName)
+{
+  return TableColumn(tab, columnName).keywordSet().asInt64
+    (ColumnsIndex::changeCounterName());
+}
+
+void testStored (Table& tab)
+{
+  addRows (tab, 1000);
+  Vector<String> colNames = stringToVector("ANT,TIME");
+  ColumnsIndex index (tab, colNames, "antTime");
+  AlwaysAssertExit (index.indexName() == "antTime");
+  Vector<String> names = ColumnsIndex::storedIndexNames (theTableName);
+  AlwaysAssertExit (names.size() == 1  &&  names[0] == "antTime");
+  AlwaysAssertExit (allEQ (ColumnsIndex::storedIndexColumns (theTableName,
+                                                             "antTime"),
+                           colNames));
+  AlwaysAssertExit (ColumnsIndex::storedIndexNrow (theTableName, "antTime")
+                    == 1000);
+  AlwaysAssertExit (ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  AlwaysAssertExit (changeCount (tab, "ANT") == 0);
+  checkIndex (index);
+  // Load the stored index in another object.
+  ColumnsIndex index2 (tab, colNames, "antTime");
+  checkIndex (index2);
+  // Add rows; they are merged into the index.
+  addRows (tab, 237);
+  AlwaysAssertExit (changeCount (tab, "ANT") == 0);
+  checkIndex (index2);
+  AlwaysAssertExit (ColumnsIndex::storedIndexNrow (theTableName, "antTime")
+                    == 1237);
+  // The other object sees the added rows as well.
+  checkIndex (index);
+  // Changing an indexed column increments its change counter, which
+  // invalidates the stored index.
+  ScalarColumn<Int> ant (tab, "ANT");
+  ant.put (5, 20);
+  AlwaysAssertExit (changeCount (tab, "ANT") == 1);
+  AlwaysAssertExit (! ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  checkIndex (index);
+  AlwaysAssertExit (ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  checkIndex (index2);
+  ant.putColumnRange (Slicer(IPosition(1,1230), IPosition(1,7)),
+                      Vector<Int>(7, 2));
+  AlwaysAssertExit (changeCount (tab, "ANT") == 2);
+  AlwaysAssertExit (! ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  checkIndex (index2);
+  checkIndex (index);
+  // The counter is incremented once until the next flush.
+  ant.put (6, 3);
+  ant.put (7, 3);
+  AlwaysAssertExit (changeCount (tab, "ANT") == 3);
+  tab.flush();
+  ant.put (8, 3);
+  AlwaysAssertExit (changeCount (tab, "ANT") == 4);
+  checkIndex (index);
+  // Changing another column or adding rows does not.
+  ScalarColumn<String> name (tab, "NAME");
+  name.put (5, "N5");
+  addRows (tab, 3);
+  AlwaysAssertExit (changeCount (tab, "ANT") == 4);
+  AlwaysAssertExit (ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  AlwaysAssertExit (ColumnsIndex::storedIndexNrow (theTableName, "antTime")
+                    == 1237);
+  checkIndex (index);
+  AlwaysAssertExit (ColumnsIndex::storedIndexNrow (theTableName, "antTime")
+                    == 1240);
+  // Removing a row increments the counter.
+  tab.removeRow (10);
+  AlwaysAssertExit (changeCount (tab, "ANT") == 5);
+  AlwaysAssertExit (! ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  checkIndex (index);
+  AlwaysAssertExit (ColumnsIndex::storedIndexNrow (theTableName, "antTime")
+                    == tab.nrow());
+  AlwaysAssertExit (ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  // Without a write lock the index is not stored, unless done explicitly.
+  ant.put (20, 3);
+  tab.unlock();
+  AlwaysAssertExit (! tab.hasLock (FileLocker::Write));
+  checkIndex (index);
+  AlwaysAssertExit (! ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  index.save();
+  AlwaysAssertExit (ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  checkIndex (index2);
+  // An index with the same name on other columns replaces it.
+  ColumnsIndex index3 (tab, Vector<String>(1, "NAME"), "antTime");
+  index3.save();
+  AlwaysAssertExit (ColumnsIndex::storedIndexColumns (theTableName,
+                                                      "antTime").size() == 1);
+  index3.accessKey().define ("NAME", "N5");
+  Vector<rownr_t> rows = index3.getRowNumbers();
+  AlwaysAssertExit (rows.size() == 1  &&  rows[0] == 5);
+  ColumnsIndex::removeStoredIndex (theTableName, "antTime");
+  AlwaysAssertExit (ColumnsIndex::storedIndexNames(theTableName).empty());
+}
+
+// A process not using the index increments the change counter as well.
+void testReopen()
+{
+  const String tabName ("tColumnsIndexStored_tmp.tab2");
+  Vector<String> colNames = stringToVector("ANT,TIME");
+  {
+    TableDesc td;
+    td.addColumn (ScalarColumnDesc<Int>("ANT"));
+    td.addColumn (ScalarColumnDesc<Double>("TIME"));
+    td.addColumn (ScalarColumnDesc<String>("NAME"));
+    SetupNewTable newtab (tabName, td, Table::New);
+    Table tab (newtab);
+    addRows (tab, 100);
+    ColumnsIndex index (tab, colNames, "antTime");
+  }
+  {
+    Table tab (tabName, Table::Update);
+    AlwaysAssertExit (ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+    ScalarColumn<Int> ant (tab, "ANT");
+    ant.put (3, 7);
+  }
+  Table tab (tabName, Table::Update);
+  AlwaysAssertExit (changeCount (tab, "ANT") == 1);
+  AlwaysAssertExit (! ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  // The rebuilt index is stored because a write lock is held.
+  tab.lock (FileLocker::Write);
+  ColumnsIndex index (tab, colNames, "antTime");
+  checkIndex (index);
+  AlwaysAssertExit (ColumnsIndex::isStoredIndexValid (tab, "antTime"));
+  tab.unlock();
+  tab.markForDelete();
+}
+
+void testErrors (const Table& tab)
+{
+  Bool caught = False;
+  try {
+    ColumnsIndex index (tab, Vector<String>(1, "ANT"), "ant.x");
+  } catch (const TableError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+  // A selection cannot have a stored index.
+  caught = False;
+  try {
+    ColumnsIndex index (tab(tab.col("ANT") > 3), Vector<String>(1, "ANT"),
+                        "ant");
+  } catch (const TableError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable();
+    testStored (tab);
+    testErrors (tab);
+    testReopen();
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
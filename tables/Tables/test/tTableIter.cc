@@ -55,6 +55,7 @@ void doiter1();
 void doiter2();
 void doiter3();
 void test_cache_boundaries();
+void test_check_sort();
 
 int main (int argc, const char* argv[])
 {
@@ -70,6 +71,7 @@ int main (int argc, const char* argv[])
     doiter2();               // do two column iteration
     doiter3();               // do interval iteration
     test_cache_boundaries(); // test option to cache group boundaries
+    test_check_sort();       // test option to sort only if not in order
     return 0;                // successfully executed
 }
 
@@ -332,3 +334,47 @@ void test_cache_boundaries()
         iter2.next();
     }
 }
+
+// Check that both iterators give the same groups.
+void compare_iters (TableIterator& iter1, TableIterator& iter2)
+{
+    while (!iter1.pastEnd()) {
+        AlwaysAssertExit(!iter2.pastEnd());
+        AlwaysAssertExit(allEQ(iter1.table().rowNumbers(),
+                               iter2.table().rowNumbers()));
+        AlwaysAssertExit(iter1.keyChangeAtLastNext() ==
+                         iter2.keyChangeAtLastNext());
+        iter1.next();
+        iter2.next();
+    }
+    AlwaysAssertExit(iter2.pastEnd());
+}
+
+void test_check_sort()
+{
+    // Test CheckSort on a table not in order and on a table in order.
+    Table tab1 ("tTableIter_tmp.data");
+    Block<String> sortCols(2);
+    sortCols[0] = "col2";
+    sortCols[1] = "col1";
+    Block<std::shared_ptr<BaseCompare>> compObj(2);   // use default compares
+    Block<Int> orders(2, TableIterator::Ascending);
+    Table tab2 = tab1.sort (sortCols);
+    AlwaysAssertExit(!tab1.isSorted (sortCols));
+    AlwaysAssertExit(tab2.isSorted (sortCols));
+    AlwaysAssertExit(!tab2.isSorted (sortCols, Sort::Descending));
+    for (int i=0; i<2; ++i) {
+        const Table& tab = (i==0 ? tab1 : tab2);
+        for (int cache=0; cache<2; ++cache) {
+            TableIterator iter1(tab, sortCols, compObj, orders,
+                                TableIterator::ParSort, cache);
+            TableIterator iter2(tab, sortCols, compObj, orders,
+                                TableIterator::CheckSort, cache);
+            compare_iters (iter1, iter2);
+            // Also after a reset.
+            iter1.reset();
+            iter2.reset();
+            compare_iters (iter1, iter2);
+        }
+    }
+}